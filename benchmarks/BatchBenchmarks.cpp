@@ -0,0 +1,103 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <maths/Bounds.h>
+#include <maths/Quaternion.h>
+#include <maths/bounds/FrustumCulling.h>
+#include <maths/quaternion/BatchRotation.h>
+
+#include "BenchmarkData.h"
+
+using namespace DatEngine::DatMaths;
+using namespace DatEngine::Benchmarks;
+
+/* -------------------------------------------- */
+/*  Quaternions                                 */
+/* -------------------------------------------- */
+
+TEST_CASE("Batch Rotation", "[!benchmark][DatMaths][Quaternion][Batch]") {
+    Random random;
+    const quat rotation = random.nextQuat();
+    const std::vector<quat> from = makeBatch<quat>([&] { return random.nextQuat(); });
+    const std::vector<quat> to = makeBatch<quat>([&] { return random.nextQuat(); });
+    const std::vector<vec3> vectors = makeBatch<vec3>([&] { return random.nextVec3(); });
+    std::vector<vec3> outVectors(batchSize);
+    std::vector<quat> outRotations(batchSize);
+
+    BENCHMARK("quat * vec3 loop x1024") {
+        for (size_t i = 0; i < batchSize; ++i) {
+            outVectors[i] = rotation * vectors[i];
+        }
+        return outVectors[0];
+    };
+
+    BENCHMARK("rotate x1024") {
+        rotate(rotation, vectors, outVectors);
+        return outVectors[0];
+    };
+
+    BENCHMARK("rotate instanced x1024") {
+        rotate(from, vectors, outVectors);
+        return outVectors[0];
+    };
+
+    BENCHMARK("slerp loop x1024") {
+        for (size_t i = 0; i < batchSize; ++i) {
+            outRotations[i] = slerp(from[i], to[i], 0.25f);
+        }
+        return outRotations[0].s;
+    };
+
+    BENCHMARK("nlerp x1024") {
+        nlerp(from, to, 0.25f, outRotations);
+        return outRotations[0].s;
+    };
+
+    BENCHMARK("slerp x1024") {
+        slerp(from, to, 0.25f, outRotations);
+        return outRotations[0].s;
+    };
+}
+
+/* -------------------------------------------- */
+/*  Frustum Culling                             */
+/* -------------------------------------------- */
+
+TEST_CASE("Frustum Culling", "[!benchmark][DatMaths][Bounds][Batch]") {
+    // A symmetric 90 degree perspective projection looking down -Z, with a depth range of 0.1 to 100
+    mat4 projection;
+    projection[0][0] = 1;
+    projection[1][1] = 1;
+    projection[2][2] = 100.f / (0.1f - 100.f);
+    projection[2][3] = -1;
+    projection[3][2] = 0.1f * 100.f / (0.1f - 100.f);
+    const Frustum frustum(projection);
+
+    Random random;
+    const Vec3SoA centres(makeBatch<vec3>([&] {
+        return vec3(random.next(-50, 50), random.next(-50, 50), random.next(-110, 10));
+    }));
+    const Vec3SoA extents(makeBatch<vec3>([&] {
+        return vec3(random.next(0, 5), random.next(0, 5), random.next(0, 5));
+    }));
+    const std::vector<float> radii = makeBatch<float>([&] { return random.next(0, 5); });
+    std::vector<uint64_t> visibility(visibilityMaskSize(batchSize));
+
+    BENCHMARK("Frustum::intersects sphere loop x1024") {
+        size_t visible = 0;
+        for (size_t i = 0; i < batchSize; ++i) {
+            visible += frustum.intersects(BoundingSphere(centres.get(i), radii[i]));
+        }
+        return visible;
+    };
+
+    BENCHMARK("cullSpheres x1024") {
+        cullSpheres(frustum, centres, radii, visibility);
+        return visibility[0];
+    };
+
+    BENCHMARK("cullAABBs x1024") {
+        cullAABBs(frustum, centres, extents, visibility);
+        return visibility[0];
+    };
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <maths/Matrix.h>
+#include <maths/Quaternion.h>
+#include <maths/Vector.h>
+
+namespace DatEngine::Benchmarks {
+    /**
+     * The number of elements in each batch, small enough that the inputs and outputs stay in cache so the benchmarks
+     * measure the maths rather than memory bandwidth
+     */
+    constexpr size_t batchSize = 1024;
+
+    /**
+     * A small deterministic random number generator, so every run benchmarks the same data
+     */
+    class Random {
+        uint32_t state;
+
+    public:
+        explicit Random(const uint32_t seed = 12345) : state(seed) {}
+
+        /**
+         * Get the next value in the range [min, max)
+         */
+        float next(const float min = -1, const float max = 1) {
+            state = state * 1664525u + 1013904223u;
+            return min + (max - min) * static_cast<float>(state >> 8) / static_cast<float>(1 << 24);
+        }
+
+        DatMaths::vec3 nextVec3() { return {next(), next(), next()}; }
+
+        DatMaths::vec4 nextVec4() { return {next(), next(), next(), next()}; }
+
+        DatMaths::quat nextQuat() {
+            return DatMaths::quat::fromAxisAngle(nextVec3().normalised(), next(0, DatMaths::constants::doublePi));
+        }
+
+        /**
+         * Get a random rigid transform, which is always invertible
+         */
+        DatMaths::mat4 nextTransform() {
+            DatMaths::mat4 result = nextQuat().toMat4();
+            result[3] = DatMaths::vec4(nextVec3() * 10.f, 1);
+            return result;
+        }
+    };
+
+    /**
+     * Fill a vector with batchSize values from a generator
+     */
+    template<typename T, typename TGenerator>
+    std::vector<T> makeBatch(TGenerator generator, const size_t size = batchSize) {
+        std::vector<T> result;
+        result.reserve(size);
+        for (size_t i = 0; i < size; ++i) {
+            result.push_back(generator());
+        }
+        return result;
+    }
+} // namespace DatEngine::Benchmarks
@@ -0,0 +1,27 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <util/CVar.h>
+
+using namespace DatEngine;
+
+namespace {
+    CVarBool benchBoolCVar("BBenchBool", "A bool CVar for benchmarks", CVarCategory::General, true);
+} // namespace
+
+TEST_CASE("CVar Reads", "[!benchmark][CVar]") {
+    constexpr int reads = 1000;
+    const CVarRef<bool> boolRef = "BBenchBool"_cvar;
+
+    BENCHMARK("Lookup by name") {
+        int count = 0;
+        for (int i = 0; i < reads; ++i) count += CVarSystem::get()->getBoolCVar("BBenchBool")->load();
+        return count;
+    };
+
+    BENCHMARK("CVarRef") {
+        int count = 0;
+        for (int i = 0; i < reads; ++i) count += boolRef.get();
+        return count;
+    };
+}
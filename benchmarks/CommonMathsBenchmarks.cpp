@@ -0,0 +1,83 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cmath>
+
+#include <maths/CommonMaths.h>
+
+#include "BenchmarkData.h"
+
+using namespace DatEngine::DatMaths;
+using namespace DatEngine::Benchmarks;
+
+namespace {
+    /**
+     * Sum a function over every input, so each precision tier is measured with the same loop
+     */
+    template<typename TFunction>
+    float sumOver(const std::vector<float>& inputs, TFunction function) {
+        float sum = 0;
+        for (const float input : inputs) {
+            sum += function(input);
+        }
+        return sum;
+    }
+} // namespace
+
+/* -------------------------------------------- */
+/*  Roots                                       */
+/* -------------------------------------------- */
+
+TEST_CASE("Roots", "[!benchmark][DatMaths][CommonMaths]") {
+    Random random;
+    const std::vector<float> inputs = makeBatch<float>([&] { return random.next(1e-3f, 1e3f); });
+
+    BENCHMARK("std::sqrt x1024") { return sumOver(inputs, [](const float x) { return std::sqrt(x); }); };
+    BENCHMARK("sqrt<Fast> x1024") { return sumOver(inputs, [](const float x) { return sqrt<Precision::Fast>(x); }); };
+    BENCHMARK("sqrt<Balanced> x1024") {
+        return sumOver(inputs, [](const float x) { return sqrt<Precision::Balanced>(x); });
+    };
+
+    BENCHMARK("1 / std::sqrt x1024") { return sumOver(inputs, [](const float x) { return 1 / std::sqrt(x); }); };
+    BENCHMARK("invSqrt<Fast> x1024") {
+        return sumOver(inputs, [](const float x) { return invSqrt<Precision::Fast>(x); });
+    };
+    BENCHMARK("invSqrt<Balanced> x1024") {
+        return sumOver(inputs, [](const float x) { return invSqrt<Precision::Balanced>(x); });
+    };
+    BENCHMARK("invSqrt<Exact> x1024") {
+        return sumOver(inputs, [](const float x) { return invSqrt<Precision::Exact>(x); });
+    };
+}
+
+/* -------------------------------------------- */
+/*  Trigonometry                                */
+/* -------------------------------------------- */
+
+TEST_CASE("Trigonometry", "[!benchmark][DatMaths][CommonMaths]") {
+    Random random;
+    const std::vector<float> inputs = makeBatch<float>([&] { return random.next(-10, 10); });
+
+    BENCHMARK("std::sin x1024") { return sumOver(inputs, [](const float x) { return std::sin(x); }); };
+    BENCHMARK("sin<Fast> x1024") { return sumOver(inputs, [](const float x) { return sin<Precision::Fast>(x); }); };
+    BENCHMARK("sin<Balanced> x1024") {
+        return sumOver(inputs, [](const float x) { return sin<Precision::Balanced>(x); });
+    };
+
+    BENCHMARK("std::atan2 x1024") {
+        return sumOver(inputs, [](const float x) { return std::atan2(x, 1.5f); });
+    };
+    BENCHMARK("atan2<Balanced> x1024") {
+        return sumOver(inputs, [](const float x) { return atan2<Precision::Balanced>(x, 1.5f); });
+    };
+
+#ifdef DAT_SIMD_AVX
+    BENCHMARK("sin<Balanced> __m256 x1024") {
+        __m256 sum = _mm256_setzero_ps();
+        for (size_t i = 0; i < batchSize; i += 8) {
+            sum = _mm256_add_ps(sum, sin<Precision::Balanced>(_mm256_loadu_ps(&inputs[i])));
+        }
+        return _mm256_cvtss_f32(sum);
+    };
+#endif
+}
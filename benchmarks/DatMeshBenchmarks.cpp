@@ -0,0 +1,45 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <dat-mesh/Conversion.h>
+
+#include <string>
+#include <utility>
+
+#include "BenchmarkData.h"
+
+using namespace DatAssetIO::DatMesh;
+using namespace DatEngine::Benchmarks;
+
+/* -------------------------------------------- */
+/*  Conversion                                  */
+/* -------------------------------------------- */
+
+TEST_CASE("DatMesh Conversion", "[!benchmark][DatMesh][Conversion]") {
+    // 1024 vec4 attributes
+    constexpr size_t componentCount = batchSize * 4;
+
+    Random random;
+    const std::vector<float> components = makeBatch<float>([&] { return random.next(); }, componentCount);
+    std::vector<uint8_t> encoded(componentCount * sizeof(float));
+    std::vector<float> decoded(componentCount);
+
+    const std::pair<TypeHint, std::string> typeHints[] = {
+            {TypeHint::R16G16B16A16SFloat, "R16G16B16A16SFloat"},
+            {TypeHint::R8G8B8A8UNorm, "R8G8B8A8UNorm"},
+            {TypeHint::R16G16B16A16SNorm, "R16G16B16A16SNorm"},
+            {TypeHint::R16G16B16A16SInt, "R16G16B16A16SInt"}
+    };
+
+    for (const auto& [typeHint, name] : typeHints) {
+        const std::span<uint8_t> typeEncoded = std::span(encoded).first(componentCount * getPrimitiveSize(typeHint));
+
+        BENCHMARK("convertFromFloat " + name + " x1024") {
+            return convertFromFloat(typeHint, components, typeEncoded);
+        };
+
+        BENCHMARK("convertToFloat " + name + " x1024") {
+            return convertToFloat(typeHint, typeEncoded, decoded);
+        };
+    }
+}
@@ -0,0 +1,197 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <memory>
+#include <vector>
+
+#include <ecs/Registry.h>
+
+#include "BenchmarkData.h"
+
+using namespace DatEngine::DatMaths;
+using namespace DatEngine::ECS;
+using namespace DatEngine::Benchmarks;
+
+namespace {
+    constexpr size_t entityCount = 1'000'000;
+
+    struct Position {
+        vec3 value;
+    };
+
+    struct Velocity {
+        vec3 value;
+    };
+
+    struct Health {
+        float value;
+    };
+
+    /**
+     * The object graph equivalent of an entity, as a baseline
+     */
+    struct GameObject {
+        Position position;
+        std::unique_ptr<Velocity> velocity;
+        std::unique_ptr<Health> health;
+    };
+} // namespace
+
+/* -------------------------------------------- */
+/*  Entities                                    */
+/* -------------------------------------------- */
+
+TEST_CASE("ECS Entities", "[!benchmark][ECS]") {
+    BENCHMARK_ADVANCED("create 1M entities")(Catch::Benchmark::Chronometer meter) {
+        std::vector<Registry> registries(meter.runs());
+        meter.measure([&](const int run) {
+            for (size_t i = 0; i < entityCount; ++i) {
+                registries[run].create();
+            }
+            return registries[run].size();
+        });
+    };
+
+    BENCHMARK_ADVANCED("create 1M entities with 2 components")(Catch::Benchmark::Chronometer meter) {
+        std::vector<Registry> registries(meter.runs());
+        meter.measure([&](const int run) {
+            for (size_t i = 0; i < entityCount; ++i) {
+                const Entity entity = registries[run].create();
+                registries[run].emplace<Position>(entity);
+                registries[run].emplace<Velocity>(entity);
+            }
+            return registries[run].size();
+        });
+    };
+}
+
+/* -------------------------------------------- */
+/*  Iteration                                   */
+/* -------------------------------------------- */
+
+TEST_CASE("ECS Iteration", "[!benchmark][ECS]") {
+    // Every entity has a position, half have a velocity and a tenth have health
+    Registry registry;
+    std::vector<GameObject> objects(entityCount);
+    Random random;
+    for (size_t i = 0; i < entityCount; ++i) {
+        const Entity entity = registry.create();
+        const vec3 position = random.nextVec3();
+        registry.emplace<Position>(entity, position);
+        objects[i].position.value = position;
+
+        if (i % 2 == 0) {
+            const vec3 velocity = random.nextVec3();
+            registry.emplace<Velocity>(entity, velocity);
+            objects[i].velocity = std::make_unique<Velocity>(velocity);
+        }
+
+        if (i % 10 == 0) {
+            registry.emplace<Health>(entity, 100.f);
+            objects[i].health = std::make_unique<Health>(100.f);
+        }
+    }
+
+    BENCHMARK("view<Position> 1M") {
+        float sum = 0;
+        registry.view<Position>().each([&](const Position& position) { sum += position.value.x; });
+        return sum;
+    };
+
+    BENCHMARK("view<Position, Velocity> 1M") {
+        registry.view<Position, Velocity>().each([](Position& position, const Velocity& velocity) {
+            position.value += velocity.value * 0.016f;
+        });
+        return registry.view<Position>().sizeHint();
+    };
+
+    BENCHMARK("object graph Position, Velocity 1M") {
+        for (GameObject& object : objects) {
+            if (object.velocity) object.position.value += object.velocity->value * 0.016f;
+        }
+        return objects.size();
+    };
+
+    // Driven by the 100k health components rather than the 1M positions
+    BENCHMARK("view<Position, Velocity, Health> 1M") {
+        float sum = 0;
+        registry.view<Position, Velocity, Health>().each(
+                [&](const Position& position, const Velocity& velocity, const Health& health) {
+                    sum += position.value.x * velocity.value.x * health.value;
+                }
+        );
+        return sum;
+    };
+
+    BENCHMARK("object graph Position, Velocity, Health 1M") {
+        float sum = 0;
+        for (const GameObject& object : objects) {
+            if (object.velocity && object.health) {
+                sum += object.position.value.x * object.velocity->value.x * object.health->value;
+            }
+        }
+        return sum;
+    };
+}
+
+/* -------------------------------------------- */
+/*  Groups                                      */
+/* -------------------------------------------- */
+
+TEST_CASE("ECS Groups", "[!benchmark][ECS][Group]") {
+    constexpr size_t groupedCount = 200'000;
+
+    // Interleave entities with and without velocities and health, so the view has to skip over the gaps
+    const auto populate = [](Registry& registry) {
+        Random random;
+        for (size_t i = 0; i < groupedCount * 2; ++i) {
+            const Entity entity = registry.create();
+            registry.emplace<Position>(entity, random.nextVec3());
+            if (i % 2 == 0) {
+                registry.emplace<Velocity>(entity, random.nextVec3());
+                registry.emplace<Health>(entity, 100.f);
+            }
+        }
+    };
+
+    Registry viewRegistry;
+    populate(viewRegistry);
+
+    Registry groupRegistry;
+    populate(groupRegistry);
+    const auto group2 = groupRegistry.group<Position, Velocity>();
+
+    Registry group3Registry;
+    populate(group3Registry);
+    const auto group3 = group3Registry.group<Position, Velocity, Health>();
+
+    BENCHMARK("view<Position, Velocity> 200k") {
+        viewRegistry.view<Position, Velocity>().each([](Position& position, const Velocity& velocity) {
+            position.value += velocity.value * 0.016f;
+        });
+        return viewRegistry.size();
+    };
+
+    BENCHMARK("group<Position, Velocity> 200k") {
+        group2.each([](Position& position, const Velocity& velocity) { position.value += velocity.value * 0.016f; });
+        return group2.size();
+    };
+
+    BENCHMARK("view<Position, Velocity, Health> 200k") {
+        float sum = 0;
+        viewRegistry.view<Position, Velocity, Health>().each(
+                [&](const Position& position, const Velocity& velocity, const Health& health) {
+                    sum += position.value.x * velocity.value.x * health.value;
+                }
+        );
+        return sum;
+    };
+
+    BENCHMARK("group<Position, Velocity, Health> 200k") {
+        float sum = 0;
+        group3.each([&](const Position& position, const Velocity& velocity, const Health& health) {
+            sum += position.value.x * velocity.value.x * health.value;
+        });
+        return sum;
+    };
+}
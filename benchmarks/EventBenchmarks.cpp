@@ -0,0 +1,122 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <functional>
+#include <optional>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+#include <event-bus/EventBus.h>
+#include <event-bus/EventRecorder.h>
+#include <event-bus/EventReplayer.h>
+
+using namespace DatEngine::Events;
+
+namespace {
+    constexpr int listenerCount = 16;
+    constexpr int eventCount = 1000;
+
+    struct CounterEvent : Event {
+        int value = 0;
+    };
+
+    struct OtherEvent : Event {};
+
+    /**
+     * The EventBus as it was before dispatch was typed, as a baseline
+     */
+    class MultimapEventBus {
+        std::unordered_multimap<std::type_index, std::function<void(void*)>> listenerMap;
+
+    public:
+        template<typename TEvent>
+        void addListener(std::function<void(TEvent*)> listenerMethod) {
+            listenerMap.emplace(std::type_index(typeid(TEvent)), [listenerMethod](void* event) {
+                listenerMethod(static_cast<TEvent*>(event));
+            });
+        }
+
+        template<typename TEvent>
+        void callEvent(TEvent* eventData) {
+            auto listeners = listenerMap.equal_range(std::type_index(typeid(TEvent)));
+            for (auto it = listeners.first; it != listeners.second; ++it) {
+                it->second(eventData);
+            }
+        }
+    };
+
+    template<typename TBus>
+    void addListeners(TBus& bus) {
+        for (int i = 0; i < listenerCount; ++i) {
+            bus.template addListener<CounterEvent>([i](CounterEvent* event) { event->value += i; });
+            bus.template addListener<OtherEvent>([](OtherEvent*) {});
+        }
+    }
+} // namespace
+
+TEST_CASE("Event Dispatch", "[!benchmark][Events]") {
+    CounterEvent event;
+
+    MultimapEventBus multimapBus;
+    addListeners(multimapBus);
+
+    EventBus bus;
+    addListeners(bus);
+
+    BENCHMARK("call 1k events with 16 listeners, std::function multimap") {
+        for (int i = 0; i < eventCount; ++i) multimapBus.callEvent(&event);
+        return event.value;
+    };
+
+    BENCHMARK("call 1k events with 16 listeners, EventBus") {
+        for (int i = 0; i < eventCount; ++i) bus.callEvent(&event);
+        return event.value;
+    };
+}
+
+TEST_CASE("Queued Event Dispatch", "[!benchmark][Events]") {
+    EventBus bus;
+    addListeners(bus);
+
+    BENCHMARK("queue and dispatch 1k events with 16 listeners") {
+        for (int i = 0; i < eventCount; ++i) bus.queueEvent(CounterEvent{});
+        bus.dispatchQueuedEvents();
+        return bus.getListenerCount<CounterEvent>();
+    };
+}
+
+TEST_CASE("Listener Churn", "[!benchmark][Events]") {
+    EventBus bus;
+    std::vector<ListenerHandle> handles(10'000);
+
+    BENCHMARK("add then remove 10k listeners across priorities") {
+        for (size_t i = 0; i < handles.size(); ++i) {
+            const auto priority = static_cast<ListenerPriority>(i % listenerPriorityCount);
+            handles[i] = bus.addListener<CounterEvent>([](CounterEvent* event) { ++event->value; }, priority);
+        }
+        for (const ListenerHandle handle : handles) bus.removeListener(handle);
+        return bus.getListenerCount<CounterEvent>();
+    };
+}
+
+TEST_CASE("Event Replay", "[!benchmark][Events]") {
+    // Record a few frames of traffic once, then measure replaying it through the listeners
+    EventRecorder recorder;
+    {
+        EventBus bus;
+        bus.setRecorder(&recorder);
+        for (int frame = 0; frame < 10; ++frame) {
+            for (int i = 0; i < eventCount; ++i) bus.queueEvent(CounterEvent{});
+            bus.tick(0);
+        }
+    }
+
+    EventBus bus;
+    addListeners(bus);
+
+    BENCHMARK("replay 10 frames of 1k events with 16 listeners") {
+        std::optional<EventReplayer> replayer = EventReplayer::fromLog(recorder.getLog());
+        return replayer->replayAll(bus);
+    };
+}
@@ -0,0 +1,138 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include <threading/ThreadManager.h>
+
+using namespace DatEngine::Threading;
+
+namespace {
+    constexpr int parentCount = 64;
+    constexpr int childrenPerParent = 16;
+
+    /** Every mode uses the same number of workers, at least 2 so a blocked parent always leaves one free */
+    const uint32_t workerCount = std::max(std::thread::hardware_concurrency(), 2u);
+
+    /**
+     * A few microseconds of work that the compiler can't optimise away
+     */
+    float busyWork(const int seed) {
+        float value = static_cast<float>(seed);
+        for (int i = 0; i < 2000; ++i) value = std::sqrt(value * value + 1.f);
+        return value;
+    }
+
+    /**
+     * Run parent jobs that each spawn children and wait on them, like asset loads waiting on their dependencies
+     */
+    float runParents(ThreadManager& threads) {
+        std::atomic<float> sum = 0;
+        JobCounter parents;
+        for (int parent = 0; parent < parentCount; ++parent) {
+            threads.submit(
+                    [&threads, &sum, parent] {
+                        JobCounter children;
+                        for (int child = 0; child < childrenPerParent; ++child) {
+                            threads.submit([&sum, parent, child] { sum += busyWork(parent + child); }, &children);
+                        }
+                        threads.wait(children);
+                    },
+                    &parents
+            );
+        }
+        threads.wait(parents);
+        return sum;
+    }
+
+    /**
+     * Run the same parents, but each one blocks its worker's thread on a condition variable until its children finish
+     * <br>
+     * A blocked parent holds its worker, so parents are submitted in waves of one fewer than the number of workers.
+     * That leaves at least one worker to run children, otherwise every worker could block on a parent and deadlock.
+     */
+    float runBlockingParents(ThreadManager& threads) {
+        std::atomic<float> sum = 0;
+        const int wave = static_cast<int>(threads.getWorkerCount()) - 1;
+        for (int first = 0; first < parentCount; first += wave) {
+            JobCounter parents;
+            for (int parent = first; parent < std::min(first + wave, parentCount); ++parent) {
+                threads.submit(
+                        [&threads, &sum, parent] {
+                            std::mutex mutex;
+                            std::condition_variable finished;
+                            int remaining = childrenPerParent;
+                            for (int child = 0; child < childrenPerParent; ++child) {
+                                threads.submit([&, parent, child] {
+                                    sum += busyWork(parent + child);
+                                    // Notify under the lock so the parent can't return and destroy these first
+                                    std::lock_guard lock(mutex);
+                                    if (--remaining == 0) finished.notify_one();
+                                });
+                            }
+
+                            std::unique_lock lock(mutex);
+                            finished.wait(lock, [&remaining] { return remaining == 0; });
+                        },
+                        &parents
+                );
+            }
+            threads.wait(parents);
+        }
+        return sum;
+    }
+} // namespace
+
+TEST_CASE("Job Waits", "[!benchmark][Threading]") {
+    SECTION("Fibers") {
+        ThreadManager threads(workerCount, true);
+        threads.init();
+
+        BENCHMARK("64 parents waiting on 16 children, fibers") { return runParents(threads); };
+    }
+
+    SECTION("Inline") {
+        ThreadManager threads(workerCount, false);
+        threads.init();
+
+        BENCHMARK("64 parents waiting on 16 children, running jobs inline while waiting") {
+            return runParents(threads);
+        };
+    }
+
+    SECTION("Blocking") {
+        ThreadManager threads(workerCount, false);
+        threads.init();
+
+        BENCHMARK("64 parents waiting on 16 children, blocking the worker while waiting") {
+            return runBlockingParents(threads);
+        };
+    }
+}
+
+TEST_CASE("Job Overhead", "[!benchmark][Threading]") {
+    ThreadManager threads(0, true);
+    threads.init();
+
+    BENCHMARK("submit and wait 10k empty jobs") {
+        JobCounter counter;
+        for (int i = 0; i < 10'000; ++i) threads.submit([] {}, &counter);
+        threads.wait(counter);
+        return counter.getPending();
+    };
+
+    BENCHMARK("parallelFor 1M sqrt") {
+        std::atomic<float> sum = 0;
+        threads.parallelFor(1'000'000, [&](const size_t begin, const size_t end) {
+            float local = 0;
+            for (size_t i = begin; i < end; ++i) local += std::sqrt(static_cast<float>(i));
+            sum += local;
+        }, 4096);
+        return sum.load();
+    };
+}
@@ -0,0 +1,110 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <maths/Matrix.h>
+#include <maths/matrix/BatchTransform.h>
+
+#include "BenchmarkData.h"
+
+using namespace DatEngine::DatMaths;
+using namespace DatEngine::Benchmarks;
+
+/* -------------------------------------------- */
+/*  Matrix Operations                           */
+/* -------------------------------------------- */
+
+TEST_CASE("Matrix Operations", "[!benchmark][DatMaths][Matrix]") {
+    Random random;
+    const std::vector<mat4> a = makeBatch<mat4>([&] { return random.nextTransform(); });
+    const std::vector<mat4> b = makeBatch<mat4>([&] { return random.nextTransform(); });
+    const std::vector<vec4> vectors = makeBatch<vec4>([&] { return random.nextVec4(); });
+    std::vector<mat4> out(batchSize);
+    std::vector<vec4> outVectors(batchSize);
+
+    BENCHMARK("mat4 * mat4 x1024") {
+        for (size_t i = 0; i < batchSize; ++i) {
+            out[i] = a[i] * b[i];
+        }
+        return out[0][0];
+    };
+
+    BENCHMARK("mat4 * vec4 x1024") {
+        for (size_t i = 0; i < batchSize; ++i) {
+            outVectors[i] = a[i] * vectors[i];
+        }
+        return outVectors[0];
+    };
+
+    BENCHMARK("mat4 transposed x1024") {
+        for (size_t i = 0; i < batchSize; ++i) {
+            out[i] = a[i].transposed();
+        }
+        return out[0][0];
+    };
+
+    BENCHMARK("mat4 determinant x1024") {
+        float sum = 0;
+        for (size_t i = 0; i < batchSize; ++i) {
+            sum += a[i].determinant();
+        }
+        return sum;
+    };
+
+    BENCHMARK("mat4 inverse x1024") {
+        for (size_t i = 0; i < batchSize; ++i) {
+            out[i] = a[i].inverse();
+        }
+        return out[0][0];
+    };
+}
+
+/* -------------------------------------------- */
+/*  Batch Transforms                            */
+/* -------------------------------------------- */
+
+TEST_CASE("Batch Transforms", "[!benchmark][DatMaths][Matrix][Batch]") {
+    Random random;
+    const mat4 matrix = random.nextTransform();
+    const std::vector<vec3> points = makeBatch<vec3>([&] { return random.nextVec3(); });
+    const std::vector<vec4> vectors = makeBatch<vec4>([&] { return random.nextVec4(); });
+    std::vector<vec3> outPoints(batchSize);
+    std::vector<vec4> outVectors(batchSize);
+
+    // The per element loops the batch kernels replace, as a baseline
+    BENCHMARK("mat4 * vec3 point loop x1024") {
+        for (size_t i = 0; i < batchSize; ++i) {
+            outPoints[i] = vec3(matrix * vec4(points[i], 1));
+        }
+        return outPoints[0];
+    };
+
+    BENCHMARK("transformPoints x1024") {
+        transformPoints(matrix, points, outPoints);
+        return outPoints[0];
+    };
+
+    BENCHMARK("transformDirections x1024") {
+        transformDirections(matrix, points, outPoints);
+        return outPoints[0];
+    };
+
+    BENCHMARK("transform x1024") {
+        transform(matrix, vectors, outVectors);
+        return outVectors[0];
+    };
+
+    // 16 instances of a 64 vertex mesh, giving the same 1024 outputs as the other kernels
+    const std::vector<mat4> instances = makeBatch<mat4>([&] { return random.nextTransform(); }, 16);
+    const std::span<const vec3> meshPoints = std::span(points).first(64);
+    const std::span<const vec4> meshVectors = std::span(vectors).first(64);
+
+    BENCHMARK("transformPointsInstanced 16x64") {
+        transformPointsInstanced(instances, meshPoints, outPoints);
+        return outPoints[0];
+    };
+
+    BENCHMARK("transformInstanced 16x64") {
+        transformInstanced(instances, meshVectors, outVectors);
+        return outVectors[0];
+    };
+}
@@ -0,0 +1,140 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <maths/CommonMaths.h>
+#include <maths/Vector.h>
+#include <maths/vector/VecSoA.h>
+
+#include "BenchmarkData.h"
+
+using namespace DatEngine::DatMaths;
+using namespace DatEngine::Benchmarks;
+
+/* -------------------------------------------- */
+/*  Vector Operations                           */
+/* -------------------------------------------- */
+
+TEST_CASE("Vector Operations", "[!benchmark][DatMaths][Vector]") {
+    Random random;
+    const std::vector<vec3> a3 = makeBatch<vec3>([&] { return random.nextVec3(); });
+    const std::vector<vec3> b3 = makeBatch<vec3>([&] { return random.nextVec3(); });
+    const std::vector<vec4> a4 = makeBatch<vec4>([&] { return random.nextVec4(); });
+    const std::vector<vec4> b4 = makeBatch<vec4>([&] { return random.nextVec4(); });
+    std::vector<vec3> out3(batchSize);
+    std::vector<vec4> out4(batchSize);
+
+    BENCHMARK("vec3 add x1024") {
+        for (size_t i = 0; i < batchSize; ++i) {
+            out3[i] = a3[i] + b3[i];
+        }
+        return out3[0];
+    };
+
+    BENCHMARK("vec4 add x1024") {
+        for (size_t i = 0; i < batchSize; ++i) {
+            out4[i] = a4[i] + b4[i];
+        }
+        return out4[0];
+    };
+
+    BENCHMARK("vec4 scalar multiply x1024") {
+        for (size_t i = 0; i < batchSize; ++i) {
+            out4[i] = a4[i] * 2.f;
+        }
+        return out4[0];
+    };
+
+    BENCHMARK("vec3 dot product x1024") {
+        float sum = 0;
+        for (size_t i = 0; i < batchSize; ++i) {
+            sum += a3[i].dotProduct(b3[i]);
+        }
+        return sum;
+    };
+
+    BENCHMARK("vec4 dot product x1024") {
+        float sum = 0;
+        for (size_t i = 0; i < batchSize; ++i) {
+            sum += a4[i].dotProduct(b4[i]);
+        }
+        return sum;
+    };
+
+    BENCHMARK("vec3 cross product x1024") {
+        for (size_t i = 0; i < batchSize; ++i) {
+            out3[i] = a3[i].crossProduct(b3[i]);
+        }
+        return out3[0];
+    };
+
+    BENCHMARK("vec3 normalised x1024") {
+        for (size_t i = 0; i < batchSize; ++i) {
+            out3[i] = a3[i].normalised();
+        }
+        return out3[0];
+    };
+
+    BENCHMARK("vec4 normalised x1024") {
+        for (size_t i = 0; i < batchSize; ++i) {
+            out4[i] = a4[i].normalised();
+        }
+        return out4[0];
+    };
+
+    BENCHMARK("vec3 lerp x1024") {
+        for (size_t i = 0; i < batchSize; ++i) {
+            out3[i] = lerp(a3[i], b3[i], 0.25f);
+        }
+        return out3[0];
+    };
+
+    BENCHMARK("vec4 lerp x1024") {
+        for (size_t i = 0; i < batchSize; ++i) {
+            out4[i] = lerp(a4[i], b4[i], 0.25f);
+        }
+        return out4[0];
+    };
+}
+
+/* -------------------------------------------- */
+/*  Structure of Arrays                         */
+/* -------------------------------------------- */
+
+TEST_CASE("Vector Structure of Arrays", "[!benchmark][DatMaths][Vector][SoA]") {
+    Random random;
+    const std::vector<vec3> a3 = makeBatch<vec3>([&] { return random.nextVec3(); });
+    const std::vector<vec3> b3 = makeBatch<vec3>([&] { return random.nextVec3(); });
+    const Vec3SoA b(b3);
+    Vec3SoA out(batchSize);
+    std::vector<float> dots(batchSize);
+
+    BENCHMARK("Vec3SoA add x1024") {
+        out.copyFrom(a3);
+        out.add(b);
+        return out.get(0);
+    };
+
+    BENCHMARK("Vec3SoA dot product x1024") {
+        out.copyFrom(a3);
+        out.dotProduct(b, dots);
+        return dots[0];
+    };
+
+    BENCHMARK("Vec3SoA cross product x1024") {
+        const Vec3SoA a(a3);
+        a.crossProduct(b, out);
+        return out.get(0);
+    };
+
+    BENCHMARK("Vec3SoA normalise x1024") {
+        out.copyFrom(a3);
+        out.normalise();
+        return out.get(0);
+    };
+
+    BENCHMARK("Vec3SoA lerp x1024") {
+        out.copyFrom(a3);
+        out.lerp(b, 0.25f);
+        return out.get(0);
+    };
+}
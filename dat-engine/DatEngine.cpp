@@ -2,6 +2,8 @@
 
 #include <DatEngine.h>
 
+#include <algorithm>
+
 #include <SDL3/SDL.h>
 
 #include <util/CVar.h>
@@ -12,6 +14,7 @@ using namespace DatEngine;
 extern CVarInt windowWidthCVar;
 extern CVarInt windowHeightCVar;
 extern CVarEnum<DatGpu::WindowMode> windowModeCVar;
+extern CVarInt bufferedFramesCVar;
 
 Engine* Engine::instance = nullptr;
 
@@ -58,6 +61,20 @@ void Engine::init(DatGpu::IGpu* renderer) {
     instance->gpu = renderer;
 
     renderer->initialise();
+
+    instance->threads.init();
+
+    // Render only waits on its own previous frame, so the next frame's update can run while this frame renders, up
+    // to the number of buffered frames
+    instance->frameGraph = std::make_unique<Threading::FrameGraph>(
+            instance->threads, static_cast<uint32_t>(std::max(bufferedFramesCVar.get(), 1))
+    );
+
+    const Threading::FrameGraph::TaskId update =
+            instance->frameGraph->addTask("Update", [](const Threading::FrameContext&) {});
+    instance->frameGraph->addTask(
+            "Render", [renderer](const Threading::FrameContext&) { renderer->draw(); }, {update}
+    );
 }
 
 void Engine::startLoop() {
@@ -82,14 +99,16 @@ void Engine::startLoop() {
             }
         }
 
-        // Update
+        // Update, Render and UI run on the frame graph, input has to stay on the main thread for SDL
+        frameGraph->beginFrame(deltaTime);
 
-        // Render
-        gpu->draw();
-        // UI
+        // Beginning the frame waited for the oldest frame in flight, so strings replaced before it can be freed
+        CVarSystem::get()->reclaimStrings(frameGraph->getMaxFramesInFlight());
 
         lastTime = now;
     }
+
+    frameGraph->waitForAll();
 }
 
 void Engine::cleanup() {
@@ -98,3 +117,5 @@ void Engine::cleanup() {
 }
 
 SDL_Window* Engine::getWindow() const { return window; }
+
+Threading::ThreadManager& Engine::getThreadManager() { return threads; }
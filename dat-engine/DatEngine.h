@@ -1,9 +1,12 @@
 #pragma once
 
 #include <iostream>
+#include <memory>
 #include <maths/Vector.h>
 
 #include <gpu/IGpu.h>
+#include <threading/FrameGraph.h>
+#include <threading/ThreadManager.h>
 
 struct SDL_Window;
 
@@ -22,6 +25,10 @@ namespace DatEngine {
 
         /** The renderer for the engine */
         DatGpu::IGpu* gpu = nullptr;
+        /** The job system, the main thread is its first worker */
+        Threading::ThreadManager threads;
+        /** The tasks run each frame, destroyed before threads so it can wait for frames in flight */
+        std::unique_ptr<Threading::FrameGraph> frameGraph;
         // Asset Manager
         // Input Manager
         // Audio Engine
@@ -74,5 +81,12 @@ namespace DatEngine {
          * @return The window used by the engine
          */
         [[nodiscard]] SDL_Window* getWindow() const;
+
+        /**
+         * Get the job system used by the engine
+         *
+         * @return The engine's thread manager
+         */
+        [[nodiscard]] Threading::ThreadManager& getThreadManager();
     };
 } // namespace DatEngine
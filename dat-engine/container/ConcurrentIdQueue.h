@@ -0,0 +1,250 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include "IdArray.h"
+
+namespace DatEngine {
+    /**
+     * A thread safe IdQueue, where values can be inserted and removed from any thread without locking
+     * <br>
+     * Values are stored in fixed size chunks that are never moved, so references returned by get() remain valid while
+     * other threads insert. Removed slots are kept on a lock-free Treiber stack whose head is tagged with a counter, so
+     * a slot being popped and pushed back between another thread's load and compare exchange can't corrupt the stack.
+     * <br>
+     * Slot generations are odd while the slot holds a value, so checking a handle is a single atomic load.
+     *
+     * @note Removing a value while another thread is reading it is still a race, the same as for any other container.
+     *
+     * @tparam TValue The type of the values stored in the queue
+     * @tparam TChunkSize The number of slots in each chunk of storage, must be a power of 2
+     * @tparam TMaxChunks The maximum number of chunks, this limits the queue to TChunkSize * TMaxChunks IDs
+     */
+    template<typename TValue, size_t TChunkSize = 1024, size_t TMaxChunks = 4096>
+        requires(std::has_single_bit(TChunkSize))
+    class ConcurrentIdQueue {
+        struct Slot {
+            /** The generation of the slot, odd while the slot holds a value */
+            std::atomic<uint32_t> generation = 0;
+            /** For free slots, the index of the next free slot */
+            std::atomic<uint32_t> nextFree = IdHandle::nullIndex;
+            alignas(TValue) std::byte storage[sizeof(TValue)];
+
+            TValue* value() { return std::launder(reinterpret_cast<TValue*>(storage)); }
+        };
+
+        using Chunk = std::array<Slot, TChunkSize>;
+
+        /** The maximum number of IDs the queue can hand out */
+        static constexpr size_t maxSlots = TChunkSize * TMaxChunks;
+        static_assert(maxSlots < IdHandle::nullIndex, "Slot indices must fit below the null index");
+
+        /** The chunks of storage, allocated as they are needed and only freed when the queue is destroyed */
+        std::array<std::atomic<Chunk*>, TMaxChunks> chunks{};
+        /** The number of slots that have ever been handed out */
+        std::atomic<uint32_t> slotCount = 0;
+        /**
+         * The head of the free slot stack, the index of the first free slot in the low 32 bits and a tag that changes
+         * with every push and pop in the high 32 bits
+         */
+        std::atomic<uint64_t> freeHead = packHead(IdHandle::nullIndex, 0);
+        /** The number of live values */
+        std::atomic<size_t> count = 0;
+
+        static constexpr uint64_t packHead(const uint32_t index, const uint32_t tag) {
+            return static_cast<uint64_t>(tag) << 32 | index;
+        }
+
+        static constexpr uint32_t headIndex(const uint64_t head) { return static_cast<uint32_t>(head); }
+        static constexpr uint32_t headTag(const uint64_t head) { return static_cast<uint32_t>(head >> 32); }
+
+        Slot& getSlot(const uint32_t index) const {
+            return (*chunks[index / TChunkSize].load(std::memory_order_acquire))[index & (TChunkSize - 1)];
+        }
+
+        /**
+         * Make sure the chunk containing a slot is allocated, racing threads allocate their own chunk and all but the
+         * first to publish theirs free it again
+         */
+        void assureChunk(const uint32_t index) {
+            std::atomic<Chunk*>& chunk = chunks[index / TChunkSize];
+            if (chunk.load(std::memory_order_acquire) != nullptr) return;
+
+            auto newChunk = std::make_unique<Chunk>();
+            Chunk* expected = nullptr;
+            if (chunk.compare_exchange_strong(expected, newChunk.get(), std::memory_order_acq_rel)) {
+                newChunk.release();
+            }
+        }
+
+        /**
+         * Pop a free slot off the stack, or hand out a new slot if the stack is empty
+         *
+         * @return The index of the slot, or IdHandle::nullIndex if every slot is in use
+         */
+        uint32_t takeFreeSlot() {
+            uint64_t head = freeHead.load(std::memory_order_acquire);
+            while (headIndex(head) != IdHandle::nullIndex) {
+                // If another thread pops this slot first the tag will have changed and the exchange will fail
+                const uint32_t next = getSlot(headIndex(head)).nextFree.load(std::memory_order_relaxed);
+                if (freeHead.compare_exchange_weak(
+                            head, packHead(next, headTag(head) + 1), std::memory_order_acq_rel,
+                            std::memory_order_acquire
+                    )) {
+                    return headIndex(head);
+                }
+            }
+
+            // Never count past the chunk table, so a full queue can't hand out an index without a chunk
+            uint32_t index = slotCount.load(std::memory_order_relaxed);
+            do {
+                if (index >= maxSlots) return IdHandle::nullIndex;
+            } while (!slotCount.compare_exchange_weak(index, index + 1, std::memory_order_relaxed));
+
+            assureChunk(index);
+            return index;
+        }
+
+        /**
+         * Push a removed slot onto the free stack
+         */
+        void pushFreeSlot(const uint32_t index) {
+            Slot& slot = getSlot(index);
+            uint64_t head = freeHead.load(std::memory_order_relaxed);
+            do {
+                slot.nextFree.store(headIndex(head), std::memory_order_relaxed);
+            } while (!freeHead.compare_exchange_weak(
+                    head, packHead(index, headTag(head) + 1), std::memory_order_release, std::memory_order_relaxed
+            ));
+        }
+
+    public:
+        ConcurrentIdQueue() = default;
+        ConcurrentIdQueue(const ConcurrentIdQueue&) = delete;
+        ConcurrentIdQueue& operator=(const ConcurrentIdQueue&) = delete;
+
+        ~ConcurrentIdQueue() {
+            const uint32_t slots = slotCount.load(std::memory_order_acquire);
+            for (uint32_t index = 0; index < slots; ++index) {
+                Slot& slot = getSlot(index);
+                if (slot.generation.load(std::memory_order_relaxed) & 1) std::destroy_at(slot.value());
+            }
+
+            for (std::atomic<Chunk*>& chunk : chunks) delete chunk.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * Check if an ID refers to a value in the queue
+         *
+         * @param id The id to check
+         * @return true if the value with the given ID hasn't been removed
+         */
+        [[nodiscard]] bool contains(const IdHandle id) const {
+            // Null and removed handles have an even generation, which a live slot never matches
+            if (!(id.generation & 1) || id.index >= maxSlots) return false;
+
+            // The chunk may still be being allocated by the thread that handed out this index
+            const Chunk* chunk = chunks[id.index / TChunkSize].load(std::memory_order_acquire);
+            return chunk != nullptr &&
+                   (*chunk)[id.index & (TChunkSize - 1)].generation.load(std::memory_order_acquire) == id.generation;
+        }
+
+        /**
+         * Get a value from the queue by its ID, the reference remains valid until the value is removed
+         *
+         * @param id The id of the value to get, must refer to a value in the queue
+         * @return The value with the given ID
+         */
+        TValue& get(const IdHandle id) const {
+            assert(contains(id) && "Stale or invalid ConcurrentIdQueue ID");
+            return *getSlot(id.index).value();
+        }
+
+        /**
+         * Get a value from the queue by its ID if it's still in the queue
+         *
+         * @param id The id of the value to get
+         * @return A pointer to the value, or nullptr if the ID is stale or invalid
+         */
+        TValue* tryGet(const IdHandle id) const { return contains(id) ? getSlot(id.index).value() : nullptr; }
+
+        //   Brackets
+        TValue& operator[](const IdHandle id) const { return get(id); }
+
+        /**
+         * Insert a value into the queue
+         *
+         * @param value The value to insert
+         * @return The ID of the inserted value for retrieval, or the null handle if the queue is full
+         */
+        IdHandle pushBack(TValue value) { return emplaceBack(std::move(value)); }
+
+        /**
+         * Emplace a value in the queue
+         *
+         * @tparam Args The types of the arguments to pass to the value constructor
+         * @param args The arguments to pass to the value constructor
+         * @return The ID of the emplaced value, or the null handle if the queue is full, in which case nothing is
+         *         constructed
+         */
+        template<typename... Args>
+        IdHandle emplaceBack(Args&&... args) {
+            const uint32_t index = takeFreeSlot();
+            if (index == IdHandle::nullIndex) return {};
+            Slot& slot = getSlot(index);
+            try {
+                std::construct_at(slot.value(), std::forward<Args>(args)...);
+            } catch (...) {
+                // The generation is still even, so the slot can go straight back on the free stack
+                pushFreeSlot(index);
+                throw;
+            }
+
+            // The slot belongs to this thread until the new generation is published
+            const uint32_t generation = slot.generation.load(std::memory_order_relaxed) + 1;
+            slot.generation.store(generation, std::memory_order_release);
+
+            count.fetch_add(1, std::memory_order_relaxed);
+            return {index, generation};
+        }
+
+        /**
+         * Remove a value from the queue
+         * <br>
+         * Stale IDs are rejected, and if several threads remove the same ID only one of them succeeds.
+         *
+         * @param id The id of the value to remove
+         * @return true if the value was removed, false if the ID was stale or invalid
+         */
+        bool remove(const IdHandle id) {
+            if (!contains(id)) return false;
+
+            Slot& slot = getSlot(id.index);
+            uint32_t expected = id.generation;
+            if (!slot.generation.compare_exchange_strong(expected, id.generation + 1, std::memory_order_acq_rel)) {
+                return false;
+            }
+
+            std::destroy_at(slot.value());
+            pushFreeSlot(id.index);
+
+            count.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        /**
+         * Get the number of values in the queue, this is only a snapshot while other threads are inserting or removing
+         *
+         * @return The number of values
+         */
+        [[nodiscard]] size_t size() const { return count.load(std::memory_order_relaxed); }
+    };
+} // namespace DatEngine
@@ -1,62 +1,249 @@
 #pragma once
 
 #include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace DatEngine {
+    /**
+     * A handle to a value in an IdQueue, the index of the value's slot and the generation of the slot when the value
+     * was inserted
+     * <br>
+     * A slot's generation is bumped whenever its value is removed, so handles to removed values are rejected in O(1)
+     * even once the slot has been reused.
+     */
+    struct IdHandle {
+        /** The index of handles that don't refer to a value */
+        static constexpr uint32_t nullIndex = std::numeric_limits<uint32_t>::max();
+
+        uint32_t index = nullIndex;
+        uint32_t generation = 0;
+
+        /**
+         * Check if this is the null handle, note that a non-null handle may still refer to a removed value
+         *
+         * @return true if this is the null handle
+         */
+        [[nodiscard]] constexpr bool isNull() const { return index == nullIndex; }
+
+        constexpr bool operator==(const IdHandle& other) const = default;
+    };
+
     /**
      * A list structure that provides ID values for inserted objects that are guaranteed to remain valid until the item is
      * removed. Arbitrary removals are allowed, where gaps are tracked and filled in with new insertions.
+     * <br>
+     * IDs are generational handles, so using the ID of a removed value is detected rather than silently returning
+     * whatever has reused its slot.
+     *
+     * @note References to values are invalidated by inserting, as the backing storage may grow.
      *
      * @tparam TValue The type of the values stored in the IdArray
      */
     template<typename TValue>
     class IdQueue {
+        /** The number of slots covered by each word of the occupancy bitset */
+        static constexpr size_t wordBits = 64;
+
         /**
-         * The type of the value stored in the backing vector
-         *
-         * This is a union to allow storing an index that, for removed items, points to the next available index after this
-         * one.
+         * The bookkeeping for a slot, the value itself lives in the values buffer at the same index
          */
-        using TValue = union {
-            size_t nextIndex{};
-            TValue value;
+        struct Slot {
+            /** The generation of the slot, bumped whenever the value is removed */
+            uint32_t generation = 0;
+            /** For free slots, the index of the next free slot */
+            uint32_t nextFree = IdHandle::nullIndex;
         };
 
-        /** The next available ID in the list */
-        size_t nextId = 0;
-        /** The backing vector storing the values */
-        std::vector<TValue> values;
+        /** The bookkeeping for every slot, live or free */
+        std::vector<Slot> slots;
+        /** One bit per slot, set if the slot holds a live value */
+        std::vector<uint64_t> occupancy;
+        /** Uninitialised storage for slots.size() values, only the occupied slots are constructed */
+        TValue* values = nullptr;
+        /** The number of values the values buffer has room for */
+        size_t capacity = 0;
+        /** The first free slot, the free slots form a chain through Slot::nextFree */
+        uint32_t firstFree = IdHandle::nullIndex;
+        /** The number of live values */
+        size_t count = 0;
+        /**
+         * The generation new slots start at, raised by pack() above the generation of any slot it removes so handles to
+         * removed slots stay invalid if the slot is recreated
+         */
+        uint32_t generationFloor = 0;
+
+        [[nodiscard]] bool isOccupied(const size_t index) const {
+            return occupancy[index / wordBits] >> (index % wordBits) & 1;
+        }
+
+        void setOccupied(const size_t index) { occupancy[index / wordBits] |= uint64_t{1} << (index % wordBits); }
+        void clearOccupied(const size_t index) { occupancy[index / wordBits] &= ~(uint64_t{1} << (index % wordBits)); }
 
         /**
-         * Handle inserting a value into the next available slot when it is into a removed value
+         * Call a function with the index of every occupied slot in ascending order, skipping empty words of the
+         * occupancy bitset entirely
+         */
+        template<typename TFunction>
+        void eachIndex(TFunction&& function) const {
+            for (size_t word = 0; word < occupancy.size(); ++word) {
+                uint64_t bits = occupancy[word];
+                while (bits != 0) {
+                    function(word * wordBits + std::countr_zero(bits));
+                    // Clear the lowest set bit
+                    bits &= bits - 1;
+                }
+            }
+        }
+
+        /**
+         * Move the live values into a new buffer with room for newCapacity values
+         */
+        void reallocate(const size_t newCapacity) {
+            adoptBuffer(newCapacity > 0 ? std::allocator<TValue>().allocate(newCapacity) : nullptr, newCapacity);
+        }
+
+        /**
+         * Move the live values into a buffer allocated with room for newCapacity values, and take ownership of it
+         */
+        void adoptBuffer(TValue* newValues, const size_t newCapacity) {
+            eachIndex([&](const size_t index) {
+                std::construct_at(newValues + index, std::move(values[index]));
+                std::destroy_at(values + index);
+            });
+
+            if (values != nullptr) std::allocator<TValue>().deallocate(values, capacity);
+            values = newValues;
+            capacity = newCapacity;
+        }
+
+        /**
+         * Destroy every live value and release the values buffer
+         */
+        void release() {
+            eachIndex([&](const size_t index) { std::destroy_at(values + index); });
+            if (values != nullptr) std::allocator<TValue>().deallocate(values, capacity);
+            values = nullptr;
+            capacity = 0;
+        }
+
+        /**
+         * Construct a value in a new slot at the end, growing the values buffer if it's full
+         * <br>
+         * The value is constructed before the old values are moved out, so arguments referring to existing values stay
+         * valid, and nothing is committed until it has been constructed.
          *
-         * @param value The value to insert
-         * @return The index of the inserted value
+         * @return The index of the new slot
          */
-        size_t handleInnerInsert(TValue value) {
-            size_t id = nextId;
-            nextId = values.at(id).nextIndex;
+        template<typename... Args>
+        uint32_t constructInNewSlot(Args&&... args) {
+            assert(slots.size() < IdHandle::nullIndex && "Ran out of IdQueue indices");
+            const auto index = static_cast<uint32_t>(slots.size());
 
-            values[id] = value;
-            return id;
+            if (index == capacity) {
+                const size_t newCapacity = std::max<size_t>(capacity * 2, wordBits);
+                TValue* newValues = std::allocator<TValue>().allocate(newCapacity);
+                try {
+                    std::construct_at(newValues + index, std::forward<Args>(args)...);
+                } catch (...) {
+                    std::allocator<TValue>().deallocate(newValues, newCapacity);
+                    throw;
+                }
+                adoptBuffer(newValues, newCapacity);
+            } else {
+                std::construct_at(values + index, std::forward<Args>(args)...);
+            }
+
+            try {
+                slots.push_back(Slot{generationFloor});
+                if (slots.size() > occupancy.size() * wordBits) occupancy.push_back(0);
+            } catch (...) {
+                if (slots.size() > index) slots.pop_back();
+                std::destroy_at(values + index);
+                throw;
+            }
+            return index;
         }
 
     public:
         IdQueue() = default;
-        IdQueue(const IdQueue& other) = default;
-        IdQueue(IdQueue&& other) = default;
+
+        IdQueue(const IdQueue& other) :
+            slots(other.slots), occupancy(other.occupancy), capacity(other.slots.size()), firstFree(other.firstFree),
+            count(other.count), generationFloor(other.generationFloor) {
+            if (capacity > 0) values = std::allocator<TValue>().allocate(capacity);
+            eachIndex([&](const size_t index) { std::construct_at(values + index, other.values[index]); });
+        }
+
+        IdQueue(IdQueue&& other) noexcept :
+            slots(std::move(other.slots)), occupancy(std::move(other.occupancy)),
+            values(std::exchange(other.values, nullptr)), capacity(std::exchange(other.capacity, 0)),
+            firstFree(std::exchange(other.firstFree, IdHandle::nullIndex)), count(std::exchange(other.count, 0)),
+            generationFloor(other.generationFloor) {
+            other.slots.clear();
+            other.occupancy.clear();
+        }
+
+        IdQueue& operator=(IdQueue other) noexcept {
+            std::swap(slots, other.slots);
+            std::swap(occupancy, other.occupancy);
+            std::swap(values, other.values);
+            std::swap(capacity, other.capacity);
+            std::swap(firstFree, other.firstFree);
+            std::swap(count, other.count);
+            std::swap(generationFloor, other.generationFloor);
+            return *this;
+        }
+
+        ~IdQueue() { release(); }
+
+        /**
+         * Check if an ID refers to a value in the IdQueue
+         *
+         * @param id The id to check
+         * @return true if the value with the given ID hasn't been removed
+         */
+        [[nodiscard]] bool contains(const IdHandle id) const {
+            return id.index < slots.size() && slots[id.index].generation == id.generation && isOccupied(id.index);
+        }
 
         /**
          * Get a value from the IdQueue by its ID
          *
-         * @param id The id of the value to get
+         * @param id The id of the value to get, must refer to a value in the IdQueue
          * @return The value with the given ID
          */
-        TValue& get(size_t id) const { return values.at(id).value; }
+        TValue& get(const IdHandle id) {
+            assert(contains(id) && "Stale or invalid IdQueue ID");
+            return values[id.index];
+        }
+
+        /** @copydoc get(IdHandle) */
+        const TValue& get(const IdHandle id) const {
+            assert(contains(id) && "Stale or invalid IdQueue ID");
+            return values[id.index];
+        }
+
+        /**
+         * Get a value from the IdQueue by its ID if it's still in the IdQueue
+         *
+         * @param id The id of the value to get
+         * @return A pointer to the value, or nullptr if the ID is stale or invalid
+         */
+        TValue* tryGet(const IdHandle id) { return contains(id) ? &values[id.index] : nullptr; }
+
+        /** @copydoc tryGet(IdHandle) */
+        const TValue* tryGet(const IdHandle id) const { return contains(id) ? &values[id.index] : nullptr; }
 
         //   Brackets
-        TValue& operator[](size_t id) const { return values.at(id).value; }
+        TValue& operator[](const IdHandle id) { return get(id); }
+        const TValue& operator[](const IdHandle id) const { return get(id); }
 
         /**
          * Insert a value into the IdQueue
@@ -64,13 +251,7 @@ namespace DatEngine {
          * @param value The value to insert
          * @return The ID of the inserted value for retrieval
          */
-        size_t pushBack(TValue value) {
-            if (nextId < values.size())
-                return handleInnerInsert(value);
-
-            values.push_back(value);
-            return nextId++;
-        }
+        IdHandle pushBack(TValue value) { return emplaceBack(std::move(value)); }
 
         /**
          * Emplace a value in the IDQueue
@@ -80,25 +261,84 @@ namespace DatEngine {
          * @return The ID of the emplaced value
          */
         template<typename... Args>
-        size_t emplaceBack(Args&&... args) {
-            if (nextId < values.size())
-                return handleInnerInsert(TValue(std::forward<Args>(args)...));
+        IdHandle emplaceBack(Args&&... args) {
+            uint32_t index;
+            if (firstFree != IdHandle::nullIndex) {
+                // Only unlink the free slot once the value is constructed, so a throwing constructor doesn't lose it
+                index = firstFree;
+                std::construct_at(values + index, std::forward<Args>(args)...);
+                firstFree = slots[index].nextFree;
+            } else {
+                index = constructInNewSlot(std::forward<Args>(args)...);
+            }
+            setOccupied(index);
 
-            values.emplace_back(std::forward<Args>(args)...);
-            return nextId++;
+            ++count;
+            return {index, slots[index].generation};
         }
 
         /**
          * Remove a value from the IdQueue
-         *
-         * This does not check if the id is present, therefore carelessness can lead to values removed multiple times and
-         * circular dependencies in the nextId chain.
+         * <br>
+         * Stale IDs are rejected, so removing a value twice is safe.
          *
          * @param id The id of the value to remove
+         * @return true if the value was removed, false if the ID was stale or invalid
+         */
+        bool remove(const IdHandle id) {
+            if (!contains(id)) return false;
+
+            Slot& slot = slots[id.index];
+            std::destroy_at(values + id.index);
+            clearOccupied(id.index);
+            ++slot.generation;
+            slot.nextFree = firstFree;
+            firstFree = id.index;
+
+            --count;
+            return true;
+        }
+
+        /**
+         * Get the number of values in the IdQueue
+         *
+         * @return The number of values
+         */
+        [[nodiscard]] size_t size() const { return count; }
+
+        /**
+         * Call a function for every value in the IdQueue, in ID order
+         * <br>
+         * Free slots are skipped 64 at a time using the occupancy bitset, so sweeping a sparsely filled IdQueue only
+         * costs a word test per 64 free slots.
+         *
+         * @note Values must not be inserted or removed during iteration
+         *
+         * @tparam TFunction The type of the function, invoked with @code (IdHandle, TValue&)@endcode or
+         *                   @code (TValue&)@endcode
+         * @param function The function to call for each value
          */
-        void remove(size_t id) {
-            values[id] = nextId;
-            nextId = id;
+        template<typename TFunction>
+        void each(TFunction function) {
+            eachIndex([&](const size_t index) {
+                if constexpr (std::is_invocable_v<TFunction&, IdHandle, TValue&>) {
+                    function(IdHandle{static_cast<uint32_t>(index), slots[index].generation}, values[index]);
+                } else {
+                    function(values[index]);
+                }
+            });
+        }
+
+        /** @copydoc each(TFunction) */
+        template<typename TFunction>
+        void each(TFunction function) const {
+            eachIndex([&](const size_t index) {
+                if constexpr (std::is_invocable_v<TFunction&, IdHandle, const TValue&>) {
+                    function(IdHandle{static_cast<uint32_t>(index), slots[index].generation}, values[index]);
+                } else {
+                    function(values[index]);
+                }
+            });
         }
 
         /**
@@ -108,33 +348,43 @@ namespace DatEngine {
          * chops unused IDs off the end of the array.
          */
         void pack() {
-            // Convert chain of nextIds into list
-            std::vector<size_t> indices;
-            size_t id = nextId;
-            while (id != values.size()) {
-                indices.push_back(id);
-                id = values.at(id).nextIndex;
+            // Find the last occupied slot by scanning the bitset backwards a word at a time
+            size_t newSize = 0;
+            for (size_t word = occupancy.size(); word-- > 0;) {
+                if (occupancy[word] != 0) {
+                    newSize = word * wordBits + wordBits - std::countl_zero(occupancy[word]);
+                    break;
+                }
             }
 
-            // Sort bigger to smaller
-            std::ranges::sort(indices, std::ranges::greater());
+            for (size_t index = newSize; index < slots.size(); ++index) {
+                generationFloor = std::max(generationFloor, slots[index].generation);
+            }
+            slots.resize(newSize);
+            occupancy.resize((newSize + wordBits - 1) / wordBits);
 
-            // Find the minimum size the nextId can be by iterating through the sorted indices until there is a gap between
-            // indices that is greater than 1 (I.e, a jump over currently used indices)
-            size_t maxIndex = indices.front();
-            while (maxIndex < indices.size() - 1 && indices[maxIndex] == indices[maxIndex + 1] + 1)
-                ++maxIndex;
-            values.resize(indices[maxIndex]);
+            // Relink the free chain without the removed slots, keeping the lower indices at the front
+            firstFree = IdHandle::nullIndex;
+            for (size_t word = occupancy.size(); word-- > 0;) {
+                uint64_t freeBits = ~occupancy[word];
+                if (word == occupancy.size() - 1 && newSize % wordBits != 0) {
+                    freeBits &= (uint64_t{1} << (newSize % wordBits)) - 1;
+                }
 
-            // Adjust nextId chain. This works because the indices list is sorted and will have the side effect of sorting
-            // the next chain
-            for (int i = maxIndex + 1; i < indices.size(); ++i) {
-                values[indices[i]] = indices[i - 1];
+                while (freeBits != 0) {
+                    // Take the highest free slot first so the lowest ends up at the front of the chain
+                    const auto index =
+                            static_cast<uint32_t>(word * wordBits + wordBits - 1 - std::countl_zero(freeBits));
+                    slots[index].nextFree = firstFree;
+                    firstFree = index;
+                    freeBits &= ~(uint64_t{1} << (index % wordBits));
+                }
             }
-            nextId = indices.back();
 
-            // Attempt to shrink the vector to the new size
-            values.shrink_to_fit();
+            // Attempt to shrink the storage to the new size
+            if (capacity > newSize) reallocate(newSize);
+            slots.shrink_to_fit();
+            occupancy.shrink_to_fit();
         }
     };
-}
+} // namespace DatEngine
@@ -4,106 +4,341 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
 #include <cstdint>
+#include <functional>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include <util/TypeTraits.h>
 namespace DatEngine {
     /**
      * An integer key map implementation that uses a Sparse Set to pack entries
+     * <br>
+     * The sparse array is split into fixed size pages that are only allocated once a key in their range is inserted, so
+     * memory scales with the number of live keys rather than the largest key. Missing pages all point at a shared page
+     * of null indices, so lookups never need to check whether a page exists.
      *
      * @tparam TValue The type of the value stored in the sparse set
      * @tparam TKey The type of the key, must be an integral type
+     * @tparam TPageSize The number of keys covered by each page of the sparse array, must be a power of 2
      */
-    template<typename TValue, TypeTraits::CUIntegral TKey = uint32_t>
+    template<typename TValue, TypeTraits::CUIntegral TKey = uint32_t, size_t TPageSize = 4096>
+        requires(std::has_single_bit(TPageSize))
     struct SparseMap {
         using TSparse = TKey;
         using TDense = std::pair<TKey, TValue>;
+        using TPage = std::array<TSparse, TPageSize>;
+
+        /** The sparse index of keys that aren't in the map */
+        static constexpr TSparse nullIndex = std::numeric_limits<TSparse>::max();
+        /** The number of keys covered by each page of the sparse array */
+        static constexpr size_t pageSize = TPageSize;
 
     protected:
-        std::vector<TSparse> sparse;
+        /**
+         * The page every missing page points at, this is never written to
+         */
+        static constexpr TPage nullPage = [] {
+            TPage page{};
+            page.fill(nullIndex);
+            return page;
+        }();
+
+        std::vector<TSparse*> pages;
         std::vector<TDense> dense;
 
+        static TSparse* nullPagePointer() { return const_cast<TSparse*>(nullPage.data()); }
+
+        /**
+         * Get the sparse index of a key, returning nullIndex if its page hasn't been allocated
+         */
+        TSparse getSparse(const TKey key) const {
+            const size_t page = key / TPageSize;
+            return page < pages.size() ? pages[page][key & (TPageSize - 1)] : nullIndex;
+        }
+
+        /**
+         * Get a reference to the sparse index of a key, allocating its page if needed
+         */
+        TSparse& assureSparse(const TKey key) {
+            const size_t page = key / TPageSize;
+            if (page >= pages.size()) pages.resize(page + 1, nullPagePointer());
+
+            if (pages[page] == nullPagePointer()) {
+                pages[page] = new TSparse[TPageSize];
+                std::copy(nullPage.begin(), nullPage.end(), pages[page]);
+            }
+
+            return pages[page][key & (TPageSize - 1)];
+        }
+
+        void releasePages() {
+            for (TSparse* page : pages) {
+                if (page != nullPagePointer()) delete[] page;
+            }
+            pages.clear();
+        }
+
     public:
-        void insert(const TKey key, const TValue value) {
-            if (sparse.size() < key)
-                sparse.resize(key + 1);
-            sparse[key] = size();
-            dense.push_back(std::make_pair(std::move(key), std::move(value)));
+        SparseMap() = default;
+
+        SparseMap(const SparseMap& other) : dense(other.dense) {
+            pages.reserve(other.pages.size());
+            for (const TSparse* page : other.pages) {
+                if (page == nullPagePointer()) {
+                    pages.push_back(nullPagePointer());
+                    continue;
+                }
+
+                pages.push_back(new TSparse[TPageSize]);
+                std::copy(page, page + TPageSize, pages.back());
+            }
+        }
+
+        SparseMap(SparseMap&& other) noexcept : pages(std::move(other.pages)), dense(std::move(other.dense)) {
+            other.pages.clear();
         }
 
+        SparseMap& operator=(SparseMap other) noexcept {
+            std::swap(pages, other.pages);
+            std::swap(dense, other.dense);
+            return *this;
+        }
+
+        ~SparseMap() { releasePages(); }
+
+        /**
+         * Insert a value into the map
+         *
+         * @param key The key to insert the value at, must not already be in the map
+         * @param value The value to insert
+         */
+        void insert(const TKey key, TValue value) {
+            assert(!contains(key));
+
+            assureSparse(key) = static_cast<TSparse>(dense.size());
+            dense.emplace_back(key, std::move(value));
+        }
+
+        /**
+         * Construct a value in place in the map
+         *
+         * @tparam Args The types of the arguments to pass to the value constructor
+         * @param key The key to insert the value at, must not already be in the map
+         * @param args The arguments to pass to the value constructor
+         */
         template<typename... Args>
         void emplace(const TKey key, Args&&... args) {
-            if (sparse.size() < key)
-                sparse.resize(key + 1);
-            sparse[key] = size();
-            dense.emplace_back(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(args...));
+            assert(!contains(key));
+
+            assureSparse(key) = static_cast<TSparse>(dense.size());
+            dense.emplace_back(
+                    std::piecewise_construct,
+                    std::forward_as_tuple(key),
+                    std::forward_as_tuple(std::forward<Args>(args)...)
+            );
         }
 
-        // remove
+        /**
+         * Remove a value from the map, moving the last value into its place
+         *
+         * @param key The key to remove, must be in the map
+         */
         void remove(const TKey key) {
-            assert(key < sparse.size());
+            assert(contains(key));
 
-            // Special case
-            if (size() == 1) {
-                dense.pop_back();
-                return;
-            }
+            TSparse& sparseIndex = assureSparse(key);
+            const TSparse index = sparseIndex;
+            sparseIndex = nullIndex;
 
-            TDense& value = dense[key];
-            value = std::move(dense.back());
-            sparse[value.first] = key;
+            if (index != dense.size() - 1) {
+                dense[index] = std::move(dense.back());
+                assureSparse(dense[index].first) = index;
+            }
 
             dense.pop_back();
         }
 
-        void swap(const TKey key1, const TKey key2) {
-            assert(key1 < sparse.size());
-            assert(key2 < sparse.size());
+        /**
+         * Reserve room for a number of values and a range of keys, so inserting them doesn't need to grow either array
+         *
+         * @note Sparse pages are still only allocated when a key in their range is inserted
+         *
+         * @param maxKey The largest key that will be inserted
+         * @param count The total number of values the map should have room for
+         */
+        void reserve(const TKey maxKey, const size_t count) {
+            const size_t pageCount = maxKey / TPageSize + 1;
+            if (pageCount > pages.size()) pages.resize(pageCount, nullPagePointer());
 
-            TKey& sparseKey1 = sparse[key1];
-            TKey& sparseKey2 = sparse[key2];
-            TDense& value1 = dense[sparseKey1];
-            TDense& value2 = dense[sparseKey2];
+            dense.reserve(count);
+        }
 
-            TKey tempSparse = std::move(sparseKey1);
-            TDense tempDense = std::move(value1);
+        /**
+         * Insert a batch of values into the map, growing the dense array and page table at most once
+         *
+         * @param keys The keys to insert the values at, must not already be in the map and must be unique
+         * @param values The values to insert, one for each key
+         */
+        void insertBatch(const std::span<const TKey> keys, const std::span<const TValue> values) {
+            assert(keys.size() == values.size());
+            if (keys.empty()) return;
 
-            sparseKey1 = std::move(sparseKey2);
-            sparseKey2 = std::move(tempSparse);
+            reserve(*std::ranges::max_element(keys), dense.size() + keys.size());
+            for (size_t i = 0; i < keys.size(); ++i) {
+                assert(!contains(keys[i]));
 
-            value1 = std::move(value2);
-            value2 = std::move(tempDense);
+                assureSparse(keys[i]) = static_cast<TSparse>(dense.size());
+                dense.emplace_back(keys[i], values[i]);
+            }
         }
 
-        // contains
-        bool contains(const TKey key) { return key < sparse.size() && dense.at(sparse.at(key)).first == key; }
+        /**
+         * Remove a batch of values from the map, each removal moves the last value into its place
+         *
+         * @param keys The keys to remove, must be in the map and must be unique
+         */
+        void removeBatch(const std::span<const TKey> keys) {
+            for (const TKey key : keys) {
+                remove(key);
+            }
+        }
+
+        /**
+         * Sort the dense array in place, keeping the sparse indices pointing at the moved values
+         *
+         * @tparam TCompare The type of the comparator
+         * @param compare A comparator taking two @code const std::pair<TKey, TValue>&@endcode, defaults to ordering
+         *                by key
+         */
+        template<typename TCompare = std::less<>>
+        void sort(TCompare compare = {}) {
+            if constexpr (std::is_same_v<TCompare, std::less<>>) {
+                std::ranges::sort(dense, compare, &TDense::first);
+            } else {
+                std::ranges::sort(dense, compare);
+            }
+
+            for (size_t i = 0; i < dense.size(); ++i) {
+                assureSparse(dense[i].first) = static_cast<TSparse>(i);
+            }
+        }
+
+        /**
+         * Swap the positions of two values in the dense array
+         *
+         * @param key1 The key of the first value, must be in the map
+         * @param key2 The key of the second value, must be in the map
+         */
+        void swap(const TKey key1, const TKey key2) {
+            assert(contains(key1));
+            assert(contains(key2));
+            if (key1 == key2) return;
+
+            TSparse& sparseIndex1 = assureSparse(key1);
+            TSparse& sparseIndex2 = assureSparse(key2);
 
-        // get
-        TValue* get(TKey key) {
-            if (key > sparse.size())
-                return nullptr;
+            std::swap(dense[sparseIndex1], dense[sparseIndex2]);
+            std::swap(sparseIndex1, sparseIndex2);
+        }
 
-            auto& pair = dense.at(sparse.at(key));
+        /**
+         * Check if the map contains a key
+         *
+         * @param key The key to check for
+         * @return true if the key is in the map
+         */
+        bool contains(const TKey key) const {
+            const TSparse index = getSparse(key);
+            return index < dense.size() && dense[index].first == key;
+        }
 
-            return pair.first == key ? &pair.second : nullptr;
+        /**
+         * Get the value for a key
+         *
+         * @param key The key to get the value of
+         * @return A pointer to the value, or nullptr if the key isn't in the map
+         */
+        TValue* get(const TKey key) {
+            const TSparse index = getSparse(key);
+            return index < dense.size() && dense[index].first == key ? &dense[index].second : nullptr;
         }
 
-        // Size
-        TKey size() { return dense.size(); }
+        /** @copydoc get(TKey) */
+        const TValue* get(const TKey key) const { return const_cast<SparseMap*>(this)->get(key); }
+
+        /**
+         * Get the position of a key's value in the dense array
+         *
+         * @param key The key to get the position of
+         * @return The position of the value, or nullIndex if the key isn't in the map
+         */
+        TSparse indexOf(const TKey key) const { return contains(key) ? getSparse(key) : nullIndex; }
+
+        /**
+         * Get the dense array of key value pairs, in iteration order
+         *
+         * @return A pointer to the first key value pair
+         */
+        TDense* data() { return dense.data(); }
 
-        // clear
+        /** @copydoc data() */
+        const TDense* data() const { return dense.data(); }
+
+        /**
+         * Get the number of values in the map
+         */
+        TKey size() const { return static_cast<TKey>(dense.size()); }
+
+        /**
+         * Get the number of sparse pages that are allocated
+         * <br>
+         * This includes pages that have been emptied by removals, use shrinkToFit() to release them.
+         */
+        size_t allocatedPageCount() const {
+            return std::ranges::count_if(pages, [](const TSparse* page) { return page != nullPagePointer(); });
+        }
+
+        /**
+         * Remove every value from the map
+         *
+         * @note The sparse pages are kept for reuse, call shrinkToFit() afterwards to release them
+         */
         void clear() {
             // We only need to clear dense, this invalidates sparse
             dense.clear();
         }
 
+        /**
+         * Release any sparse pages that no longer hold a key, and any spare capacity in the dense array
+         */
+        void shrinkToFit() {
+            // Rebuilding the pages from the dense array also drops any stale indices left behind by clear()
+            releasePages();
+            for (size_t i = 0; i < dense.size(); ++i) {
+                assureSparse(dense[i].first) = static_cast<TSparse>(i);
+            }
+
+            pages.shrink_to_fit();
+            dense.shrink_to_fit();
+        }
+
         // iterator methods
         auto begin() { return dense.begin(); }
         auto end() { return dense.end(); }
 
-        auto cbegin() { return dense.cbegin(); }
-        auto cend() { return dense.cend(); }
+        auto begin() const { return dense.begin(); }
+        auto end() const { return dense.end(); }
+
+        auto cbegin() const { return dense.cbegin(); }
+        auto cend() const { return dense.cend(); }
 
         auto rbegin() { return dense.rbegin(); }
         auto rend() { return dense.rend(); }
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include <container/SparseMap.h>
+
+namespace DatEngine::ECS::detail {
+    struct GroupData;
+
+    /**
+     * Type erased access to a component pool, used when the component type isn't known, like when destroying an entity
+     */
+    struct IComponentPool {
+        /** The group that owns this pool, if any */
+        GroupData* group = nullptr;
+
+        virtual ~IComponentPool() = default;
+
+        /**
+         * Check if the entity with the given index has a component in this pool
+         */
+        [[nodiscard]] virtual bool contains(uint32_t index) const = 0;
+
+        /**
+         * Remove the component of the entity with the given index, if it has one
+         */
+        virtual void remove(uint32_t index) = 0;
+
+        /**
+         * Remove every component in the pool
+         */
+        virtual void clear() = 0;
+
+        /**
+         * Get the position of an entity's component in the pool
+         *
+         * @return The position of the component, or SparseMap::nullIndex if the entity doesn't have one
+         */
+        [[nodiscard]] virtual uint32_t indexOf(uint32_t index) const = 0;
+
+        /**
+         * Swap an entity's component with the component at a position in the pool
+         */
+        virtual void moveTo(uint32_t index, uint32_t position) = 0;
+    };
+
+    /**
+     * A pool of components of a single type, keyed by entity index
+     *
+     * @tparam TComponent The type of the component stored in the pool
+     */
+    template<typename TComponent>
+    struct ComponentPool final : IComponentPool {
+        SparseMap<TComponent> components;
+
+        [[nodiscard]] bool contains(const uint32_t index) const override { return components.contains(index); }
+
+        void remove(const uint32_t index) override {
+            if (components.contains(index)) components.remove(index);
+        }
+
+        void clear() override { components.clear(); }
+
+        [[nodiscard]] uint32_t indexOf(const uint32_t index) const override { return components.indexOf(index); }
+
+        void moveTo(const uint32_t index, const uint32_t position) override {
+            components.swap(index, components.data()[position].first);
+        }
+    };
+
+    /**
+     * The state of an owning group, the entities that have every component in the group are packed at the front of each
+     * owned pool, in the same order
+     */
+    struct GroupData {
+        /** The pools owned by the group */
+        std::vector<IComponentPool*> pools;
+        /** The number of entities in the group, the length of the packed section at the front of each pool */
+        uint32_t size = 0;
+
+        /**
+         * Check if an entity is in the group
+         */
+        [[nodiscard]] bool contains(const uint32_t index) const {
+            // A missing component gives nullIndex, which is never less than the size
+            return pools.front()->indexOf(index) < size;
+        }
+
+        /**
+         * Add an entity to the group if it has every owned component, called after a component is added
+         */
+        void tryAdd(const uint32_t index) {
+            if (contains(index)) return;
+            for (const IComponentPool* pool : pools) {
+                if (!pool->contains(index)) return;
+            }
+
+            for (IComponentPool* pool : pools) {
+                pool->moveTo(index, size);
+            }
+            ++size;
+        }
+
+        /**
+         * Remove an entity from the group if it's in it, called before an owned component is removed
+         */
+        void tryRemove(const uint32_t index) {
+            if (!contains(index)) return;
+
+            // Swap the entity with the last one in the group, then shrink the group past it
+            --size;
+            for (IComponentPool* pool : pools) {
+                pool->moveTo(index, size);
+            }
+        }
+    };
+
+    /**
+     * Get the next unused component type ID
+     */
+    inline size_t nextComponentId() {
+        static std::atomic<size_t> nextId = 0;
+        return nextId.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * Get a sequential ID for a component type, used to index the pools in a Registry
+     *
+     * @tparam TComponent The component type to get the ID of
+     */
+    template<typename TComponent>
+    size_t componentId() {
+        static const size_t id = nextComponentId();
+        return id;
+    }
+} // namespace DatEngine::ECS::detail
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+namespace DatEngine::ECS {
+    /**
+     * A handle to an entity in a Registry
+     * <br>
+     * The index is reused once the entity is destroyed, the generation is incremented whenever that happens so stale
+     * handles to a destroyed entity can be detected.
+     */
+    struct Entity {
+        /** The index of entities that don't exist */
+        static constexpr uint32_t nullIndex = std::numeric_limits<uint32_t>::max();
+
+        uint32_t index = nullIndex;
+        uint32_t generation = 0;
+
+        /**
+         * Check if this is the null entity, note that a non-null entity may still have been destroyed
+         *
+         * @return true if this is the null entity
+         */
+        [[nodiscard]] constexpr bool isNull() const { return index == nullIndex; }
+
+        constexpr bool operator==(const Entity& other) const = default;
+    };
+
+    /** An entity handle that never refers to a valid entity */
+    constexpr Entity nullEntity{};
+} // namespace DatEngine::ECS
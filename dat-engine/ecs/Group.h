@@ -0,0 +1,74 @@
+#pragma once
+
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <container/SparseMap.h>
+
+#include "ComponentPool.h"
+#include "Entity.h"
+
+namespace DatEngine::ECS {
+    /**
+     * An owning group of components, created with Registry::group()
+     * <br>
+     * Entities that have every component in the group are kept packed at the front of each of the group's pools, in the
+     * same order, so iteration walks each dense array linearly without going through the sparse arrays at all.
+     * <br>
+     * The Registry maintains the packing as components are added and removed, so the group stays valid until its
+     * Registry is destroyed.
+     *
+     * @note Components of the grouped types must not be added or removed while iterating, as that reorders the pools.
+     *
+     * @tparam TComponents The component types owned by the group
+     */
+    template<typename... TComponents>
+        requires(sizeof...(TComponents) > 0)
+    class Group {
+        std::tuple<SparseMap<TComponents>*...> pools;
+        const detail::GroupData* data;
+        const std::vector<uint32_t>* generations;
+
+    public:
+        Group(
+                const std::vector<uint32_t>& generations,
+                const detail::GroupData& data,
+                SparseMap<TComponents>&... pools
+        ) :
+            pools(&pools...), data(&data), generations(&generations) {}
+
+        /**
+         * Call a function for every entity in the group
+         *
+         * @tparam TFunction A function taking either (Entity, TComponents&...) or (TComponents&...)
+         * @param function The function to call
+         */
+        template<typename TFunction>
+        void each(TFunction function) const {
+            const auto firstPool = std::get<0>(pools)->data();
+            const std::tuple<typename SparseMap<TComponents>::TDense*...> dense{
+                    std::get<SparseMap<TComponents>*>(pools)->data()...
+            };
+
+            for (uint32_t i = 0; i < data->size; ++i) {
+                if constexpr (std::is_invocable_v<TFunction&, Entity, TComponents&...>) {
+                    const uint32_t index = firstPool[i].first;
+                    function(
+                            Entity{index, (*generations)[index]},
+                            std::get<typename SparseMap<TComponents>::TDense*>(dense)[i].second...
+                    );
+                } else {
+                    function(std::get<typename SparseMap<TComponents>::TDense*>(dense)[i].second...);
+                }
+            }
+        }
+
+        /**
+         * Get the number of entities in the group
+         *
+         * @return The number of entities that have every component in the group
+         */
+        [[nodiscard]] size_t size() const { return data->size; }
+    };
+} // namespace DatEngine::ECS
@@ -0,0 +1,71 @@
+#include "Registry.h"
+
+using namespace DatEngine::ECS;
+
+/* -------------------------------------------- */
+/*  Entities                                    */
+/* -------------------------------------------- */
+
+Entity Registry::create() {
+    if (!freeIndices.empty()) {
+        const uint32_t index = freeIndices.back();
+        freeIndices.pop_back();
+        return {index, generations[index]};
+    }
+
+    const auto index = static_cast<uint32_t>(generations.size());
+    assert(index != Entity::nullIndex && "Ran out of entity indices");
+
+    generations.push_back(0);
+    return {index, 0};
+}
+
+void Registry::create(const std::span<Entity> entities) {
+    const size_t reused = std::min(entities.size(), freeIndices.size());
+    for (size_t i = 0; i < reused; ++i) {
+        entities[i] = create();
+    }
+
+    const size_t first = generations.size();
+    assert(first + entities.size() - reused < Entity::nullIndex && "Ran out of entity indices");
+
+    generations.resize(first + entities.size() - reused, 0);
+    for (size_t i = reused; i < entities.size(); ++i) {
+        entities[i] = {static_cast<uint32_t>(first + i - reused), 0};
+    }
+}
+
+void Registry::destroy(const Entity entity) {
+    assert(isValid(entity));
+
+    for (const auto& pool : pools) {
+        if (!pool) continue;
+
+        // Take the entity out of any group first, so removing the component doesn't break the group's packing
+        if (pool->group) pool->group->tryRemove(entity.index);
+        pool->remove(entity.index);
+    }
+
+    ++generations[entity.index];
+    freeIndices.push_back(entity.index);
+}
+
+bool Registry::isValid(const Entity entity) const {
+    return entity.index < generations.size() && generations[entity.index] == entity.generation;
+}
+
+void Registry::clear() {
+    for (const auto& pool : pools) {
+        if (pool) pool->clear();
+    }
+    for (const auto& group : groups) {
+        group->size = 0;
+    }
+
+    // Free the indices in reverse, so they're reused from the lowest up
+    freeIndices.clear();
+    for (size_t index = generations.size(); index-- > 0;) {
+        ++generations[index];
+        freeIndices.push_back(static_cast<uint32_t>(index));
+    }
+}
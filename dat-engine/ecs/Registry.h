@@ -0,0 +1,309 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include <container/SparseMap.h>
+
+#include "ComponentPool.h"
+#include "Entity.h"
+#include "Group.h"
+#include "View.h"
+
+namespace DatEngine::ECS {
+    /**
+     * Owns a set of entities and their components, with the components of each type packed together in a SparseMap
+     * keyed by entity index
+     */
+    class Registry {
+        /** The current generation of each entity index, incremented whenever the entity at that index is destroyed */
+        std::vector<uint32_t> generations;
+        /** Indices of destroyed entities, ready to be reused */
+        std::vector<uint32_t> freeIndices;
+        /** The component pools, indexed by detail::componentId() */
+        std::vector<std::unique_ptr<detail::IComponentPool>> pools;
+        /** The owning groups, each pool can be owned by at most one group */
+        std::vector<std::unique_ptr<detail::GroupData>> groups;
+
+        template<typename TComponent>
+        detail::ComponentPool<TComponent>* findPool() const {
+            const size_t id = detail::componentId<TComponent>();
+            if (id >= pools.size()) return nullptr;
+            return static_cast<detail::ComponentPool<TComponent>*>(pools[id].get());
+        }
+
+        template<typename TComponent>
+        detail::ComponentPool<TComponent>& assurePool() {
+            const size_t id = detail::componentId<TComponent>();
+            if (id >= pools.size()) pools.resize(id + 1);
+            if (!pools[id]) pools[id] = std::make_unique<detail::ComponentPool<TComponent>>();
+            return *static_cast<detail::ComponentPool<TComponent>*>(pools[id].get());
+        }
+
+        /**
+         * Add every entity that already has all of a group's components to the group
+         */
+        template<typename... TComponents>
+        void packGroup(detail::GroupData& data) {
+            // Collect the candidates from the smallest pool first, as adding them to the group reorders the pools
+            const size_t smallest = std::min({static_cast<size_t>(assurePool<TComponents>().components.size())...});
+            std::vector<uint32_t> candidates;
+            ([&] {
+                const SparseMap<TComponents>& pool = assurePool<TComponents>().components;
+                if (!candidates.empty() || pool.size() != smallest) return;
+                for (const auto& entry : pool) {
+                    candidates.push_back(entry.first);
+                }
+            }(), ...);
+
+            for (const uint32_t index : candidates) {
+                data.tryAdd(index);
+            }
+        }
+
+    public:
+        Registry() = default;
+        Registry(const Registry&) = delete;
+        Registry(Registry&&) = default;
+        Registry& operator=(const Registry&) = delete;
+        Registry& operator=(Registry&&) = default;
+
+        /* -------------------------------------------- */
+        /*  Entities                                    */
+        /* -------------------------------------------- */
+
+        /**
+         * Create a new entity with no components, reusing the index of a destroyed entity if possible
+         *
+         * @return The new entity
+         */
+        Entity create();
+
+        /**
+         * Create a batch of entities with no components, reusing the indices of destroyed entities first and growing
+         * the entity storage at most once
+         *
+         * @param entities Where to write the new entities, one is created for each element
+         */
+        void create(std::span<Entity> entities);
+
+        /**
+         * Destroy an entity and all of its components
+         *
+         * @param entity The entity to destroy, must be valid
+         */
+        void destroy(Entity entity);
+
+        /**
+         * Check if an entity handle refers to a live entity
+         *
+         * @param entity The entity to check
+         * @return true if the entity hasn't been destroyed
+         */
+        [[nodiscard]] bool isValid(Entity entity) const;
+
+        /**
+         * Get the number of live entities
+         *
+         * @return The number of live entities
+         */
+        [[nodiscard]] size_t size() const { return generations.size() - freeIndices.size(); }
+
+        /**
+         * Destroy every entity and component
+         * <br>
+         * The generations are kept, so handles to the destroyed entities stay invalid.
+         */
+        void clear();
+
+        /* -------------------------------------------- */
+        /*  Components                                  */
+        /* -------------------------------------------- */
+
+        /**
+         * Construct a component on an entity
+         *
+         * @tparam TComponent The type of component to add
+         * @tparam Args The types of the arguments to pass to the component constructor
+         * @param entity The entity to add the component to, must be valid and not already have a TComponent
+         * @param args The arguments to pass to the component constructor
+         * @return The new component
+         */
+        template<typename TComponent, typename... Args>
+        TComponent& emplace(const Entity entity, Args&&... args) {
+            assert(isValid(entity));
+
+            detail::ComponentPool<TComponent>& pool = assurePool<TComponent>();
+            pool.components.emplace(entity.index, std::forward<Args>(args)...);
+            if (pool.group) pool.group->tryAdd(entity.index);
+
+            // The group may have moved the component
+            return *pool.components.get(entity.index);
+        }
+
+        /**
+         * Add a batch of components to a batch of entities, growing the component pool at most once
+         *
+         * @tparam TComponent The type of component to add
+         * @param entities The entities to add the components to, must be valid, unique and not already have a
+         *                 TComponent
+         * @param components The components to add, one for each entity
+         */
+        template<typename TComponent>
+        void insert(const std::span<const Entity> entities, const std::span<const TComponent> components) {
+            assert(entities.size() == components.size());
+
+            std::vector<uint32_t> indices(entities.size());
+            std::ranges::transform(entities, indices.begin(), [this](const Entity entity) {
+                assert(isValid(entity));
+                return entity.index;
+            });
+
+            detail::ComponentPool<TComponent>& pool = assurePool<TComponent>();
+            pool.components.insertBatch(indices, components);
+            if (pool.group) {
+                for (const uint32_t index : indices) {
+                    pool.group->tryAdd(index);
+                }
+            }
+        }
+
+        /**
+         * Remove a component from an entity
+         *
+         * @tparam TComponent The type of component to remove
+         * @param entity The entity to remove the component from, must be valid and have a TComponent
+         */
+        template<typename TComponent>
+        void remove(const Entity entity) {
+            assert(has<TComponent>(entity));
+
+            detail::ComponentPool<TComponent>& pool = assurePool<TComponent>();
+            if (pool.group) pool.group->tryRemove(entity.index);
+            pool.components.remove(entity.index);
+        }
+
+        /**
+         * Check if an entity has all of a set of components
+         *
+         * @tparam TComponents The component types to check for
+         * @param entity The entity to check, must be valid
+         * @return true if the entity has every component
+         */
+        template<typename... TComponents>
+        [[nodiscard]] bool has(const Entity entity) const {
+            assert(isValid(entity));
+
+            return ([&] {
+                const auto* pool = findPool<TComponents>();
+                return pool != nullptr && pool->contains(entity.index);
+            }() && ...);
+        }
+
+        /**
+         * Get a component of an entity
+         *
+         * @tparam TComponent The type of component to get
+         * @param entity The entity to get the component from, must be valid and have a TComponent
+         * @return The component
+         */
+        template<typename TComponent>
+        TComponent& get(const Entity entity) {
+            TComponent* component = tryGet<TComponent>(entity);
+            assert(component != nullptr);
+            return *component;
+        }
+
+        /**
+         * Get a component of an entity if it has one
+         *
+         * @tparam TComponent The type of component to get
+         * @param entity The entity to get the component from, must be valid
+         * @return The component, or nullptr if the entity doesn't have one
+         */
+        template<typename TComponent>
+        TComponent* tryGet(const Entity entity) {
+            assert(isValid(entity));
+
+            detail::ComponentPool<TComponent>* pool = findPool<TComponent>();
+            return pool != nullptr ? pool->components.get(entity.index) : nullptr;
+        }
+
+        /**
+         * Sort the components of a type in place, so views driven by them visit the entities in that order
+         *
+         * @note Pools owned by a group can't be sorted, as the group relies on the order of its pools
+         *
+         * @tparam TComponent The type of component to sort
+         * @tparam TCompare The type of the comparator
+         * @param compare A comparator taking two @code const TComponent&@endcode
+         */
+        template<typename TComponent, typename TCompare>
+        void sort(TCompare compare) {
+            detail::ComponentPool<TComponent>& pool = assurePool<TComponent>();
+            assert(pool.group == nullptr && "Components owned by a group can't be sorted");
+
+            pool.components.sort([&](const auto& first, const auto& second) {
+                return compare(first.second, second.second);
+            });
+        }
+
+        /* -------------------------------------------- */
+        /*  Views                                       */
+        /* -------------------------------------------- */
+
+        /**
+         * Get a view of every entity that has all of a set of components
+         *
+         * @tparam TComponents The component types an entity must have to be in the view
+         * @return The view
+         */
+        template<typename... TComponents>
+        View<TComponents...> view() {
+            return View<TComponents...>(generations, assurePool<TComponents>().components...);
+        }
+
+        /**
+         * Get the owning group of a set of components, creating it if needed
+         * <br>
+         * The group takes ownership of the pools of its components, keeping the entities that have all of them packed
+         * at the front of each pool. Creating a group packs the existing entities, after that adding and removing
+         * components keeps it up to date.
+         *
+         * @note A component pool can only be owned by one group, so groups sharing a component type aren't supported.
+         *       Asking for the same group again returns it, in any order of the component types.
+         *
+         * @tparam TComponents The component types owned by the group
+         * @return The group
+         */
+        template<typename... TComponents>
+        Group<TComponents...> group() {
+            std::array<detail::IComponentPool*, sizeof...(TComponents)> owned{&assurePool<TComponents>()...};
+
+            detail::GroupData* data = owned.front()->group;
+            if (data == nullptr) {
+                assert(std::ranges::none_of(owned, [](const auto* pool) { return pool->group != nullptr; })
+                       && "A component can only be owned by one group");
+
+                data = groups.emplace_back(std::make_unique<detail::GroupData>()).get();
+                data->pools.assign(owned.begin(), owned.end());
+                for (detail::IComponentPool* pool : owned) {
+                    pool->group = data;
+                }
+
+                packGroup<TComponents...>(*data);
+            }
+
+            assert(data->pools.size() == owned.size()
+                   && std::ranges::all_of(owned, [&](const auto* pool) { return pool->group == data; })
+                   && "A component can only be owned by one group");
+
+            return Group<TComponents...>(generations, *data, assurePool<TComponents>().components...);
+        }
+    };
+} // namespace DatEngine::ECS
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <container/SparseMap.h>
+
+#include "Entity.h"
+
+namespace DatEngine::ECS {
+    /**
+     * A view of every entity in a Registry that has all of a set of components
+     * <br>
+     * Iteration is driven by the smallest of the component pools, with the other pools only used to check the entity
+     * has the rest of the components, so the cost scales with the rarest component rather than the most common one.
+     *
+     * @note Components of the viewed types must not be added or removed while iterating, as that reorders the pools.
+     *       Other components, and the values of the viewed components, can be changed freely.
+     *
+     * @tparam TComponents The component types an entity must have to be in the view
+     */
+    template<typename... TComponents>
+        requires(sizeof...(TComponents) > 0)
+    class View {
+        std::tuple<SparseMap<TComponents>*...> pools;
+        const std::vector<uint32_t>* generations;
+
+        /**
+         * Get the position in TComponents of the smallest pool
+         */
+        [[nodiscard]] size_t getSmallestPool() const {
+            const std::array<size_t, sizeof...(TComponents)> sizes{std::get<SparseMap<TComponents>*>(pools)->size()...};
+            return std::ranges::min_element(sizes) - sizes.begin();
+        }
+
+        /**
+         * Get a component of an entity, or nullptr if it doesn't have one
+         */
+        template<typename TComponent>
+        TComponent* getComponent(const uint32_t index) const {
+            return std::get<SparseMap<TComponent>*>(pools)->get(index);
+        }
+
+        /**
+         * Call a function with the entity and the components, passing the entity only if the function accepts it
+         */
+        template<typename TFunction>
+        void invoke(TFunction& function, const uint32_t index, TComponents&... components) const {
+            if constexpr (std::is_invocable_v<TFunction&, Entity, TComponents&...>) {
+                function(Entity{index, (*generations)[index]}, components...);
+            } else {
+                function(components...);
+            }
+        }
+
+        /**
+         * Iterate the view using the pool of TDriver to find candidate entities
+         */
+        template<typename TDriver, typename TFunction>
+        void eachFrom(TFunction& function) const {
+            for (auto& entry : *std::get<SparseMap<TDriver>*>(pools)) {
+                const uint32_t index = entry.first;
+
+                // Look up every other component, the driver's component is already known
+                const std::tuple<TComponents*...> components{[&]() -> TComponents* {
+                    if constexpr (std::is_same_v<TComponents, TDriver>) return &entry.second;
+                    else return getComponent<TComponents>(index);
+                }()...};
+
+                if (((std::get<TComponents*>(components) == nullptr) || ...)) continue;
+                invoke(function, index, *std::get<TComponents*>(components)...);
+            }
+        }
+
+    public:
+        View(const std::vector<uint32_t>& generations, SparseMap<TComponents>&... pools) :
+            pools(&pools...), generations(&generations) {}
+
+        /**
+         * Call a function for every entity in the view
+         *
+         * @tparam TFunction A function taking either (Entity, TComponents&...) or (TComponents&...)
+         * @param function The function to call
+         */
+        template<typename TFunction>
+        void each(TFunction function) const {
+            if constexpr (sizeof...(TComponents) == 1) {
+                eachFrom<TComponents...>(function);
+            } else {
+                const size_t smallest = getSmallestPool();
+                size_t position = 0;
+                ((position++ == smallest ? eachFrom<TComponents>(function) : void()), ...);
+            }
+        }
+
+        /**
+         * Get an upper bound on the number of entities in the view, the size of the smallest pool
+         *
+         * @return The maximum number of entities in the view
+         */
+        [[nodiscard]] size_t sizeHint() const {
+            return std::min({static_cast<size_t>(std::get<SparseMap<TComponents>*>(pools)->size())...});
+        }
+    };
+} // namespace DatEngine::ECS
@@ -1 +1,219 @@
 #include "EventBus.h"
+
+#include <utility>
+
+using namespace DatEngine::Events;
+
+namespace {
+    std::atomic<uint64_t> nextBusId = 0;
+
+    /** The queue the thread owns on each bus it has queued events on, by bus ID */
+    thread_local std::vector<std::pair<uint64_t, EventQueue*>> threadQueues;
+} // namespace
+
+EventBus::EventBus() : busId(nextBusId.fetch_add(1, std::memory_order_relaxed)) {}
+
+EventBus::~EventBus() {
+    for (EventQueue* queue = queues.load(std::memory_order_acquire); queue;) {
+        delete std::exchange(queue, queue->nextQueue);
+    }
+}
+
+void EventBus::init() {}
+
+void EventBus::tick(float) {
+    dispatchQueuedEvents();
+    ++frameNumber;
+}
+
+/* -------------------------------------------- */
+/*  Listeners                                   */
+/* -------------------------------------------- */
+
+ListenerHandle EventBus::insertListener(
+        const size_t typeId, const ListenerPriority priority, const CancelledCheck isCancelled, Listener&& listener
+) {
+    uint32_t slot = firstFreeSlot;
+    if (slot != ListenerHandle::nullIndex) {
+        firstFreeSlot = slots[slot].nextFree;
+    } else {
+        slot = static_cast<uint32_t>(slots.size());
+        slots.emplace_back();
+    }
+    slots[slot].typeId = static_cast<uint32_t>(typeId);
+    slots[slot].position = pendingPosition;
+
+    if (dispatchDepth > 0) {
+        pendingListeners.push_back({slot, slots[slot].generation, priority, isCancelled, std::move(listener)});
+    } else {
+        addToList(slot, priority, isCancelled, std::move(listener));
+    }
+
+    return {slot, slots[slot].generation};
+}
+
+bool EventBus::removeListener(const ListenerHandle handle) {
+    if (!isListening(handle)) return false;
+
+    // Invalidate the handle straight away, even if the listener can't be moved out of its list yet
+    ++slots[handle.index].generation;
+    if (dispatchDepth > 0) {
+        pendingRemovals.push_back(handle.index);
+    } else {
+        removeFromList(handle.index);
+        freeSlot(handle.index);
+    }
+    return true;
+}
+
+bool EventBus::isListening(const ListenerHandle handle) const {
+    // Removing a listener increments its slot's generation, so only handles to live listeners can match
+    return handle.index < slots.size() && slots[handle.index].generation == handle.generation;
+}
+
+void EventBus::addToList(
+        const uint32_t slot, const ListenerPriority priority, const CancelledCheck isCancelled, Listener&& listener
+) {
+    const uint32_t typeId = slots[slot].typeId;
+    if (typeId >= lists.size()) lists.resize(typeId + 1);
+    ListenerList& list = lists[typeId];
+    list.isCancelled = isCancelled;
+
+    // Open a hole at the end of the lowest band, then move it up a band at a time by moving each band's first listener
+    // to its end, until it's at the end of the new listener's band
+    auto hole = static_cast<uint32_t>(list.listeners.size());
+    list.listeners.emplace_back();
+    list.slots.emplace_back();
+
+    const auto band = static_cast<size_t>(priority);
+    for (size_t later = listenerPriorityCount - 1; later > band; --later) {
+        const uint32_t first = list.bandEnds[later - 1];
+        if (first != hole) moveListener(list, first, hole);
+        hole = first;
+        ++list.bandEnds[later];
+    }
+    ++list.bandEnds[band];
+
+    list.listeners[hole] = std::move(listener);
+    list.slots[hole] = slot;
+    slots[slot].position = hole;
+}
+
+void EventBus::removeFromList(const uint32_t slot) {
+    ListenerList& list = lists[slots[slot].typeId];
+    uint32_t hole = slots[slot].position;
+
+    // Find the listener's band, then fill the hole with the last listener of that band and each later band in turn,
+    // leaving it at the end of the list
+    size_t band = 0;
+    while (list.bandEnds[band] <= hole) ++band;
+    for (; band < listenerPriorityCount; ++band) {
+        const uint32_t last = --list.bandEnds[band];
+        if (last != hole) moveListener(list, last, hole);
+        hole = last;
+    }
+
+    list.listeners.pop_back();
+    list.slots.pop_back();
+}
+
+void EventBus::moveListener(ListenerList& list, const uint32_t from, const uint32_t to) {
+    list.listeners[to] = std::move(list.listeners[from]);
+    list.slots[to] = list.slots[from];
+    slots[list.slots[to]].position = to;
+}
+
+void EventBus::freeSlot(const uint32_t slot) {
+    slots[slot].nextFree = firstFreeSlot;
+    firstFreeSlot = slot;
+}
+
+void EventBus::flushPendingChanges() {
+    for (PendingListener& pending : pendingListeners) {
+        if (slots[pending.slot].generation != pending.generation) continue;
+        addToList(pending.slot, pending.priority, pending.isCancelled, std::move(pending.listener));
+    }
+    pendingListeners.clear();
+
+    for (const uint32_t slot : pendingRemovals) {
+        // Listeners added and removed in the same dispatch never made it into a list
+        if (slots[slot].position != pendingPosition) removeFromList(slot);
+        freeSlot(slot);
+    }
+    pendingRemovals.clear();
+}
+
+/* -------------------------------------------- */
+/*  Queued Events                               */
+/* -------------------------------------------- */
+
+EventQueue& EventBus::getThreadQueue() {
+    for (const auto& [id, queue] : threadQueues) {
+        if (id == busId) return *queue;
+    }
+
+    // Entries for destroyed buses are never matched again, as bus IDs aren't reused
+    auto* queue = new EventQueue();
+    queue->nextQueue = queues.load(std::memory_order_relaxed);
+    while (!queues.compare_exchange_weak(
+            queue->nextQueue, queue, std::memory_order_release, std::memory_order_relaxed
+    )) {}
+
+    threadQueues.emplace_back(busId, queue);
+    return *queue;
+}
+
+void EventBus::dispatchQueuedEvents() {
+    for (EventQueue* queue = queues.load(std::memory_order_acquire); queue; queue = queue->nextQueue) {
+        queue->collect(queuedEvents);
+    }
+
+    // Runs even if a listener throws, so the blocks go back to their producers and no event is called twice
+    struct ReleaseCollected {
+        EventBus& bus;
+
+        ~ReleaseCollected() {
+            for (std::vector<void*>& events : bus.queuedEvents) events.clear();
+            for (EventQueue* queue = bus.queues.load(std::memory_order_acquire); queue; queue = queue->nextQueue) {
+                queue->releaseCollected();
+            }
+        }
+    } release{*this};
+
+    DispatchScope dispatch(*this);
+    for (size_t typeId = 0; typeId < queuedEvents.size(); ++typeId) {
+        std::vector<void*>& events = queuedEvents[typeId];
+        if (events.empty()) continue;
+
+        const ListenerList* list = typeId < lists.size() ? &lists[typeId] : nullptr;
+        for (void* event : events) {
+            if (recorder) {
+                const auto [typeHash, size] = EventQueue::getEventInfo(event);
+                recorder->record(frameNumber, typeHash, event, size);
+            }
+            if (list) callListeners(*list, event);
+        }
+        events.clear();
+    }
+}
+
+/* -------------------------------------------- */
+/*  Recorded Events                             */
+/* -------------------------------------------- */
+
+void EventBus::callEvent(const uint32_t typeHash, void* eventData, const uint32_t size) {
+    if (recorder) recorder->record(frameNumber, typeHash, eventData, size);
+
+    const auto id = typeIdsByHash.find(typeHash);
+    if (id == typeIdsByHash.end() || id->second >= lists.size()) return;
+
+    DispatchScope dispatch(*this);
+    callListeners(lists[id->second], eventData);
+}
+
+void EventBus::callListeners(const ListenerList& list, void* event) {
+    for (const Listener& listener : list.listeners) {
+        if (list.isCancelled && list.isCancelled(event)) break;
+        listener(event);
+    }
+}
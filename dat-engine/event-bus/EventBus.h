@@ -1,37 +1,416 @@
 #pragma once
-#include <functional>
-#include <typeindex>
-#include <typeinfo>
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <unordered_map>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
+#include <util/Delegate.h>
+#include <util/StringUtils.h>
 #include <util/TypeTraits.h>
 
 
 #include "Event.h"
+#include "EventQueue.h"
+#include "EventRecorder.h"
 #include "service/EngineService.h"
 
 namespace DatEngine::Events {
+    namespace detail {
+        /**
+         * Get the next unused event type ID
+         */
+        inline size_t nextEventTypeId() {
+            static std::atomic<size_t> nextId = 0;
+            return nextId.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        /**
+         * Get a sequential ID for an event type, used to index the listener lists in an EventBus
+         *
+         * @tparam TEvent The event type to get the ID of
+         */
+        template<typename TEvent>
+        size_t eventTypeId() {
+            static const size_t id = nextEventTypeId();
+            return id;
+        }
+
+        /**
+         * Hash the name of an event type, which unlike its ID is the same in every run of a build
+         */
+        template<typename TEvent>
+        consteval uint32_t hashEventType() {
+            // The compiler's pretty function name spells out the template argument, so it's unique to the type.
+            // std::source_location::function_name() isn't guaranteed to, and on some compilers is just the bare name
+#if defined(_MSC_VER)
+            const std::string_view name = __FUNCSIG__;
+#else
+            const std::string_view name = __PRETTY_FUNCTION__;
+#endif
+            return StringUtils::fnv1a_32(name.data(), name.size() - 1);
+        }
+
+        /**
+         * A stable hash identifying an event type in recorded event logs
+         *
+         * @tparam TEvent The event type to get the hash of
+         */
+        template<typename TEvent>
+        inline constexpr uint32_t eventTypeHash = hashEventType<TEvent>();
+
+        // If the compiler leaves the template argument out of the function name every event type shares one hash
+        static_assert(hashEventType<int>() != hashEventType<float>(), "Event type hashes must differ between types");
+    } // namespace detail
+
+    /**
+     * The order listeners are called in, every listener in a band is called before any in the next one
+     */
+    enum class ListenerPriority : uint8_t { Highest, High, Normal, Low, Lowest };
+
+    /** The number of ListenerPriority bands */
+    inline constexpr size_t listenerPriorityCount = 5;
+
+    /**
+     * A handle to a listener registered on an EventBus, used to remove it
+     * <br>
+     * The generation is incremented whenever the listener is removed, so a stale handle can't remove whichever
+     * listener has reused its slot.
+     */
+    struct ListenerHandle {
+        /** The index of handles that don't refer to a listener */
+        static constexpr uint32_t nullIndex = std::numeric_limits<uint32_t>::max();
+
+        uint32_t index = nullIndex;
+        uint32_t generation = 0;
+
+        /**
+         * Check if this is the null handle, note that a non-null handle may still refer to a removed listener
+         *
+         * @return true if this is the null handle
+         */
+        [[nodiscard]] constexpr bool isNull() const { return index == nullIndex; }
+
+        constexpr bool operator==(const ListenerHandle& other) const = default;
+    };
+
+    /**
+     * Dispatches events to the listeners registered for their exact type
+     * <br>
+     * Listeners are stored in a contiguous list per event type, indexed by a sequential type ID, so calling an event is
+     * one bounds check followed by a single indirect call per listener, with no hashing or allocation. Each list is
+     * kept split into priority bands as listeners are added and removed, both in constant time.
+     * <br>
+     * Listeners are only ever called on the thread that calls or dispatches the event. Other threads, like jobs, queue
+     * events instead, which are copied into a queue owned by the queueing thread and dispatched together on tick.
+     */
     class EventBus final : public Service::EngineService {
-        std::unordered_multimap<std::type_index, std::function<void(void*)>> listenerMap;
     public:
-        void init() override {
+        /** A type erased listener, called with a pointer to the event */
+        using Listener = Delegate<void(void*)>;
+        /** Checks if a type erased CancellableEvent has been cancelled */
+        using CancelledCheck = bool (*)(const void* event);
+
+    private:
+        /**
+         * The listeners for one event type, ordered by priority band
+         * <br>
+         * Order within a band isn't kept, so a listener can be removed by moving one listener per band into its place.
+         */
+        struct ListenerList {
+            std::vector<Listener> listeners;
+            /** The slot of each listener, parallel to listeners so dispatch only touches the delegates */
+            std::vector<uint32_t> slots;
+            /** The end of each priority band in listeners, the band starts at the end of the band before */
+            std::array<uint32_t, listenerPriorityCount> bandEnds{};
+            /** Set for CancellableEvent types, so queued dispatch can stop once a queued event is cancelled */
+            CancelledCheck isCancelled = nullptr;
+        };
+
+        /**
+         * Where a handle's listener is, slots are reused once their listener is removed
+         */
+        struct ListenerSlot {
+            uint32_t typeId = 0;
+            /** The listener's index in its list, or pendingPosition if it hasn't been added to the list yet */
+            uint32_t position = 0;
+            uint32_t generation = 0;
+            /** For free slots, the index of the next free slot */
+            uint32_t nextFree = ListenerHandle::nullIndex;
+        };
+
+        /**
+         * A listener added while an event was being called
+         */
+        struct PendingListener {
+            uint32_t slot;
+            /** The slot's generation when added, a different generation means it was removed before being added */
+            uint32_t generation;
+            ListenerPriority priority;
+            CancelledCheck isCancelled;
+            Listener listener;
+        };
+
+        static constexpr uint32_t pendingPosition = std::numeric_limits<uint32_t>::max();
+
+        /** The listeners for each event type, indexed by detail::eventTypeId() */
+        std::vector<ListenerList> lists;
+        /** The slot of every handle, live or free */
+        std::vector<ListenerSlot> slots;
+        /** The first free slot, the free slots form a chain through ListenerSlot::nextFree */
+        uint32_t firstFreeSlot = ListenerHandle::nullIndex;
+
+        /** The number of events currently being called, listeners can't be moved while it's above 0 */
+        uint32_t dispatchDepth = 0;
+        /** Listeners added while an event was being called, added once it returns */
+        std::vector<PendingListener> pendingListeners;
+        /** The slots of listeners removed while an event was being called, removed from their lists once it returns */
+        std::vector<uint32_t> pendingRemovals;
+
+        /** Identifies the bus in each thread's cache of its queues, unlike its address this is never reused */
+        const uint64_t busId;
+        /** The queue of every thread that has queued an event, pushed to without locking */
+        std::atomic<EventQueue*> queues = nullptr;
+        /** The queued events being dispatched, indexed by event type ID, kept to reuse the allocations */
+        std::vector<std::vector<void*>> queuedEvents;
+
+        /** The number of ticks so far, recorded with each event */
+        uint64_t frameNumber = 0;
+        /** Records every event dispatched while set */
+        EventRecorder* recorder = nullptr;
+        /** The ID of each event type with listeners by its hash, used to replay recorded events */
+        std::unordered_map<uint32_t, uint32_t> typeIdsByHash;
+
+        /**
+         * Call the listeners in a list with a type erased event, stopping if it's a cancellable event that's cancelled
+         */
+        static void callListeners(const ListenerList& list, void* event);
+
+        /**
+         * Get the calling thread's queue, creating it on the thread's first queued event
+         */
+        EventQueue& getThreadQueue();
+
+        /**
+         * Add a listener, or defer it if an event is being called as moving a running listener would invalidate it
+         */
+        ListenerHandle insertListener(
+                size_t typeId, ListenerPriority priority, CancelledCheck isCancelled, Listener&& listener
+        );
+
+        /**
+         * Add a listener to the end of its priority band, moving the first listener of each later band to its end
+         */
+        void addToList(uint32_t slot, ListenerPriority priority, CancelledCheck isCancelled, Listener&& listener);
+
+        /**
+         * Remove a listener from its list, moving the last listener of its band and each later band down a place
+         */
+        void removeFromList(uint32_t slot);
+
+        /**
+         * Move a listener to another index in its list, updating its slot
+         */
+        void moveListener(ListenerList& list, uint32_t from, uint32_t to);
 
+        /**
+         * Return a slot to the free list, once its listener has been removed
+         */
+        void freeSlot(uint32_t slot);
+
+        /**
+         * Add and remove the listeners that were deferred while events were being called
+         */
+        void flushPendingChanges();
+
+        /**
+         * Leave a dispatch, applying deferred changes if it was the outermost one
+         */
+        void endDispatch() {
+            if (--dispatchDepth == 0 && (!pendingListeners.empty() || !pendingRemovals.empty())) flushPendingChanges();
         }
 
-        template<TypeTraits::CSubClass<Event> TEvent>
-        void addListener(std::function<void(TEvent*)> listenerMethod) {
-            listenerMap.emplace(std::type_index(typeid(TEvent)), [test = listenerMethod](void* event) {
-                test(static_cast<TEvent*>(event));
-            });
+        /**
+         * Counts as a dispatch for its lifetime, so the dispatch still ends if a listener throws
+         */
+        class DispatchScope {
+            EventBus& bus;
+
+        public:
+            explicit DispatchScope(EventBus& bus) : bus(bus) { ++bus.dispatchDepth; }
+            ~DispatchScope() { bus.endDispatch(); }
+
+            DispatchScope(const DispatchScope&) = delete;
+            DispatchScope& operator=(const DispatchScope&) = delete;
+        };
+
+    public:
+        EventBus();
+        ~EventBus() override;
+
+        EventBus(const EventBus&) = delete;
+        EventBus& operator=(const EventBus&) = delete;
+
+        void init() override;
+
+        /**
+         * Dispatch the events queued since the last tick, then move on to the next frame
+         *
+         * @param delta The duration of the tick
+         */
+        void tick(float delta) override;
+
+        /**
+         * Register a function to be called whenever an event is called
+         * <br>
+         * Listeners added while an event is being called are only called for later events.
+         *
+         * @tparam TEvent The type of event to listen for, listeners aren't called for subclasses of the event
+         * @param listener The function to call with the event, must fit in a Delegate's buffer
+         * @param priority The band to call the listener in, listeners in the same band are called in no set order
+         * @return A handle to remove the listener with
+         */
+        template<TypeTraits::CSubClass<Event> TEvent, typename TListener>
+            requires std::is_invocable_v<TListener&, TEvent*>
+        ListenerHandle addListener(TListener&& listener, const ListenerPriority priority = ListenerPriority::Normal) {
+            CancelledCheck isCancelled = nullptr;
+            if constexpr (std::derived_from<TEvent, CancellableEvent>) {
+                isCancelled = [](const void* event) { return static_cast<const TEvent*>(event)->isCancelled(); };
+            }
+
+            const size_t id = detail::eventTypeId<TEvent>();
+            typeIdsByHash.try_emplace(detail::eventTypeHash<TEvent>, static_cast<uint32_t>(id));
+
+            // The wrapper's type is known here, so the cast is inlined into the delegate's invoker
+            return insertListener(
+                    id,
+                    priority,
+                    isCancelled,
+                    [function = std::forward<TListener>(listener)](void* event) mutable {
+                        function(static_cast<TEvent*>(event));
+                    }
+            );
         }
 
-        /* TODO: Unregister, handle threading, move to cpp file, document */
+        /**
+         * Unregister a listener
+         * <br>
+         * A listener removed while an event is being called may still be called for that event, but not for any
+         * later ones.
+         *
+         * @param handle The handle returned when the listener was added
+         * @return true if the listener was removed, false if the handle was null or already removed
+         */
+        bool removeListener(ListenerHandle handle);
 
+        /**
+         * Check if a handle refers to a listener that hasn't been removed
+         *
+         * @param handle The handle to check
+         * @return true if the listener is registered
+         */
+        [[nodiscard]] bool isListening(ListenerHandle handle) const;
+
+        /**
+         * Call every listener registered for an event's type, from the highest priority band to the lowest
+         * <br>
+         * Cancellable events stop being passed to listeners as soon as one cancels them.
+         *
+         * @tparam TEvent The type of event
+         * @param eventData The event to pass to the listeners
+         */
         template<TypeTraits::CSubClass<Event> TEvent>
         void callEvent(TEvent* eventData) {
-            auto listeners = listenerMap.equal_range(std::type_index(typeid(TEvent)));
-            for (auto it = listeners.first; it != listeners.second; ++it) {
-                it->second(eventData);
+            if constexpr (std::is_trivially_copyable_v<TEvent>) {
+                if (recorder) recorder->record(frameNumber, detail::eventTypeHash<TEvent>, eventData, sizeof(TEvent));
+            }
+
+            const size_t id = detail::eventTypeId<TEvent>();
+            if (id >= lists.size()) return;
+
+            // Changes to the lists are deferred while dispatching, so the reference stays valid
+            DispatchScope dispatch(*this);
+            for (const Listener& listener : lists[id].listeners) {
+                if constexpr (std::derived_from<TEvent, CancellableEvent>) {
+                    if (eventData->isCancelled()) break;
+                }
+                listener(eventData);
             }
         }
+
+        /**
+         * Get the number of listeners registered for an event type
+         *
+         * @tparam TEvent The type of event
+         * @return The number of listeners
+         */
+        template<TypeTraits::CSubClass<Event> TEvent>
+        [[nodiscard]] size_t getListenerCount() const {
+            const size_t id = detail::eventTypeId<TEvent>();
+            return id < lists.size() ? lists[id].listeners.size() : 0;
+        }
+
+        /**
+         * Queue an event to be called on the next tick, can be called from any thread without locking
+         * <br>
+         * The event is copied, so it can't be cancelled or modified by the listeners in a way the caller sees.
+         *
+         * @tparam TEvent The type of event, must be trivially copyable
+         * @param eventData The event to queue
+         * @note The bus must outlive every thread that queues events on it
+         */
+        template<TypeTraits::CSubClass<Event> TEvent>
+            requires std::is_trivially_copyable_v<TEvent>
+        void queueEvent(const TEvent& eventData) {
+            static_assert(sizeof(TEvent) <= EventQueue::maxEventSize, "Event is too large to be queued");
+            getThreadQueue().push(
+                    static_cast<uint32_t>(detail::eventTypeId<TEvent>()),
+                    detail::eventTypeHash<TEvent>,
+                    &eventData,
+                    sizeof(TEvent)
+            );
+        }
+
+        /**
+         * Call the listeners of every event queued so far, grouped by event type so each type's listeners run
+         * together
+         * <br>
+         * Events of one type queued by one thread are called in the order they were queued, there's no ordering
+         * between threads or types. Events queued by the listeners are left for the next dispatch. If a listener
+         * throws, the events collected by this dispatch that haven't been called yet are dropped, not called again.
+         *
+         * @note Must only be called from one thread at a time
+         */
+        void dispatchQueuedEvents();
+
+        /**
+         * Call an event by its type hash, used to replay recorded events
+         * <br>
+         * Nothing is called if no listeners have been added for the type, as the hash can only be matched to a type
+         * once a listener for it has been added.
+         *
+         * @param typeHash The hash of the event's type, see detail::eventTypeHash
+         * @param eventData The event, which must be suitably aligned for its type
+         * @param size The size of the event
+         */
+        void callEvent(uint32_t typeHash, void* eventData, uint32_t size);
+
+        /**
+         * Start or stop recording every event the bus dispatches
+         *
+         * @param eventRecorder The recorder to write events to, or nullptr to stop recording
+         */
+        void setRecorder(EventRecorder* eventRecorder) { recorder = eventRecorder; }
+
+        /**
+         * Get the number of times the bus has ticked
+         */
+        [[nodiscard]] uint64_t getFrameNumber() const { return frameNumber; }
     };
-}
\ No newline at end of file
+}
@@ -0,0 +1,101 @@
+#include "EventQueue.h"
+
+#include <cassert>
+#include <cstring>
+#include <utility>
+
+using namespace DatEngine::Events;
+
+EventQueue::EventQueue() : tail(new Block), head(tail) {}
+
+EventQueue::~EventQueue() {
+    for (Block* block = head; block;) delete std::exchange(block, block->next.load(std::memory_order_relaxed));
+    for (Block* block = localFreeBlocks; block;) delete std::exchange(block, block->nextFree);
+    for (Block* block = freeBlocks.load(std::memory_order_relaxed); block;) {
+        delete std::exchange(block, block->nextFree);
+    }
+    for (const Block* block : collectedBlocks) delete block;
+}
+
+/* -------------------------------------------- */
+/*  Producer                                    */
+/* -------------------------------------------- */
+
+EventQueue::Block* EventQueue::acquireBlock() {
+    if (!localFreeBlocks) localFreeBlocks = freeBlocks.exchange(nullptr, std::memory_order_acquire);
+    if (!localFreeBlocks) return new Block;
+
+    Block* block = std::exchange(localFreeBlocks, localFreeBlocks->nextFree);
+    // The consumer released the block, so it's no longer reading either field
+    block->committed.store(0, std::memory_order_relaxed);
+    block->next.store(nullptr, std::memory_order_relaxed);
+    return block;
+}
+
+void EventQueue::push(const uint32_t typeId, const uint32_t typeHash, const void* event, const size_t size) {
+    assert(size <= maxEventSize && "Event is too large to be queued");
+
+    const auto recordSize = static_cast<uint32_t>(headerSize + ((size + recordAlignment - 1) & ~(recordAlignment - 1)));
+    if (writeOffset + recordSize > blockSize) {
+        // Everything in the old block is already committed, so publishing next tells the consumer it's complete
+        Block* block = acquireBlock();
+        tail->next.store(block, std::memory_order_release);
+        tail = block;
+        writeOffset = 0;
+    }
+
+    std::byte* record = tail->data + writeOffset;
+    const RecordHeader header{typeId, typeHash, static_cast<uint32_t>(size), recordSize};
+    std::memcpy(record, &header, sizeof(header));
+    std::memcpy(record + headerSize, event, size);
+
+    writeOffset += recordSize;
+    tail->committed.store(writeOffset, std::memory_order_release);
+}
+
+/* -------------------------------------------- */
+/*  Consumer                                    */
+/* -------------------------------------------- */
+
+void EventQueue::collectBlock(const Block& block, const uint32_t end, std::vector<std::vector<void*>>& eventsByType) {
+    while (readOffset < end) {
+        auto* record = const_cast<std::byte*>(block.data + readOffset);
+        RecordHeader header{};
+        std::memcpy(&header, record, sizeof(header));
+
+        if (header.typeId >= eventsByType.size()) eventsByType.resize(header.typeId + 1);
+        eventsByType[header.typeId].push_back(record + headerSize);
+        readOffset += header.size;
+    }
+}
+
+void EventQueue::collect(std::vector<std::vector<void*>>& eventsByType) {
+    while (true) {
+        collectBlock(*head, head->committed.load(std::memory_order_acquire), eventsByType);
+
+        Block* next = head->next.load(std::memory_order_acquire);
+        if (!next) return;
+
+        // The producer may have committed more before moving on, which next's acquire has made visible
+        collectBlock(*head, head->committed.load(std::memory_order_relaxed), eventsByType);
+        collectedBlocks.push_back(head);
+        head = next;
+        readOffset = 0;
+    }
+}
+
+std::pair<uint32_t, uint32_t> EventQueue::getEventInfo(const void* event) {
+    RecordHeader header{};
+    std::memcpy(&header, static_cast<const std::byte*>(event) - headerSize, sizeof(header));
+    return {header.typeHash, header.eventSize};
+}
+
+void EventQueue::releaseCollected() {
+    for (Block* block : collectedBlocks) {
+        block->nextFree = freeBlocks.load(std::memory_order_relaxed);
+        while (!freeBlocks.compare_exchange_weak(
+                block->nextFree, block, std::memory_order_release, std::memory_order_relaxed
+        )) {}
+    }
+    collectedBlocks.clear();
+}
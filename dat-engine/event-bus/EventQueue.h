@@ -0,0 +1,127 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <threading/CacheLine.h>
+
+namespace DatEngine::Events {
+    /**
+     * An unbounded single producer, single consumer queue of type erased events, stored in a chain of fixed size
+     * blocks
+     * <br>
+     * The producer only writes to the last block and the consumer only reads up to the offset the producer has
+     * committed, so neither side takes a lock. Blocks the consumer has finished with are handed back to the producer
+     * for reuse, so a queue stops allocating once it has grown to its busiest frame.
+     */
+    class EventQueue {
+    public:
+        /** The number of bytes of events each block can hold */
+        static constexpr size_t blockSize = 16 * 1024;
+        /** Events and their headers are aligned to this, so any event can be read in place */
+        static constexpr size_t recordAlignment = alignof(std::max_align_t);
+        /** The largest event that can be queued */
+        static constexpr size_t maxEventSize = blockSize - recordAlignment;
+
+    private:
+        struct Block {
+            /** The number of bytes the producer has finished writing, published with release */
+            alignas(Threading::cacheLineSize) std::atomic<uint32_t> committed = 0;
+            /** The block the producer moved on to, only set once it has stopped writing to this one */
+            std::atomic<Block*> next = nullptr;
+            /** Links blocks in the free list */
+            Block* nextFree = nullptr;
+            alignas(recordAlignment) std::byte data[blockSize];
+        };
+
+        struct RecordHeader {
+            uint32_t typeId;
+            uint32_t typeHash;
+            /** The size of the event */
+            uint32_t eventSize;
+            /** The size of the record including the header and padding */
+            uint32_t size;
+        };
+
+        static constexpr size_t headerSize = (sizeof(RecordHeader) + recordAlignment - 1) & ~(recordAlignment - 1);
+
+        /* Producer state */
+
+        /** The block the producer is writing to */
+        Block* tail;
+        /** The offset the producer will write the next record at, only published through Block::committed */
+        uint32_t writeOffset = 0;
+        /** Blocks the producer can reuse, private to the producer */
+        Block* localFreeBlocks = nullptr;
+
+        /* Shared state */
+
+        /** Blocks the consumer has finished with, pushed by the consumer and taken all at once by the producer */
+        alignas(Threading::cacheLineSize) std::atomic<Block*> freeBlocks = nullptr;
+
+        /* Consumer state */
+
+        /** The block the consumer is reading from */
+        alignas(Threading::cacheLineSize) Block* head;
+        /** The offset of the next record the consumer will read */
+        uint32_t readOffset = 0;
+        /** Blocks that have been fully collected, which can be reused once their events have been dispatched */
+        std::vector<Block*> collectedBlocks;
+
+        /**
+         * Get an empty block for the producer to move on to
+         */
+        Block* acquireBlock();
+
+        /**
+         * Collect the committed records in a block from the read offset onwards
+         */
+        void collectBlock(const Block& block, uint32_t end, std::vector<std::vector<void*>>& eventsByType);
+
+    public:
+        /** Links the queues of every thread that has queued events on an EventBus */
+        EventQueue* nextQueue = nullptr;
+
+        EventQueue();
+        ~EventQueue();
+
+        EventQueue(const EventQueue&) = delete;
+        EventQueue& operator=(const EventQueue&) = delete;
+
+        /**
+         * Copy an event to the end of the queue, only called by the producer thread
+         *
+         * @param typeId The ID of the event's type
+         * @param typeHash The stable hash of the event's type, see detail::eventTypeHash
+         * @param event The event to copy, which must be trivially copyable
+         * @param size The size of the event, at most maxEventSize
+         */
+        void push(uint32_t typeId, uint32_t typeHash, const void* event, size_t size);
+
+        /**
+         * Get the type hash and size an event collected from a queue was pushed with
+         *
+         * @param event An event collected by collect
+         * @return The event's type hash and size
+         */
+        static std::pair<uint32_t, uint32_t> getEventInfo(const void* event);
+
+        /**
+         * Gather every event the producer has committed so far, only called by the consumer thread
+         * <br>
+         * The events stay valid until releaseCollected is called, and events pushed after collect returns are left
+         * for the next call, even when the consumer is also the producer.
+         *
+         * @param eventsByType Appended with a pointer to each event, indexed by event type ID, resized as needed
+         */
+        void collect(std::vector<std::vector<void*>>& eventsByType);
+
+        /**
+         * Hand the blocks read by collect back to the producer, invalidating the collected events
+         */
+        void releaseCollected();
+    };
+} // namespace DatEngine::Events
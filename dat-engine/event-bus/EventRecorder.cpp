@@ -0,0 +1,35 @@
+#include "EventRecorder.h"
+
+#include <fstream>
+
+using namespace DatEngine::Events;
+
+EventRecorder::EventRecorder() { clear(); }
+
+void EventRecorder::record(const uint64_t frame, const uint32_t typeHash, const void* event, const uint32_t size) {
+    if (frame != currentFrame) {
+        write(EventLog::frameMarker);
+        write(frame);
+        currentFrame = frame;
+    }
+
+    write(typeHash);
+    write(size);
+    const auto* bytes = static_cast<const std::byte*>(event);
+    log.insert(log.end(), bytes, bytes + size);
+}
+
+void EventRecorder::clear() {
+    log.clear();
+    currentFrame = std::numeric_limits<uint64_t>::max();
+    write(EventLog::magic);
+    write(EventLog::version);
+}
+
+bool EventRecorder::save(const std::filesystem::path& path) const {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) return false;
+
+    file.write(reinterpret_cast<const char*>(log.data()), static_cast<std::streamsize>(log.size()));
+    return file.good();
+}
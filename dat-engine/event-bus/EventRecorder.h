@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace DatEngine::Events {
+    /**
+     * The binary format of recorded event logs
+     * <br>
+     * A log starts with the magic number and version, followed by a record per event. Each record is the event's type
+     * hash and size followed by the event's bytes, and a frame marker is written whenever the frame changes. Values are
+     * written in the recording machine's byte order without padding, so logs are only replayed on the same platform.
+     */
+    namespace EventLog {
+        /** "DEVL" as a little endian integer */
+        inline constexpr uint32_t magic = 0x4C564544;
+        inline constexpr uint32_t version = 1;
+
+        /** The type hash that marks a frame marker record, followed by the 64 bit frame number */
+        inline constexpr uint32_t frameMarker = 0;
+
+        inline constexpr size_t headerSize = sizeof(magic) + sizeof(version);
+        inline constexpr size_t frameMarkerSize = sizeof(uint32_t) + sizeof(uint64_t);
+        inline constexpr size_t eventHeaderSize = sizeof(uint32_t) + sizeof(uint32_t);
+    } // namespace EventLog
+
+    /**
+     * Records the events an EventBus dispatches into a binary log, so they can be replayed with an EventReplayer
+     * <br>
+     * Only trivially copyable events are recorded, as they're copied byte for byte. Events are recorded as they are
+     * passed to the first listener, before listeners modify them.
+     *
+     * @note Recorders aren't thread safe, they're only written to by the thread dispatching events
+     */
+    class EventRecorder {
+        std::vector<std::byte> log;
+        /** The frame of the last frame marker written */
+        uint64_t currentFrame = std::numeric_limits<uint64_t>::max();
+
+        template<typename T>
+        void write(const T& value) {
+            const auto* bytes = reinterpret_cast<const std::byte*>(&value);
+            log.insert(log.end(), bytes, bytes + sizeof(T));
+        }
+
+    public:
+        EventRecorder();
+
+        /**
+         * Append an event to the log
+         *
+         * @param frame The frame the event was dispatched on
+         * @param typeHash The stable hash of the event's type
+         * @param event The event's bytes
+         * @param size The size of the event
+         */
+        void record(uint64_t frame, uint32_t typeHash, const void* event, uint32_t size);
+
+        /**
+         * Remove every recorded event
+         */
+        void clear();
+
+        /**
+         * Get the log recorded so far, including the header
+         */
+        [[nodiscard]] std::span<const std::byte> getLog() const { return log; }
+
+        /**
+         * Write the log recorded so far to a file
+         *
+         * @param path The file to write, which is overwritten
+         * @return true if the log was written
+         */
+        [[nodiscard]] bool save(const std::filesystem::path& path) const;
+    };
+} // namespace DatEngine::Events
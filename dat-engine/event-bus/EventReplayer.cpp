@@ -0,0 +1,99 @@
+#include "EventReplayer.h"
+
+#include <cassert>
+#include <cstring>
+#include <fstream>
+
+#include "EventBus.h"
+
+using namespace DatEngine::Events;
+
+namespace {
+    template<typename T>
+    T read(const std::span<const std::byte> log, const size_t offset) {
+        T value;
+        std::memcpy(&value, log.data() + offset, sizeof(T));
+        return value;
+    }
+} // namespace
+
+EventReplayer::EventReplayer(std::vector<std::byte> log) : log(std::move(log)) {}
+
+bool EventReplayer::validate(const std::span<const std::byte> log) {
+    if (log.size() < EventLog::headerSize) return false;
+    if (read<uint32_t>(log, 0) != EventLog::magic || read<uint32_t>(log, sizeof(uint32_t)) != EventLog::version) {
+        return false;
+    }
+
+    // Every frame starts with a marker, so replayFrame can always read one at the offset it stopped at
+    size_t offset = EventLog::headerSize;
+    if (offset < log.size() && read<uint32_t>(log, offset) != EventLog::frameMarker) return false;
+
+    while (offset < log.size()) {
+        if (log.size() - offset < sizeof(uint32_t)) return false;
+
+        if (read<uint32_t>(log, offset) == EventLog::frameMarker) {
+            if (log.size() - offset < EventLog::frameMarkerSize) return false;
+            offset += EventLog::frameMarkerSize;
+        } else {
+            if (log.size() - offset < EventLog::eventHeaderSize) return false;
+            const auto size = read<uint32_t>(log, offset + sizeof(uint32_t));
+            if (log.size() - offset - EventLog::eventHeaderSize < size) return false;
+            offset += EventLog::eventHeaderSize + size;
+        }
+    }
+    return true;
+}
+
+std::optional<EventReplayer> EventReplayer::fromLog(const std::span<const std::byte> log) {
+    if (!validate(log)) return std::nullopt;
+    return EventReplayer({log.begin(), log.end()});
+}
+
+std::optional<EventReplayer> EventReplayer::load(const std::filesystem::path& path) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) return std::nullopt;
+
+    std::vector<std::byte> log(file.tellg());
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(log.data()), static_cast<std::streamsize>(log.size()));
+    if (!file.good() || !validate(log)) return std::nullopt;
+
+    return EventReplayer(std::move(log));
+}
+
+uint64_t EventReplayer::getNextFrame() const {
+    assert(!isFinished() && "There are no frames left to replay");
+    return read<uint64_t>(log, offset + sizeof(uint32_t));
+}
+
+size_t EventReplayer::replayFrame(EventBus& bus) {
+    if (isFinished()) return 0;
+
+    // validate guarantees a frame marker here
+    frame = getNextFrame();
+    offset += EventLog::frameMarkerSize;
+
+    size_t count = 0;
+    while (offset < log.size()) {
+        const auto typeHash = read<uint32_t>(log, offset);
+        if (typeHash == EventLog::frameMarker) break;
+
+        const auto size = read<uint32_t>(log, offset + sizeof(uint32_t));
+        offset += EventLog::eventHeaderSize;
+
+        eventBuffer.resize((size + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t));
+        std::memcpy(eventBuffer.data(), log.data() + offset, size);
+        offset += size;
+
+        bus.callEvent(typeHash, eventBuffer.data(), size);
+        ++count;
+    }
+    return count;
+}
+
+size_t EventReplayer::replayAll(EventBus& bus) {
+    size_t count = 0;
+    while (!isFinished()) count += replayFrame(bus);
+    return count;
+}
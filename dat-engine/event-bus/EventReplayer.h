@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "EventRecorder.h"
+
+namespace DatEngine::Events {
+    class EventBus;
+
+    /**
+     * Feeds an event log written by an EventRecorder back through an EventBus
+     * <br>
+     * Events are called on the bus a frame at a time, in the order they were recorded, regardless of how long the
+     * original frames took. Events are matched to listeners by their type hash, so the log must come from a build
+     * with the same event types.
+     */
+    class EventReplayer {
+        std::vector<std::byte> log;
+        /** The offset of the next frame marker in the log */
+        size_t offset = EventLog::headerSize;
+        /** The frame of the last frame replayed */
+        uint64_t frame = 0;
+        /** Aligned storage the next event is copied into, as the log isn't padded and listeners may modify events */
+        std::vector<std::max_align_t> eventBuffer;
+
+        explicit EventReplayer(std::vector<std::byte> log);
+
+        /**
+         * Check that a log has a valid header and that every record fits in it
+         */
+        static bool validate(std::span<const std::byte> log);
+
+    public:
+        /**
+         * Create a replayer for a log held in memory
+         *
+         * @param log The log to replay, like EventRecorder::getLog()
+         * @return The replayer, or nullopt if the log is invalid
+         */
+        static std::optional<EventReplayer> fromLog(std::span<const std::byte> log);
+
+        /**
+         * Create a replayer for a log saved to a file
+         *
+         * @param path The file to read
+         * @return The replayer, or nullopt if the file can't be read or isn't a valid log
+         */
+        static std::optional<EventReplayer> load(const std::filesystem::path& path);
+
+        /**
+         * Call the events of the next recorded frame on a bus
+         *
+         * @param bus The bus to call the events on
+         * @return The number of events called
+         */
+        size_t replayFrame(EventBus& bus);
+
+        /**
+         * Call every remaining event on a bus as fast as possible
+         *
+         * @param bus The bus to call the events on
+         * @return The number of events called
+         */
+        size_t replayAll(EventBus& bus);
+
+        /**
+         * Start replaying from the first frame again
+         */
+        void rewind() { offset = EventLog::headerSize; }
+
+        /**
+         * Check if every frame has been replayed
+         */
+        [[nodiscard]] bool isFinished() const { return offset >= log.size(); }
+
+        /**
+         * Get the recorded frame number of the last frame replayed
+         */
+        [[nodiscard]] uint64_t getFrame() const { return frame; }
+
+        /**
+         * Get the recorded frame number of the next frame to replay, to keep a bus's frames in step with the log
+         *
+         * @note The replay must not be finished
+         */
+        [[nodiscard]] uint64_t getNextFrame() const;
+    };
+} // namespace DatEngine::Events
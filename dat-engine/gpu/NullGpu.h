@@ -0,0 +1,27 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "IGpu.h"
+
+namespace DatEngine::DatGpu {
+    /**
+     * A renderer that draws nothing, for running the engine loop headless or in tests
+     */
+    class NullGpu final : public IGpu {
+        std::atomic<uint64_t> framesDrawn = 0;
+
+    public:
+        int getWindowFlags() override { return 0; }
+
+        void draw() override { framesDrawn.fetch_add(1, std::memory_order_relaxed); }
+
+        void cleanup() override {}
+
+        /**
+         * Get the number of times draw() has been called
+         */
+        [[nodiscard]] uint64_t getFramesDrawn() const { return framesDrawn.load(std::memory_order_relaxed); }
+    };
+} // namespace DatEngine::DatGpu
@@ -644,7 +644,7 @@ vk::Extent2D VulkanGPU::getWindowExtent(const vk::SurfaceCapabilitiesKHR& surfac
 /* -------------------------------------------- */
 
 vk::PresentModeKHR VulkanGPU::getIdealPresentMode() const {
-    const bool enableVsync = CVarSystem::get()->getBoolCVar("BEnableVsync");
+    const bool enableVsync = enableVsyncCVar.get();
     const auto availablePresentModes = physicalDevice.getSurfacePresentModesKHR(surface);
 
     for (const auto presentMode: availablePresentModes) {
@@ -9,6 +9,7 @@
 #include "VkTypes.h"
 
 #include <unordered_map>
+#include <util/CVar.h>
 
 namespace DatEngine::DatGpu::DatVk {
     class VulkanGPU : public IGpu {
@@ -64,6 +65,9 @@ namespace DatEngine::DatGpu::DatVk {
         /** Array of per frame data */
         FrameData* frameData = nullptr;
 
+        /** Whether to sync presenting to the display refresh, resolved once rather than looked up by name */
+        CVarRef<bool> enableVsyncCVar = "BEnableVsync"_cvar;
+
         // G-Buffers
         AllocatedImage drawImage;
         vk::Extent2D drawImageExtent = {};
@@ -0,0 +1,5 @@
+#pragma once
+
+#include "bounds/AABB.h"
+#include "bounds/BoundingSphere.h"
+#include "bounds/Frustum.h"
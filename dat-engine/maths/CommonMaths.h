@@ -1,5 +1,9 @@
 #pragma once
+#include <algorithm>
 #include <cmath>
+
+#include <maths/Constants.h>
+#include <maths/Simd.h>
 #include <util/TypeTraits.h>
 
 // Keep windows maths out of this
@@ -11,25 +15,275 @@
 #endif
 // TODO: Test min and max
 namespace DatEngine::DatMaths {
+    /**
+     * How accurate the approximated maths functions should be, trading accuracy for speed
+     * <br>
+     * The error bounds below are verified by the CommonMaths tests.
+     */
+    enum class Precision {
+        /**
+         * The cheapest approximations.
+         * <br>
+         * Square roots use rsqrt plus one Newton-Raphson step (relative error below 1e-6). Trig uses low order
+         * polynomials (absolute error below 1e-4).
+         */
+        Fast,
+
+        /**
+         * Hardware square roots and higher order trig polynomials (absolute error below 1e-6), still much faster
+         * than the standard library
+         */
+        Balanced,
+
+        /**
+         * The standard library implementations
+         */
+        Exact
+    };
+
+    namespace detail {
+        // Minimax coefficients for sin(x) = x * P(x^2) over [-pi / 2, pi / 2]
+        constexpr float sinFast[] = {9.996967716e-01f, -1.656730755e-01f, 7.514375540e-03f};
+        constexpr float sinBalanced[] = {9.999966159e-01f, -1.666482837e-01f, 8.306325148e-03f, -1.836365174e-04f};
+
+        // Minimax coefficients for atan(x) = x * P(x^2) over [0, 1]
+        constexpr float atanFast[] = {9.992138087e-01f, -3.211749253e-01f, 1.462643521e-01f, -3.898643756e-02f};
+        constexpr float atanBalanced[] = {
+                9.999993353e-01f, -3.332986001e-01f, 1.994655797e-01f,  -1.390859565e-01f,
+                9.642119488e-02f, -5.591136016e-02f, 2.186234176e-02f, -4.054409123e-03f
+        };
+
+        // 2 * pi split into 3 parts (Cody-Waite), the first two have few enough bits that multiplying them by the
+        // number of turns is exact, so range reduction doesn't lose precision
+        constexpr float doublePiA = 6.28125f;
+        constexpr float doublePiB = 1.93500518798828125e-3f;
+        constexpr float doublePiC = 3.01991598e-7f;
+        constexpr float invDoublePi = 0.159154943091895336f;
+
+        /**
+         * Evaluate x * P(x^2) using Horner's method
+         */
+        template<size_t terms>
+        float oddPolynomial(const float x, const float (&coefficients)[terms]) {
+            const float x2 = x * x;
+            float result = coefficients[terms - 1];
+            for (size_t i = terms - 1; i > 0; --i) {
+                result = result * x2 + coefficients[i - 1];
+            }
+            return result * x;
+        }
+
+        /**
+         * Reduce an angle to [-pi, pi]
+         */
+        inline float reduceAngle(const float value) {
+            const float turns = std::nearbyint(value * invDoublePi);
+            return value - turns * doublePiA - turns * doublePiB - turns * doublePiC;
+        }
+
+#ifdef DAT_SIMD_AVX
+        /**
+         * Reduce each lane to [-pi, pi]
+         */
+        inline __m256 reduceAngle(__m256 value) {
+            const __m256 turns = _mm256_round_ps(
+                    _mm256_mul_ps(value, _mm256_set1_ps(invDoublePi)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC
+            );
+            value = _mm256_sub_ps(value, _mm256_mul_ps(turns, _mm256_set1_ps(doublePiA)));
+            value = _mm256_sub_ps(value, _mm256_mul_ps(turns, _mm256_set1_ps(doublePiB)));
+            return _mm256_sub_ps(value, _mm256_mul_ps(turns, _mm256_set1_ps(doublePiC)));
+        }
+
+        /**
+         * Evaluate x * P(x^2) for each lane using Horner's method
+         */
+        template<size_t terms>
+        __m256 oddPolynomial(const __m256 x, const float (&coefficients)[terms]) {
+            const __m256 x2 = _mm256_mul_ps(x, x);
+            __m256 result = _mm256_set1_ps(coefficients[terms - 1]);
+            for (size_t i = terms - 1; i > 0; --i) {
+                result = Simd::multiplyAdd(result, x2, _mm256_set1_ps(coefficients[i - 1]));
+            }
+            return _mm256_mul_ps(result, x);
+        }
+
+        /**
+         * Apply a scalar function to each lane, used for the exact 8 wide variants
+         */
+        template<typename TFunc>
+        __m256 perLane(const __m256 value, TFunc func) {
+            alignas(32) float lanes[8];
+            _mm256_store_ps(lanes, value);
+            for (float& lane : lanes) {
+                lane = func(lane);
+            }
+            return _mm256_load_ps(lanes);
+        }
+#endif
+    } // namespace detail
+
     // If these aren't commented then it's because there's nothing to add with a comment
     /* -------------------------------------------- */
     /*  Square Root                                 */
     /* -------------------------------------------- */
 
-    float sqrt(float value);
+    /**
+     * Get the square root of a value
+     * <br>
+     * Only floats are approximated, other types always use the standard library.
+     *
+     * @tparam precision How accurate the result should be, Fast returns 0 for an input of 0
+     * @tparam T The type of the value
+     * @param value The value, must not be negative
+     * @return The square root of the value
+     */
+    template<Precision precision = Precision::Exact, TypeTraits::CNumeric T>
+    T sqrt(const T value) {
+#ifdef DAT_SIMD_SSE
+        if constexpr (std::is_same_v<T, float> && precision == Precision::Fast) {
+            // sqrt(x) = x * rsqrt(x), masked so that 0 doesn't become 0 * inf
+            const __m128 simd = _mm_set_ss(value);
+            const __m128 estimate = _mm_rsqrt_ss(simd);
+            const __m128 refined = _mm_mul_ss(
+                    _mm_mul_ss(_mm_set_ss(0.5f), estimate),
+                    _mm_sub_ss(_mm_set_ss(3.f), _mm_mul_ss(_mm_mul_ss(simd, estimate), estimate))
+            );
+            const __m128 result = _mm_mul_ss(simd, refined);
+            return _mm_cvtss_f32(_mm_and_ps(result, _mm_cmpneq_ss(simd, _mm_setzero_ps())));
+        } else if constexpr (std::is_same_v<T, float> && precision == Precision::Balanced) {
+            return _mm_cvtss_f32(_mm_sqrt_ss(_mm_set_ss(value)));
+        }
+#endif
+        return static_cast<T>(std::sqrt(value));
+    }
+
+    /**
+     * Get the inverse (1 / x) of the square root of a value
+     * <br>
+     * Only floats are approximated, other types always use the standard library.
+     *
+     * @tparam precision How accurate the result should be
+     * @tparam T The type of the value
+     * @param value The value, must be greater than 0
+     * @return The inverse square root of the value
+     */
+    template<Precision precision = Precision::Exact, TypeTraits::CNumeric T>
+    T invSqrt(const T value) {
+#ifdef DAT_SIMD_SSE
+        if constexpr (std::is_same_v<T, float> && precision == Precision::Fast) {
+            // One Newton-Raphson step: y = y * (3 - x * y * y) / 2
+            const __m128 simd = _mm_set_ss(value);
+            const __m128 estimate = _mm_rsqrt_ss(simd);
+            return _mm_cvtss_f32(_mm_mul_ss(
+                    _mm_mul_ss(_mm_set_ss(0.5f), estimate),
+                    _mm_sub_ss(_mm_set_ss(3.f), _mm_mul_ss(_mm_mul_ss(simd, estimate), estimate))
+            ));
+        } else if constexpr (std::is_same_v<T, float> && precision == Precision::Balanced) {
+            return _mm_cvtss_f32(_mm_div_ss(_mm_set_ss(1.f), _mm_sqrt_ss(_mm_set_ss(value))));
+        }
+#endif
+        return static_cast<T>(1 / std::sqrt(value));
+    }
+
+#ifdef DAT_SIMD_SSE
+    /**
+     * Get the inverse (1 / x) of the square root of 4 values at once
+     *
+     * @tparam precision How accurate the result should be
+     * @param value The values, must be greater than 0
+     * @return The inverse square root of each value
+     */
+    template<Precision precision = Precision::Exact>
+    __m128 invSqrt(const __m128 value) {
+        if constexpr (precision == Precision::Fast) {
+            const __m128 estimate = _mm_rsqrt_ps(value);
+            return _mm_mul_ps(
+                    _mm_mul_ps(_mm_set1_ps(0.5f), estimate),
+                    _mm_sub_ps(_mm_set1_ps(3.f), _mm_mul_ps(_mm_mul_ps(value, estimate), estimate))
+            );
+        } else {
+            return _mm_div_ps(_mm_set1_ps(1.f), _mm_sqrt_ps(value));
+        }
+    }
+#endif
+
+#ifdef DAT_SIMD_AVX
+    /**
+     * Get the square root of 8 values at once
+     *
+     * @tparam precision How accurate the result should be, Fast returns 0 for an input of 0
+     * @param value The values, must not be negative
+     * @return The square root of each value
+     */
+    template<Precision precision = Precision::Exact>
+    __m256 sqrt(const __m256 value) {
+        if constexpr (precision == Precision::Fast) {
+            const __m256 estimate = _mm256_rsqrt_ps(value);
+            const __m256 refined = _mm256_mul_ps(
+                    _mm256_mul_ps(_mm256_set1_ps(0.5f), estimate),
+                    _mm256_sub_ps(_mm256_set1_ps(3.f), _mm256_mul_ps(_mm256_mul_ps(value, estimate), estimate))
+            );
+            const __m256 result = _mm256_mul_ps(value, refined);
+            return _mm256_and_ps(result, _mm256_cmp_ps(value, _mm256_setzero_ps(), _CMP_NEQ_OQ));
+        } else {
+            return _mm256_sqrt_ps(value);
+        }
+    }
 
-    float invSqrt(float value);
+    /**
+     * Get the inverse (1 / x) of the square root of 8 values at once
+     *
+     * @tparam precision How accurate the result should be
+     * @param value The values, must be greater than 0
+     * @return The inverse square root of each value
+     */
+    template<Precision precision = Precision::Exact>
+    __m256 invSqrt(const __m256 value) {
+        if constexpr (precision == Precision::Fast) {
+            const __m256 estimate = _mm256_rsqrt_ps(value);
+            return _mm256_mul_ps(
+                    _mm256_mul_ps(_mm256_set1_ps(0.5f), estimate),
+                    _mm256_sub_ps(_mm256_set1_ps(3.f), _mm256_mul_ps(_mm256_mul_ps(value, estimate), estimate))
+            );
+        } else {
+            return _mm256_div_ps(_mm256_set1_ps(1.f), _mm256_sqrt_ps(value));
+        }
+    }
+#endif
 
     /* -------------------------------------------- */
     /*  Trigonometry                                */
     /* -------------------------------------------- */
 
-    // TODO: See if any of these can be approximated
-
-    // Sin
-    template<TypeTraits::CFloating T>
+    /**
+     * Get the sine of an angle
+     * <br>
+     * Only floats are approximated, other types always use the standard library. The approximations reduce the angle
+     * to [-pi, pi] first, so lose accuracy the same way std::sin does as the angle gets very large.
+     *
+     * @tparam precision How accurate the result should be
+     * @tparam T The type of the angle
+     * @param value The angle in radians
+     * @return The sine of the angle
+     */
+    template<Precision precision = Precision::Exact, TypeTraits::CFloating T>
     T sin(T value) {
-        return std::sin(value);
+        if constexpr (std::is_same_v<T, float> && precision != Precision::Exact) {
+            // Reduce to [-pi, pi], then fold into [-pi / 2, pi / 2] using sin(x) = sin(pi - x)
+            value = detail::reduceAngle(value);
+
+            // The fold can go slightly negative just past pi, so flip the sign rather than copying it
+            const float folded = std::min(std::abs(value), constants::pi - std::abs(value));
+            value = value < 0 ? -folded : folded;
+
+            if constexpr (precision == Precision::Fast) {
+                return detail::oddPolynomial(value, detail::sinFast);
+            } else {
+                return detail::oddPolynomial(value, detail::sinBalanced);
+            }
+        } else {
+            return std::sin(value);
+        }
     }
 
     template<TypeTraits::CFloating T>
@@ -37,10 +291,30 @@ namespace DatEngine::DatMaths {
         return std::asin(value);
     }
 
-    // Cos
-    template<TypeTraits::CFloating T>
+    /**
+     * Get the cosine of an angle
+     * <br>
+     * Only floats are approximated, other types always use the standard library. The approximations reduce the angle
+     * to [-pi, pi] and then evaluate @code sin(pi / 2 - abs(value))@endcode.
+     *
+     * @tparam precision How accurate the result should be
+     * @tparam T The type of the angle
+     * @param value The angle in radians
+     * @return The cosine of the angle
+     */
+    template<Precision precision = Precision::Exact, TypeTraits::CFloating T>
     T cos(T value) {
-        return std::cos(value);
+        if constexpr (std::is_same_v<T, float> && precision != Precision::Exact) {
+            value = constants::halfPi - std::abs(detail::reduceAngle(value));
+
+            if constexpr (precision == Precision::Fast) {
+                return detail::oddPolynomial(value, detail::sinFast);
+            } else {
+                return detail::oddPolynomial(value, detail::sinBalanced);
+            }
+        } else {
+            return std::cos(value);
+        }
     }
 
     template<TypeTraits::CFloating T>
@@ -59,10 +333,148 @@ namespace DatEngine::DatMaths {
         return std::atan(value);
     }
 
-    template<TypeTraits::CFloating T>
-    T atan2(T x, T y) {
-        return std::atan2(x, y);
+    /**
+     * Get the angle between the positive X axis and the point (x, y), the same as std::atan2
+     * <br>
+     * Only floats are approximated, other types always use the standard library.
+     *
+     * @tparam precision How accurate the result should be
+     * @tparam T The type of the coordinates
+     * @param y The Y coordinate of the point
+     * @param x The X coordinate of the point
+     * @return The angle in radians, in the range [-pi, pi]
+     */
+    template<Precision precision = Precision::Exact, TypeTraits::CFloating T>
+    T atan2(T y, T x) {
+        if constexpr (std::is_same_v<T, float> && precision != Precision::Exact) {
+            // Reduce to atan over [0, 1], then use the symmetries of atan to get back to the right octant
+            const float absX = std::abs(x);
+            const float absY = std::abs(y);
+            const float biggest = std::max(absX, absY);
+            const float ratio = biggest == 0 ? 0 : std::min(absX, absY) / biggest;
+
+            float result;
+            if constexpr (precision == Precision::Fast) {
+                result = detail::oddPolynomial(ratio, detail::atanFast);
+            } else {
+                result = detail::oddPolynomial(ratio, detail::atanBalanced);
+            }
+
+            if (absY > absX) {
+                result = constants::halfPi - result;
+            }
+            if (x < 0) {
+                result = constants::pi - result;
+            }
+            return std::copysign(result, y);
+        } else {
+            return std::atan2(y, x);
+        }
+    }
+
+#ifdef DAT_SIMD_AVX
+    /**
+     * Get the sine of 8 angles at once
+     * @see sin()
+     *
+     * @tparam precision How accurate the result should be
+     * @param value The angles in radians
+     * @return The sine of each angle
+     */
+    template<Precision precision = Precision::Exact>
+    __m256 sin(__m256 value) {
+        if constexpr (precision == Precision::Exact) {
+            return detail::perLane(value, [](const float lane) { return std::sin(lane); });
+        } else {
+            const __m256 signMask = _mm256_set1_ps(-0.f);
+            value = detail::reduceAngle(value);
+
+            const __m256 sign = _mm256_and_ps(value, signMask);
+            const __m256 absValue = _mm256_andnot_ps(signMask, value);
+            const __m256 folded = _mm256_min_ps(absValue, _mm256_sub_ps(_mm256_set1_ps(constants::pi), absValue));
+            value = _mm256_xor_ps(folded, sign);
+
+            if constexpr (precision == Precision::Fast) {
+                return detail::oddPolynomial(value, detail::sinFast);
+            } else {
+                return detail::oddPolynomial(value, detail::sinBalanced);
+            }
+        }
+    }
+
+    /**
+     * Get the cosine of 8 angles at once
+     * @see cos()
+     *
+     * @tparam precision How accurate the result should be
+     * @param value The angles in radians
+     * @return The cosine of each angle
+     */
+    template<Precision precision = Precision::Exact>
+    __m256 cos(__m256 value) {
+        if constexpr (precision == Precision::Exact) {
+            return detail::perLane(value, [](const float lane) { return std::cos(lane); });
+        } else {
+            const __m256 absValue = _mm256_andnot_ps(_mm256_set1_ps(-0.f), detail::reduceAngle(value));
+            value = _mm256_sub_ps(_mm256_set1_ps(constants::halfPi), absValue);
+
+            if constexpr (precision == Precision::Fast) {
+                return detail::oddPolynomial(value, detail::sinFast);
+            } else {
+                return detail::oddPolynomial(value, detail::sinBalanced);
+            }
+        }
+    }
+
+    /**
+     * Get the angle between the positive X axis and 8 points at once
+     * @see atan2()
+     *
+     * @tparam precision How accurate the result should be
+     * @param y The Y coordinates of the points
+     * @param x The X coordinates of the points
+     * @return The angle of each point in radians, in the range [-pi, pi]
+     */
+    template<Precision precision = Precision::Exact>
+    __m256 atan2(const __m256 y, const __m256 x) {
+        if constexpr (precision == Precision::Exact) {
+            alignas(32) float yLanes[8];
+            alignas(32) float xLanes[8];
+            _mm256_store_ps(yLanes, y);
+            _mm256_store_ps(xLanes, x);
+            for (int i = 0; i < 8; ++i) {
+                yLanes[i] = std::atan2(yLanes[i], xLanes[i]);
+            }
+            return _mm256_load_ps(yLanes);
+        } else {
+            const __m256 signMask = _mm256_set1_ps(-0.f);
+            const __m256 zero = _mm256_setzero_ps();
+            const __m256 absX = _mm256_andnot_ps(signMask, x);
+            const __m256 absY = _mm256_andnot_ps(signMask, y);
+            const __m256 biggest = _mm256_max_ps(absX, absY);
+
+            // Mask out the 0 / 0 when both coordinates are 0
+            __m256 ratio = _mm256_div_ps(_mm256_min_ps(absX, absY), biggest);
+            ratio = _mm256_and_ps(ratio, _mm256_cmp_ps(biggest, zero, _CMP_NEQ_OQ));
+
+            __m256 result;
+            if constexpr (precision == Precision::Fast) {
+                result = detail::oddPolynomial(ratio, detail::atanFast);
+            } else {
+                result = detail::oddPolynomial(ratio, detail::atanBalanced);
+            }
+
+            result = _mm256_blendv_ps(
+                    result, _mm256_sub_ps(_mm256_set1_ps(constants::halfPi), result),
+                    _mm256_cmp_ps(absY, absX, _CMP_GT_OQ)
+            );
+            result = _mm256_blendv_ps(
+                    result, _mm256_sub_ps(_mm256_set1_ps(constants::pi), result), _mm256_cmp_ps(x, zero, _CMP_LT_OQ)
+            );
+            return _mm256_or_ps(result, _mm256_and_ps(y, signMask));
+        }
     }
+#endif
 
     /* -------------------------------------------- */
     /*  Interpolation                               */
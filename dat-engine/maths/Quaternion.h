@@ -2,4 +2,10 @@
 
 #include "quaternion/Quat.h"
 
-namespace DatEngine::DatMaths {}
+namespace DatEngine::DatMaths {
+    /** A floating point quaternion */
+    using quat = Quaternion<float>;
+
+    /** A double precision floating point quaternion */
+    using dquat = Quaternion<double>;
+} // namespace DatEngine::DatMaths
@@ -0,0 +1,247 @@
+/*
+ * Compile time selection of the SIMD instruction sets used by DatMaths
+ *
+ * The instruction sets are detected from the flags the engine is compiled with (-march=native or /arch:AVX), and can
+ * be forced off by defining DAT_ENGINE_NO_SIMD (the DAT_ENGINE_ENABLE_SIMD CMake option), in which case every maths
+ * type falls back to its scalar implementation.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#if !defined(DAT_ENGINE_NO_SIMD) && (defined(__SSE4_1__) || defined(__AVX__))
+#define DAT_SIMD_SSE 1
+#endif
+
+#if defined(DAT_SIMD_SSE) && defined(__AVX__)
+#define DAT_SIMD_AVX 1
+#endif
+
+#if defined(DAT_SIMD_AVX) && defined(__AVX2__) && defined(__FMA__)
+#define DAT_SIMD_AVX2 1
+#endif
+
+#ifdef DAT_SIMD_SSE
+#include <immintrin.h>
+#endif
+
+namespace DatEngine::DatMaths::Simd {
+    /** Whether the SSE (up to 4.1) paths are compiled in */
+#ifdef DAT_SIMD_SSE
+    constexpr bool sse = true;
+#else
+    constexpr bool sse = false;
+#endif
+
+    /** Whether the 8 wide AVX paths are compiled in */
+#ifdef DAT_SIMD_AVX
+    constexpr bool avx = true;
+#else
+    constexpr bool avx = false;
+#endif
+
+    /** Whether the AVX2 + FMA paths are compiled in */
+#ifdef DAT_SIMD_AVX2
+    constexpr bool avx2 = true;
+#else
+    constexpr bool avx2 = false;
+#endif
+
+    /**
+     * The number of floats processed per iteration by the widest enabled instruction set
+     */
+    constexpr size_t floatLanes = avx ? 8 : (sse ? 4 : 1);
+
+    /**
+     * Concept for testing if a vector operation between two component types can use the float SIMD paths
+     *
+     * @tparam TComponent The component type of the vector being operated on
+     * @tparam TOther The component type of the other operand
+     */
+    template<typename TComponent, typename TOther = TComponent>
+    concept CSimdFloat = sse && std::is_same_v<TComponent, float> && std::is_same_v<TOther, float>;
+
+    /**
+     * The alignment required by a 4 component vector of the given type
+     *
+     * Float vectors are aligned to 16 bytes so they can be loaded directly into an SSE register. This is applied
+     * regardless of whether SIMD is enabled so the layout doesn't change between scalar and SIMD builds.
+     *
+     * @tparam TComponent The type of the components of the vector
+     */
+    template<typename TComponent>
+    constexpr size_t vec4Alignment = std::is_same_v<TComponent, float> ? 16 : alignof(TComponent);
+
+#ifdef DAT_SIMD_SSE
+    /**
+     * Load 3 contiguous floats into the lower lanes of an SSE register, the top lane is zeroed
+     *
+     * Unlike _mm_loadu_ps this will not read past the end of the 3 floats
+     *
+     * @param src The address of the first float
+     * @return The register containing {src[0], src[1], src[2], 0}
+     */
+    inline __m128 load3(const float* src) {
+        // __m64 is declared may_alias, unlike double, so this is safe to use on float members
+        const __m128 xy = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(src));
+        const __m128 z = _mm_load_ss(src + 2);
+        return _mm_movelh_ps(xy, z);
+    }
+
+    /**
+     * Store the lower 3 lanes of an SSE register into 3 contiguous floats
+     *
+     * @param dst The address of the first float
+     * @param value The register to store
+     */
+    inline void store3(float* dst, const __m128 value) {
+        _mm_storel_pi(reinterpret_cast<__m64*>(dst), value);
+        _mm_store_ss(dst + 2, _mm_movehl_ps(value, value));
+    }
+
+    /**
+     * Get the sum of all 4 lanes of an SSE register, broadcast to every lane
+     *
+     * @param value The register to sum
+     * @return A register where every lane holds the horizontal sum
+     */
+    inline __m128 horizontalSum(const __m128 value) {
+        const __m128 swapped = _mm_shuffle_ps(value, value, _MM_SHUFFLE(2, 3, 0, 1));
+        const __m128 pairs = _mm_add_ps(value, swapped);
+        return _mm_add_ps(pairs, _mm_shuffle_ps(pairs, pairs, _MM_SHUFFLE(1, 0, 3, 2)));
+    }
+
+    /**
+     * Get the absolute value of each lane of an SSE register
+     *
+     * @param value The register
+     * @return The register with the sign bit of every lane cleared
+     */
+    inline __m128 abs(const __m128 value) { return _mm_andnot_ps(_mm_set1_ps(-0.f), value); }
+#endif
+
+#ifdef DAT_SIMD_AVX
+    /**
+     * Load 8 contiguous vec3s and deinterleave them into a register per component
+     * <br>
+     * Source: https://www.intel.com/content/dam/develop/external/us/en/documents/normvec-181650.pdf
+     *
+     * @param src The address of the x component of the first vector
+     * @param x The register to write the x components to
+     * @param y The register to write the y components to
+     * @param z The register to write the z components to
+     */
+    inline void loadVec3x8(const float* src, __m256& x, __m256& y, __m256& z) {
+        __m256 m03 = _mm256_castps128_ps256(_mm_loadu_ps(src));
+        __m256 m14 = _mm256_castps128_ps256(_mm_loadu_ps(src + 4));
+        __m256 m25 = _mm256_castps128_ps256(_mm_loadu_ps(src + 8));
+        m03 = _mm256_insertf128_ps(m03, _mm_loadu_ps(src + 12), 1);
+        m14 = _mm256_insertf128_ps(m14, _mm_loadu_ps(src + 16), 1);
+        m25 = _mm256_insertf128_ps(m25, _mm_loadu_ps(src + 20), 1);
+
+        const __m256 xy = _mm256_shuffle_ps(m14, m25, _MM_SHUFFLE(2, 1, 3, 2));
+        const __m256 yz = _mm256_shuffle_ps(m03, m14, _MM_SHUFFLE(1, 0, 2, 1));
+        x = _mm256_shuffle_ps(m03, xy, _MM_SHUFFLE(2, 0, 3, 0));
+        y = _mm256_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+        z = _mm256_shuffle_ps(yz, m25, _MM_SHUFFLE(3, 0, 3, 1));
+    }
+
+    /**
+     * Interleave a register per component back into 8 contiguous vec3s, the inverse of loadVec3x8()
+     *
+     * @param dst The address of the x component of the first vector
+     * @param x The x components
+     * @param y The y components
+     * @param z The z components
+     */
+    inline void storeVec3x8(float* dst, const __m256 x, const __m256 y, const __m256 z) {
+        const __m256 xy = _mm256_shuffle_ps(x, y, _MM_SHUFFLE(2, 0, 2, 0));
+        const __m256 yz = _mm256_shuffle_ps(y, z, _MM_SHUFFLE(3, 1, 3, 1));
+        const __m256 zx = _mm256_shuffle_ps(z, x, _MM_SHUFFLE(3, 1, 2, 0));
+
+        const __m256 r03 = _mm256_shuffle_ps(xy, zx, _MM_SHUFFLE(2, 0, 2, 0));
+        const __m256 r14 = _mm256_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+        const __m256 r25 = _mm256_shuffle_ps(zx, yz, _MM_SHUFFLE(3, 1, 3, 1));
+
+        _mm_storeu_ps(dst, _mm256_castps256_ps128(r03));
+        _mm_storeu_ps(dst + 4, _mm256_castps256_ps128(r14));
+        _mm_storeu_ps(dst + 8, _mm256_castps256_ps128(r25));
+        _mm_storeu_ps(dst + 12, _mm256_extractf128_ps(r03, 1));
+        _mm_storeu_ps(dst + 16, _mm256_extractf128_ps(r14, 1));
+        _mm_storeu_ps(dst + 20, _mm256_extractf128_ps(r25, 1));
+    }
+
+    /**
+     * Load 8 contiguous 4 component vectors (or quaternions) and transpose them into a register per component
+     *
+     * @param src The address of the first component of the first vector
+     * @param x The register to write the first components to
+     * @param y The register to write the second components to
+     * @param z The register to write the third components to
+     * @param w The register to write the fourth components to
+     */
+    inline void loadVec4x8(const float* src, __m256& x, __m256& y, __m256& z, __m256& w) {
+        // Vectors i and i + 4 share a register so the in lane unpacks produce the components in order
+        const auto loadPair = [src](const int low, const int high) {
+            return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(src + low)), _mm_loadu_ps(src + high), 1);
+        };
+        const __m256 m0 = loadPair(0, 16);
+        const __m256 m1 = loadPair(4, 20);
+        const __m256 m2 = loadPair(8, 24);
+        const __m256 m3 = loadPair(12, 28);
+
+        const __m256 xy01 = _mm256_unpacklo_ps(m0, m1);
+        const __m256 xy23 = _mm256_unpacklo_ps(m2, m3);
+        const __m256 zw01 = _mm256_unpackhi_ps(m0, m1);
+        const __m256 zw23 = _mm256_unpackhi_ps(m2, m3);
+
+        x = _mm256_shuffle_ps(xy01, xy23, _MM_SHUFFLE(1, 0, 1, 0));
+        y = _mm256_shuffle_ps(xy01, xy23, _MM_SHUFFLE(3, 2, 3, 2));
+        z = _mm256_shuffle_ps(zw01, zw23, _MM_SHUFFLE(1, 0, 1, 0));
+        w = _mm256_shuffle_ps(zw01, zw23, _MM_SHUFFLE(3, 2, 3, 2));
+    }
+
+    /**
+     * Transpose a register per component back into 8 contiguous 4 component vectors, the inverse of loadVec4x8()
+     *
+     * @param dst The address of the first component of the first vector
+     * @param x The first components
+     * @param y The second components
+     * @param z The third components
+     * @param w The fourth components
+     */
+    inline void storeVec4x8(float* dst, const __m256 x, const __m256 y, const __m256 z, const __m256 w) {
+        const __m256 xy02 = _mm256_unpacklo_ps(x, y);
+        const __m256 zw02 = _mm256_unpacklo_ps(z, w);
+        const __m256 xy13 = _mm256_unpackhi_ps(x, y);
+        const __m256 zw13 = _mm256_unpackhi_ps(z, w);
+
+        const __m256 r04 = _mm256_shuffle_ps(xy02, zw02, _MM_SHUFFLE(1, 0, 1, 0));
+        const __m256 r15 = _mm256_shuffle_ps(xy02, zw02, _MM_SHUFFLE(3, 2, 3, 2));
+        const __m256 r26 = _mm256_shuffle_ps(xy13, zw13, _MM_SHUFFLE(1, 0, 1, 0));
+        const __m256 r37 = _mm256_shuffle_ps(xy13, zw13, _MM_SHUFFLE(3, 2, 3, 2));
+
+        _mm_storeu_ps(dst, _mm256_castps256_ps128(r04));
+        _mm_storeu_ps(dst + 4, _mm256_castps256_ps128(r15));
+        _mm_storeu_ps(dst + 8, _mm256_castps256_ps128(r26));
+        _mm_storeu_ps(dst + 12, _mm256_castps256_ps128(r37));
+        _mm_storeu_ps(dst + 16, _mm256_extractf128_ps(r04, 1));
+        _mm_storeu_ps(dst + 20, _mm256_extractf128_ps(r15, 1));
+        _mm_storeu_ps(dst + 24, _mm256_extractf128_ps(r26, 1));
+        _mm_storeu_ps(dst + 28, _mm256_extractf128_ps(r37, 1));
+    }
+
+    /**
+     * Compute @code a * b + c@endcode for each lane, fused when FMA is available
+     */
+    inline __m256 multiplyAdd(const __m256 a, const __m256 b, const __m256 c) {
+#ifdef DAT_SIMD_AVX2
+        return _mm256_fmadd_ps(a, b, c);
+#else
+        return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#endif
+    }
+#endif
+} // namespace DatEngine::DatMaths::Simd
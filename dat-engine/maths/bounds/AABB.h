@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cmath>
+
+#include <maths/Matrix.h>
+
+namespace DatEngine::DatMaths {
+    /**
+     * An axis aligned bounding box
+     */
+    struct AABB {
+        /** The corner of the box with the smallest components */
+        vec3 min;
+
+        /** The corner of the box with the biggest components */
+        vec3 max;
+
+        /* -------------------------------------------- */
+        /*  Initialisation                              */
+        /* -------------------------------------------- */
+
+        /**
+         * Initialises an empty box at the origin
+         */
+        AABB() = default;
+
+        /**
+         * Initialises the box from its corners
+         * @param min The corner of the box with the smallest components
+         * @param max The corner of the box with the biggest components
+         */
+        AABB(const vec3& min, const vec3& max) : min(min), max(max) {}
+
+        /**
+         * Create a box from its centre and extents
+         * @param centre The centre of the box
+         * @param extents The distance from the centre to each face (half the size)
+         * @return The box
+         */
+        static AABB fromCentreExtents(const vec3& centre, const vec3& extents) {
+            return {centre - extents, centre + extents};
+        }
+
+        /* -------------------------------------------- */
+        /*  Getters                                     */
+        /* -------------------------------------------- */
+
+        /**
+         * Get the centre of the box
+         * @return The centre
+         */
+        [[nodiscard]] vec3 getCentre() const { return (min + max) * 0.5f; }
+
+        /**
+         * Get the distance from the centre of the box to each face (half the size)
+         * @return The extents
+         */
+        [[nodiscard]] vec3 getExtents() const { return (max - min) * 0.5f; }
+
+        /* -------------------------------------------- */
+        /*  Tests                                       */
+        /* -------------------------------------------- */
+
+        /**
+         * Test if a point is inside the box, points on a face are inside
+         * @param point The point to test
+         * @return true if the point is inside
+         */
+        [[nodiscard]] bool contains(const vec3& point) const {
+            return point.x >= min.x && point.y >= min.y && point.z >= min.z && point.x <= max.x && point.y <= max.y &&
+                   point.z <= max.z;
+        }
+
+        /**
+         * Test if two boxes overlap, touching boxes overlap
+         * @param other The other box
+         * @return true if the boxes overlap
+         */
+        [[nodiscard]] bool intersects(const AABB& other) const {
+            return min.x <= other.max.x && min.y <= other.max.y && min.z <= other.max.z && max.x >= other.min.x &&
+                   max.y >= other.min.y && max.z >= other.min.z;
+        }
+
+        /* -------------------------------------------- */
+        /*  Modification                                */
+        /* -------------------------------------------- */
+
+        /**
+         * Grow the box to include a point
+         * @param point The point to include
+         */
+        void expand(const vec3& point) {
+            min = {DatMaths::min(min.x, point.x), DatMaths::min(min.y, point.y), DatMaths::min(min.z, point.z)};
+            max = {DatMaths::max(max.x, point.x), DatMaths::max(max.y, point.y), DatMaths::max(max.z, point.z)};
+        }
+
+        /**
+         * Grow the box to include another box
+         * @param other The box to include
+         */
+        void expand(const AABB& other) {
+            expand(other.min);
+            expand(other.max);
+        }
+
+        /**
+         * Get the box that bounds this box after it has been transformed
+         * <br>
+         * Source: Jim Arvo, Transforming Axis-Aligned Bounding Boxes, Graphics Gems (1990)
+         *
+         * @param matrix The affine transform to apply
+         * @return The box containing the transformed box, which may be bigger than the transformed box itself
+         */
+        [[nodiscard]] AABB transformed(const mat4& matrix) const {
+            const vec3 centre = vec3(matrix * vec4(getCentre(), 1));
+            const vec3 extents = getExtents();
+
+            vec3 newExtents;
+            for (int row = 0; row < 3; ++row) {
+                newExtents[row] = std::abs(matrix[0][row]) * extents.x + std::abs(matrix[1][row]) * extents.y +
+                                  std::abs(matrix[2][row]) * extents.z;
+            }
+            return fromCentreExtents(centre, newExtents);
+        }
+    };
+} // namespace DatEngine::DatMaths
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <maths/bounds/AABB.h>
+
+namespace DatEngine::DatMaths {
+    /**
+     * A bounding sphere
+     */
+    struct BoundingSphere {
+        /** The centre of the sphere */
+        vec3 centre;
+
+        /** The radius of the sphere */
+        float radius = 0;
+
+        /* -------------------------------------------- */
+        /*  Initialisation                              */
+        /* -------------------------------------------- */
+
+        /**
+         * Initialises a sphere at the origin with a radius of 0
+         */
+        BoundingSphere() = default;
+
+        /**
+         * Initialises the sphere from its centre and radius
+         * @param centre The centre of the sphere
+         * @param radius The radius of the sphere
+         */
+        BoundingSphere(const vec3& centre, const float radius) : centre(centre), radius(radius) {}
+
+        /**
+         * Create the smallest sphere centred on a box that contains it
+         * @param box The box to contain
+         * @return The sphere
+         */
+        static BoundingSphere fromAABB(const AABB& box) { return {box.getCentre(), box.getExtents().length()}; }
+
+        /* -------------------------------------------- */
+        /*  Tests                                       */
+        /* -------------------------------------------- */
+
+        /**
+         * Test if a point is inside the sphere, points on the surface are inside
+         * @param point The point to test
+         * @return true if the point is inside
+         */
+        [[nodiscard]] bool contains(const vec3& point) const {
+            return (point - centre).lengthSquared() <= radius * radius;
+        }
+
+        /**
+         * Test if two spheres overlap, touching spheres overlap
+         * @param other The other sphere
+         * @return true if the spheres overlap
+         */
+        [[nodiscard]] bool intersects(const BoundingSphere& other) const {
+            const float radii = radius + other.radius;
+            return (other.centre - centre).lengthSquared() <= radii * radii;
+        }
+
+        /**
+         * Test if the sphere overlaps a box
+         * @param box The box
+         * @return true if the sphere and box overlap
+         */
+        [[nodiscard]] bool intersects(const AABB& box) const {
+            const vec3 closest = {
+                    DatMaths::clamp(centre.x, box.min.x, box.max.x), DatMaths::clamp(centre.y, box.min.y, box.max.y),
+                    DatMaths::clamp(centre.z, box.min.z, box.max.z)
+            };
+            return contains(closest);
+        }
+    };
+} // namespace DatEngine::DatMaths
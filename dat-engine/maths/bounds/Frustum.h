@@ -0,0 +1,119 @@
+#pragma once
+
+#include <array>
+
+#include <maths/bounds/AABB.h>
+#include <maths/bounds/BoundingSphere.h>
+
+namespace DatEngine::DatMaths {
+    /**
+     * A view frustum, stored as six planes facing inwards
+     * <br>
+     * Each plane is stored as a vec4 of its normal and distance, a point p is on the inside of a plane when
+     * @code dot(plane.xyz, p) + plane.w >= 0@endcode. The normals are normalised, so this is the signed distance.
+     */
+    struct Frustum {
+        /** The indices of each plane in planes */
+        enum Plane { Left, Right, Bottom, Top, Near, Far, PlaneCount };
+
+        /** The planes of the frustum, indexed by Plane */
+        std::array<vec4, PlaneCount> planes;
+
+        /* -------------------------------------------- */
+        /*  Initialisation                              */
+        /* -------------------------------------------- */
+
+        /**
+         * Extract the frustum planes from a view-projection matrix
+         * <br>
+         * Source: Gil Gribb and Klaus Hartmann, Fast Extraction of Viewing Frustum Planes from the
+         * World-View-Projection Matrix (2001)
+         *
+         * @param viewProjection The combined view and projection matrix, the planes are in the space it transforms from
+         * @param zeroToOneDepth Whether the projection maps depth to [0, 1] like Vulkan, rather than [-1, 1] like
+         *                       OpenGL
+         */
+        explicit Frustum(const mat4& viewProjection, const bool zeroToOneDepth = true) {
+            const vec4 row0 = viewProjection.getRow(0);
+            const vec4 row1 = viewProjection.getRow(1);
+            const vec4 row2 = viewProjection.getRow(2);
+            const vec4 row3 = viewProjection.getRow(3);
+
+            planes[Left] = row3 + row0;
+            planes[Right] = row3 - row0;
+            planes[Bottom] = row3 + row1;
+            planes[Top] = row3 - row1;
+            planes[Near] = zeroToOneDepth ? row2 : row3 + row2;
+            planes[Far] = row3 - row2;
+
+            for (vec4& plane : planes) {
+                plane = plane / vec3(plane).length();
+            }
+        }
+
+        /* -------------------------------------------- */
+        /*  Tests                                       */
+        /* -------------------------------------------- */
+
+        /**
+         * Get the signed distance from a plane to a point, positive on the inside
+         * @param plane The plane
+         * @param point The point
+         * @return The signed distance
+         */
+        [[nodiscard]] float distance(const Plane plane, const vec3& point) const {
+            const vec4& p = planes[plane];
+            return p.x * point.x + p.y * point.y + p.z * point.z + p.w;
+        }
+
+        /**
+         * Test if a point is inside the frustum
+         * @param point The point to test
+         * @return true if the point is inside every plane
+         */
+        [[nodiscard]] bool contains(const vec3& point) const {
+            for (int i = 0; i < PlaneCount; ++i) {
+                if (distance(static_cast<Plane>(i), point) < 0)
+                    return false;
+            }
+            return true;
+        }
+
+        /**
+         * Test if a sphere is at least partially inside the frustum
+         * @param sphere The sphere to test
+         * @return false if the sphere is definitely outside, true otherwise
+         */
+        [[nodiscard]] bool intersects(const BoundingSphere& sphere) const {
+            for (int i = 0; i < PlaneCount; ++i) {
+                if (distance(static_cast<Plane>(i), sphere.centre) < -sphere.radius)
+                    return false;
+            }
+            return true;
+        }
+
+        /**
+         * Test if a box is at least partially inside the frustum
+         * <br>
+         * Boxes near the corners of the frustum can be reported as intersecting when they are outside, which is fine
+         * for culling.
+         *
+         * @param box The box to test
+         * @return false if the box is definitely outside, true otherwise
+         */
+        [[nodiscard]] bool intersects(const AABB& box) const {
+            const vec3 centre = box.getCentre();
+            const vec3 extents = box.getExtents();
+
+            for (int i = 0; i < PlaneCount; ++i) {
+                // The projection of the extents onto the plane normal, i.e. the "radius" of the box along it
+                const vec4& plane = planes[i];
+                const float radius = std::abs(plane.x) * extents.x + std::abs(plane.y) * extents.y +
+                                     std::abs(plane.z) * extents.z;
+                if (distance(static_cast<Plane>(i), centre) < -radius)
+                    return false;
+            }
+            return true;
+        }
+    };
+} // namespace DatEngine::DatMaths
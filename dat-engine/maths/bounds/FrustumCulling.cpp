@@ -0,0 +1,153 @@
+#include "FrustumCulling.h"
+
+#include <algorithm>
+#include <cassert>
+
+using namespace DatEngine;
+using namespace DatEngine::DatMaths;
+
+namespace {
+    /**
+     * Set or clear bit i of the mask
+     */
+    void writeBit(const std::span<uint64_t> visibility, const size_t i, const bool visible) {
+        const uint64_t bit = uint64_t{1} << (i % 64);
+        visibility[i / 64] = visible ? visibility[i / 64] | bit : visibility[i / 64] & ~bit;
+    }
+
+#ifdef DAT_SIMD_AVX
+    /**
+     * A frustum plane broadcast across a register per component, along with the absolute values of its normal
+     */
+    struct PlaneX8 {
+        __m256 x, y, z, w;
+        __m256 absX, absY, absZ;
+    };
+
+    std::array<PlaneX8, Frustum::PlaneCount> broadcastPlanes(const Frustum& frustum) {
+        std::array<PlaneX8, Frustum::PlaneCount> planes;
+        for (int i = 0; i < Frustum::PlaneCount; ++i) {
+            const vec4& plane = frustum.planes[i];
+            planes[i] = {
+                    _mm256_set1_ps(plane.x),
+                    _mm256_set1_ps(plane.y),
+                    _mm256_set1_ps(plane.z),
+                    _mm256_set1_ps(plane.w),
+                    _mm256_set1_ps(std::abs(plane.x)),
+                    _mm256_set1_ps(std::abs(plane.y)),
+                    _mm256_set1_ps(std::abs(plane.z))
+            };
+        }
+        return planes;
+    }
+
+    /**
+     * Get the signed distance from a plane to 8 points
+     */
+    __m256 distanceX8(const PlaneX8& plane, const __m256 x, const __m256 y, const __m256 z) {
+        __m256 distance = Simd::multiplyAdd(plane.x, x, plane.w);
+        distance = Simd::multiplyAdd(plane.y, y, distance);
+        return Simd::multiplyAdd(plane.z, z, distance);
+    }
+
+    /**
+     * Write the 8 bits of a visibility movemask, i must be a multiple of 8 so the bits don't straddle a word
+     */
+    void writeBits8(const std::span<uint64_t> visibility, const size_t i, const int bits) {
+        const size_t shift = i % 64;
+        uint64_t& word = visibility[i / 64];
+        word = (word & ~(uint64_t{0xFF} << shift)) | (static_cast<uint64_t>(bits) << shift);
+    }
+#endif
+} // namespace
+
+/* -------------------------------------------- */
+/*  Spheres                                     */
+/* -------------------------------------------- */
+
+void DatMaths::cullSpheres(
+        const Frustum& frustum, const Vec3SoA& centres, const std::span<const float> radii,
+        const std::span<uint64_t> visibility
+) {
+    const size_t count = centres.count();
+    assert(radii.size() == count);
+    assert(visibility.size() >= visibilityMaskSize(count));
+
+    // Clear the whole mask first so the unused bits in the last word are 0
+    std::fill_n(visibility.begin(), visibilityMaskSize(count), 0);
+
+    const float* x = centres.x().data();
+    const float* y = centres.y().data();
+    const float* z = centres.z().data();
+
+    size_t i = 0;
+#ifdef DAT_SIMD_AVX
+    const std::array<PlaneX8, Frustum::PlaneCount> planes = broadcastPlanes(frustum);
+    const __m256 signMask = _mm256_set1_ps(-0.f);
+
+    for (; i + 8 <= count; i += 8) {
+        const __m256 centreX = _mm256_loadu_ps(x + i);
+        const __m256 centreY = _mm256_loadu_ps(y + i);
+        const __m256 centreZ = _mm256_loadu_ps(z + i);
+        const __m256 negativeRadius = _mm256_xor_ps(_mm256_loadu_ps(radii.data() + i), signMask);
+
+        // A sphere is outside when it's further than its radius behind any plane
+        __m256 outside = _mm256_setzero_ps();
+        for (const PlaneX8& plane : planes) {
+            const __m256 distance = distanceX8(plane, centreX, centreY, centreZ);
+            outside = _mm256_or_ps(outside, _mm256_cmp_ps(distance, negativeRadius, _CMP_LT_OQ));
+        }
+        writeBits8(visibility, i, ~_mm256_movemask_ps(outside) & 0xFF);
+    }
+#endif
+    // Tail, or everything when AVX isn't available
+    for (; i < count; ++i) {
+        writeBit(visibility, i, frustum.intersects(BoundingSphere({x[i], y[i], z[i]}, radii[i])));
+    }
+}
+
+/* -------------------------------------------- */
+/*  AABBs                                       */
+/* -------------------------------------------- */
+
+void DatMaths::cullAABBs(
+        const Frustum& frustum, const Vec3SoA& centres, const Vec3SoA& extents, const std::span<uint64_t> visibility
+) {
+    const size_t count = centres.count();
+    assert(extents.count() == count);
+    assert(visibility.size() >= visibilityMaskSize(count));
+
+    std::fill_n(visibility.begin(), visibilityMaskSize(count), 0);
+
+    size_t i = 0;
+#ifdef DAT_SIMD_AVX
+    const std::array<PlaneX8, Frustum::PlaneCount> planes = broadcastPlanes(frustum);
+
+    for (; i + 8 <= count; i += 8) {
+        const __m256 centreX = _mm256_loadu_ps(centres.x().data() + i);
+        const __m256 centreY = _mm256_loadu_ps(centres.y().data() + i);
+        const __m256 centreZ = _mm256_loadu_ps(centres.z().data() + i);
+        const __m256 extentX = _mm256_loadu_ps(extents.x().data() + i);
+        const __m256 extentY = _mm256_loadu_ps(extents.y().data() + i);
+        const __m256 extentZ = _mm256_loadu_ps(extents.z().data() + i);
+
+        // A box is outside when its centre is further behind any plane than the box's radius along that plane
+        __m256 outside = _mm256_setzero_ps();
+        for (const PlaneX8& plane : planes) {
+            __m256 radius = _mm256_mul_ps(plane.absX, extentX);
+            radius = Simd::multiplyAdd(plane.absY, extentY, radius);
+            radius = Simd::multiplyAdd(plane.absZ, extentZ, radius);
+
+            // distance + radius < 0
+            const __m256 distance = distanceX8(plane, centreX, centreY, centreZ);
+            outside = _mm256_or_ps(
+                    outside, _mm256_cmp_ps(_mm256_add_ps(distance, radius), _mm256_setzero_ps(), _CMP_LT_OQ)
+            );
+        }
+        writeBits8(visibility, i, ~_mm256_movemask_ps(outside) & 0xFF);
+    }
+#endif
+    for (; i < count; ++i) {
+        writeBit(visibility, i, frustum.intersects(AABB::fromCentreExtents(centres.get(i), extents.get(i))));
+    }
+}
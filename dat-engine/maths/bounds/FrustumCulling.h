@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+#include <maths/bounds/Frustum.h>
+#include <maths/vector/VecSoA.h>
+
+namespace DatEngine::DatMaths {
+    /**
+     * Get the number of 64 bit words needed for a visibility mask of a number of objects
+     * @param count The number of objects
+     * @return The number of words
+     */
+    constexpr size_t visibilityMaskSize(const size_t count) { return (count + 63) / 64; }
+
+    /**
+     * Test a stream of bounding spheres against a frustum
+     * <br>
+     * Bit @code i % 64@endcode of @code visibility[i / 64]@endcode is set if sphere i is at least partially inside
+     * the frustum, and cleared otherwise. Unused bits in the last word are cleared.
+     *
+     * @note When AVX is available, 8 spheres are tested against every plane per iteration.
+     *
+     * @param frustum The frustum to test against
+     * @param centres The centres of the spheres
+     * @param radii The radius of each sphere, must be the same size as \p centres
+     * @param visibility The mask to write, must hold at least @code visibilityMaskSize(centres.count())@endcode words
+     */
+    void cullSpheres(
+            const Frustum& frustum, const Vec3SoA& centres, std::span<const float> radii,
+            std::span<uint64_t> visibility
+    );
+
+    /**
+     * Test a stream of axis aligned bounding boxes against a frustum
+     * <br>
+     * The mask is laid out the same as cullSpheres(). Like Frustum::intersects(const AABB&), boxes near the corners of
+     * the frustum may be reported visible when they're outside.
+     *
+     * @param frustum The frustum to test against
+     * @param centres The centres of the boxes
+     * @param extents The extents (half the size) of each box, must be the same size as \p centres
+     * @param visibility The mask to write, must hold at least @code visibilityMaskSize(centres.count())@endcode words
+     */
+    void cullAABBs(
+            const Frustum& frustum, const Vec3SoA& centres, const Vec3SoA& extents, std::span<uint64_t> visibility
+    );
+} // namespace DatEngine::DatMaths
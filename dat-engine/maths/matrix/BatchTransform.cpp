@@ -0,0 +1,121 @@
+#include "BatchTransform.h"
+
+#include <cassert>
+
+using namespace DatEngine;
+using namespace DatEngine::DatMaths;
+
+namespace {
+#ifdef DAT_SIMD_AVX
+    /**
+     * Compute one row of the transform for 8 vectors held as a register per component
+     */
+    __m256 transformRow(
+            const mat4& matrix, const int row, const __m256 x, const __m256 y, const __m256 z, const bool isPoint
+    ) {
+        __m256 result = _mm256_mul_ps(_mm256_set1_ps(matrix[0][row]), x);
+        result = _mm256_add_ps(result, _mm256_mul_ps(_mm256_set1_ps(matrix[1][row]), y));
+        result = _mm256_add_ps(result, _mm256_mul_ps(_mm256_set1_ps(matrix[2][row]), z));
+        return isPoint ? _mm256_add_ps(result, _mm256_set1_ps(matrix[3][row])) : result;
+    }
+#endif
+
+    /**
+     * Transform a span of vec3s, treating each as having a W component of 1 for points and 0 for directions
+     */
+    void transformVec3(const mat4& matrix, std::span<const vec3> in, std::span<vec3> out, const bool isPoint) {
+        assert(out.size() >= in.size());
+
+        size_t i = 0;
+#ifdef DAT_SIMD_AVX
+        for (; i + 8 <= in.size(); i += 8) {
+            __m256 x, y, z;
+            Simd::loadVec3x8(&in[i].x, x, y, z);
+
+            const __m256 outX = transformRow(matrix, 0, x, y, z, isPoint);
+            const __m256 outY = transformRow(matrix, 1, x, y, z, isPoint);
+            const __m256 outZ = transformRow(matrix, 2, x, y, z, isPoint);
+
+            Simd::storeVec3x8(&out[i].x, outX, outY, outZ);
+        }
+#endif
+        // Tail, or everything when AVX isn't available
+        const float w = isPoint ? 1.f : 0.f;
+        for (; i < in.size(); ++i) {
+            out[i] = vec3(matrix * vec4(in[i], w));
+        }
+    }
+} // namespace
+
+/* -------------------------------------------- */
+/*  Single Matrix                               */
+/* -------------------------------------------- */
+
+void DatMaths::transformPoints(const mat4& matrix, const std::span<const vec3> in, const std::span<vec3> out) {
+    transformVec3(matrix, in, out, true);
+}
+
+void DatMaths::transformDirections(const mat4& matrix, const std::span<const vec3> in, const std::span<vec3> out) {
+    transformVec3(matrix, in, out, false);
+}
+
+void DatMaths::transform(const mat4& matrix, const std::span<const vec4> in, const std::span<vec4> out) {
+    assert(out.size() >= in.size());
+
+    size_t i = 0;
+#ifdef DAT_SIMD_AVX
+    // Each 128 bit lane holds one vector, so every instruction transforms 2 vectors
+    const __m256 column0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&matrix[0].x));
+    const __m256 column1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&matrix[1].x));
+    const __m256 column2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&matrix[2].x));
+    const __m256 column3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&matrix[3].x));
+
+    const auto transformPair = [&](const float* src, float* dst) {
+        const __m256 vec = _mm256_loadu_ps(src);
+        __m256 result = _mm256_mul_ps(column0, _mm256_shuffle_ps(vec, vec, _MM_SHUFFLE(0, 0, 0, 0)));
+        result = _mm256_add_ps(result, _mm256_mul_ps(column1, _mm256_shuffle_ps(vec, vec, _MM_SHUFFLE(1, 1, 1, 1))));
+        result = _mm256_add_ps(result, _mm256_mul_ps(column2, _mm256_shuffle_ps(vec, vec, _MM_SHUFFLE(2, 2, 2, 2))));
+        result = _mm256_add_ps(result, _mm256_mul_ps(column3, _mm256_shuffle_ps(vec, vec, _MM_SHUFFLE(3, 3, 3, 3))));
+        _mm256_storeu_ps(dst, result);
+    };
+
+    for (; i + 8 <= in.size(); i += 8) {
+        transformPair(&in[i].x, &out[i].x);
+        transformPair(&in[i + 2].x, &out[i + 2].x);
+        transformPair(&in[i + 4].x, &out[i + 4].x);
+        transformPair(&in[i + 6].x, &out[i + 6].x);
+    }
+
+    for (; i + 2 <= in.size(); i += 2) {
+        transformPair(&in[i].x, &out[i].x);
+    }
+#endif
+    // Tail, or everything when AVX isn't available
+    for (; i < in.size(); ++i) {
+        out[i] = matrix * in[i];
+    }
+}
+
+/* -------------------------------------------- */
+/*  Instanced                                   */
+/* -------------------------------------------- */
+
+void DatMaths::transformPointsInstanced(
+        const std::span<const mat4> matrices, const std::span<const vec3> in, const std::span<vec3> out
+) {
+    assert(out.size() >= matrices.size() * in.size());
+
+    for (size_t i = 0; i < matrices.size(); ++i) {
+        transformVec3(matrices[i], in, out.subspan(i * in.size(), in.size()), true);
+    }
+}
+
+void DatMaths::transformInstanced(
+        const std::span<const mat4> matrices, const std::span<const vec4> in, const std::span<vec4> out
+) {
+    assert(out.size() >= matrices.size() * in.size());
+
+    for (size_t i = 0; i < matrices.size(); ++i) {
+        transform(matrices[i], in, out.subspan(i * in.size(), in.size()));
+    }
+}
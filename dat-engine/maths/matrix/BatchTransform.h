@@ -0,0 +1,80 @@
+#pragma once
+
+#include <span>
+
+#include <maths/Matrix.h>
+
+namespace DatEngine::DatMaths {
+    /* -------------------------------------------- */
+    /*  Single Matrix                               */
+    /* -------------------------------------------- */
+
+    /**
+     * Transform a span of points by a matrix, treating each point as having a W component of 1
+     * <br>
+     * The W component of the result is discarded, so no perspective divide is performed.
+     *
+     * @note When AVX is available, 8 points are transformed per iteration, with any remainder transformed one at a
+     *       time.
+     *
+     * @param matrix The matrix to transform the points by
+     * @param in The points to transform
+     * @param out Where to write the transformed points, must be at least as big as \p in. May be the same span as
+     *            \p in, but must not otherwise overlap it
+     */
+    void transformPoints(const mat4& matrix, std::span<const vec3> in, std::span<vec3> out);
+
+    /**
+     * Transform a span of directions by a matrix, treating each direction as having a W component of 0
+     * <br>
+     * This ignores the translation of the matrix, the result is not re-normalised.
+     *
+     * @param matrix The matrix to transform the directions by
+     * @param in The directions to transform
+     * @param out Where to write the transformed directions, must be at least as big as \p in. May be the same span as
+     *            \p in, but must not otherwise overlap it
+     */
+    void transformDirections(const mat4& matrix, std::span<const vec3> in, std::span<vec3> out);
+
+    /**
+     * Transform a span of vectors by a matrix
+     *
+     * @note When AVX is available, 2 vectors are transformed per instruction, 8 per iteration.
+     *
+     * @param matrix The matrix to transform the vectors by
+     * @param in The vectors to transform
+     * @param out Where to write the transformed vectors, must be at least as big as \p in. May be the same span as
+     *            \p in, but must not otherwise overlap it
+     */
+    void transform(const mat4& matrix, std::span<const vec4> in, std::span<vec4> out);
+
+    /* -------------------------------------------- */
+    /*  Instanced                                   */
+    /* -------------------------------------------- */
+
+    /**
+     * Transform a span of points by every matrix in a span of instance matrices
+     * <br>
+     * The points transformed by instance @code i@endcode are written to
+     * @code out[i * in.size()]@endcode to @code out[(i + 1) * in.size() - 1]@endcode.
+     *
+     * @param matrices The instance matrices to transform the points by
+     * @param in The points to transform
+     * @param out Where to write the transformed points, must be at least @code matrices.size() * in.size()@endcode
+     *            big and must not overlap \p in
+     */
+    void transformPointsInstanced(std::span<const mat4> matrices, std::span<const vec3> in, std::span<vec3> out);
+
+    /**
+     * Transform a span of vectors by every matrix in a span of instance matrices
+     * <br>
+     * The vectors transformed by instance @code i@endcode are written to
+     * @code out[i * in.size()]@endcode to @code out[(i + 1) * in.size() - 1]@endcode.
+     *
+     * @param matrices The instance matrices to transform the vectors by
+     * @param in The vectors to transform
+     * @param out Where to write the transformed vectors, must be at least @code matrices.size() * in.size()@endcode
+     *            big and must not overlap \p in
+     */
+    void transformInstanced(std::span<const mat4> matrices, std::span<const vec4> in, std::span<vec4> out);
+} // namespace DatEngine::DatMaths
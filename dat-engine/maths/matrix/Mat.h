@@ -6,6 +6,159 @@
 #include <maths/vector/VecForward.h>
 
 namespace DatEngine::DatMaths {
+#ifdef DAT_SIMD_SSE
+    namespace detail {
+        /**
+         * Multiply two column major mat4s of floats
+         *
+         * @param lh The 16 cells of the left hand matrix, aligned to 16 bytes
+         * @param rh The 16 cells of the right hand matrix, aligned to 16 bytes
+         * @param out The 16 cells to write the product to, must not alias either input
+         */
+        inline void multiplyMat4(const float* lh, const float* rh, float* out) {
+#ifdef DAT_SIMD_AVX
+            // Two result columns per iteration, each 128 bit lane broadcasts its own column's components
+            const __m256 lh0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(lh));
+            const __m256 lh1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(lh + 4));
+            const __m256 lh2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(lh + 8));
+            const __m256 lh3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(lh + 12));
+
+            for (int i = 0; i < 16; i += 8) {
+                const __m256 columns = _mm256_loadu_ps(rh + i);
+                __m256 result = _mm256_mul_ps(lh0, _mm256_shuffle_ps(columns, columns, _MM_SHUFFLE(0, 0, 0, 0)));
+                result = _mm256_add_ps(
+                        result, _mm256_mul_ps(lh1, _mm256_shuffle_ps(columns, columns, _MM_SHUFFLE(1, 1, 1, 1)))
+                );
+                result = _mm256_add_ps(
+                        result, _mm256_mul_ps(lh2, _mm256_shuffle_ps(columns, columns, _MM_SHUFFLE(2, 2, 2, 2)))
+                );
+                result = _mm256_add_ps(
+                        result, _mm256_mul_ps(lh3, _mm256_shuffle_ps(columns, columns, _MM_SHUFFLE(3, 3, 3, 3)))
+                );
+                _mm256_storeu_ps(out + i, result);
+            }
+#else
+            const __m128 lh0 = _mm_load_ps(lh);
+            const __m128 lh1 = _mm_load_ps(lh + 4);
+            const __m128 lh2 = _mm_load_ps(lh + 8);
+            const __m128 lh3 = _mm_load_ps(lh + 12);
+
+            for (int i = 0; i < 16; i += 4) {
+                const __m128 column = _mm_load_ps(rh + i);
+                __m128 result = _mm_mul_ps(lh0, _mm_shuffle_ps(column, column, _MM_SHUFFLE(0, 0, 0, 0)));
+                result = _mm_add_ps(result, _mm_mul_ps(lh1, _mm_shuffle_ps(column, column, _MM_SHUFFLE(1, 1, 1, 1))));
+                result = _mm_add_ps(result, _mm_mul_ps(lh2, _mm_shuffle_ps(column, column, _MM_SHUFFLE(2, 2, 2, 2))));
+                result = _mm_add_ps(result, _mm_mul_ps(lh3, _mm_shuffle_ps(column, column, _MM_SHUFFLE(3, 3, 3, 3))));
+                _mm_store_ps(out + i, result);
+            }
+#endif
+        }
+
+        /**
+         * Multiply two 2x2 matrices packed into SSE registers as {m00, m01, m10, m11}
+         */
+        inline __m128 mat2Multiply(const __m128 lh, const __m128 rh) {
+            return _mm_add_ps(
+                    _mm_mul_ps(lh, _mm_shuffle_ps(rh, rh, _MM_SHUFFLE(3, 0, 3, 0))),
+                    _mm_mul_ps(
+                            _mm_shuffle_ps(lh, lh, _MM_SHUFFLE(2, 3, 0, 1)),
+                            _mm_shuffle_ps(rh, rh, _MM_SHUFFLE(1, 2, 1, 2))
+                    )
+            );
+        }
+
+        /**
+         * Multiply the adjugate of a packed 2x2 matrix by another packed 2x2 matrix
+         */
+        inline __m128 mat2AdjugateMultiply(const __m128 lh, const __m128 rh) {
+            return _mm_sub_ps(
+                    _mm_mul_ps(_mm_shuffle_ps(lh, lh, _MM_SHUFFLE(0, 0, 3, 3)), rh),
+                    _mm_mul_ps(
+                            _mm_shuffle_ps(lh, lh, _MM_SHUFFLE(2, 2, 1, 1)),
+                            _mm_shuffle_ps(rh, rh, _MM_SHUFFLE(1, 0, 3, 2))
+                    )
+            );
+        }
+
+        /**
+         * Multiply a packed 2x2 matrix by the adjugate of another packed 2x2 matrix
+         */
+        inline __m128 mat2MultiplyAdjugate(const __m128 lh, const __m128 rh) {
+            return _mm_sub_ps(
+                    _mm_mul_ps(lh, _mm_shuffle_ps(rh, rh, _MM_SHUFFLE(0, 3, 0, 3))),
+                    _mm_mul_ps(
+                            _mm_shuffle_ps(lh, lh, _MM_SHUFFLE(2, 3, 0, 1)),
+                            _mm_shuffle_ps(rh, rh, _MM_SHUFFLE(1, 2, 1, 2))
+                    )
+            );
+        }
+
+        /**
+         * Invert a column major mat4 of floats using the 2x2 block matrix method
+         * <br>
+         * Source: https://lxjk.github.io/2017/09/03/Fast-4x4-Matrix-Inverse-with-SSE-SIMD-Explained.html
+         *
+         * @param in The 16 cells of the matrix to invert, aligned to 16 bytes
+         * @param out The 16 cells to write the inverse to, aligned to 16 bytes
+         */
+        inline void inverseMat4(const float* in, float* out) {
+            const __m128 column0 = _mm_load_ps(in);
+            const __m128 column1 = _mm_load_ps(in + 4);
+            const __m128 column2 = _mm_load_ps(in + 8);
+            const __m128 column3 = _mm_load_ps(in + 12);
+
+            // 2x2 sub matrices
+            const __m128 a = _mm_movelh_ps(column0, column1);
+            const __m128 b = _mm_movehl_ps(column1, column0);
+            const __m128 c = _mm_movelh_ps(column2, column3);
+            const __m128 d = _mm_movehl_ps(column3, column2);
+
+            // Determinants of the sub matrices as {|A|, |B|, |C|, |D|}
+            const __m128 subDeterminants = _mm_sub_ps(
+                    _mm_mul_ps(
+                            _mm_shuffle_ps(column0, column2, _MM_SHUFFLE(2, 0, 2, 0)),
+                            _mm_shuffle_ps(column1, column3, _MM_SHUFFLE(3, 1, 3, 1))
+                    ),
+                    _mm_mul_ps(
+                            _mm_shuffle_ps(column0, column2, _MM_SHUFFLE(3, 1, 3, 1)),
+                            _mm_shuffle_ps(column1, column3, _MM_SHUFFLE(2, 0, 2, 0))
+                    )
+            );
+            const __m128 detA = _mm_shuffle_ps(subDeterminants, subDeterminants, _MM_SHUFFLE(0, 0, 0, 0));
+            const __m128 detB = _mm_shuffle_ps(subDeterminants, subDeterminants, _MM_SHUFFLE(1, 1, 1, 1));
+            const __m128 detC = _mm_shuffle_ps(subDeterminants, subDeterminants, _MM_SHUFFLE(2, 2, 2, 2));
+            const __m128 detD = _mm_shuffle_ps(subDeterminants, subDeterminants, _MM_SHUFFLE(3, 3, 3, 3));
+
+            const __m128 dAdjC = mat2AdjugateMultiply(d, c);
+            const __m128 aAdjB = mat2AdjugateMultiply(a, b);
+
+            // Adjugates of the blocks of the inverse
+            __m128 x = _mm_sub_ps(_mm_mul_ps(detD, a), mat2Multiply(b, dAdjC));
+            __m128 w = _mm_sub_ps(_mm_mul_ps(detA, d), mat2Multiply(c, aAdjB));
+            __m128 y = _mm_sub_ps(_mm_mul_ps(detB, c), mat2MultiplyAdjugate(d, aAdjB));
+            __m128 z = _mm_sub_ps(_mm_mul_ps(detC, b), mat2MultiplyAdjugate(a, dAdjC));
+
+            // |M| = |A||D| + |B||C| - tr((A#B)(D#C))
+            __m128 trace = _mm_mul_ps(aAdjB, _mm_shuffle_ps(dAdjC, dAdjC, _MM_SHUFFLE(3, 1, 2, 0)));
+            trace = _mm_hadd_ps(trace, trace);
+            trace = _mm_hadd_ps(trace, trace);
+            const __m128 det = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), trace);
+
+            const __m128 invDet = _mm_div_ps(_mm_setr_ps(1.f, -1.f, -1.f, 1.f), det);
+            x = _mm_mul_ps(x, invDet);
+            y = _mm_mul_ps(y, invDet);
+            z = _mm_mul_ps(z, invDet);
+            w = _mm_mul_ps(w, invDet);
+
+            // Apply the adjugate shuffle and recombine the blocks
+            _mm_store_ps(out, _mm_shuffle_ps(x, y, _MM_SHUFFLE(1, 3, 1, 3)));
+            _mm_store_ps(out + 4, _mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 2, 0, 2)));
+            _mm_store_ps(out + 8, _mm_shuffle_ps(z, w, _MM_SHUFFLE(1, 3, 1, 3)));
+            _mm_store_ps(out + 12, _mm_shuffle_ps(z, w, _MM_SHUFFLE(0, 2, 0, 2)));
+        }
+    } // namespace detail
+#endif
+
     /**
      * A type representing a matrix of variable height and width
      * <br>
@@ -69,7 +222,7 @@ namespace DatEngine::DatMaths {
 
             for (int i = 0; i < TWidth; ++i) {
                 for (int j = 0; j < THeight; ++j) {
-                    cells[i][j] = elements[i * TWidth + j];
+                    cells[i][j] = elements[i * THeight + j];
                 }
             }
         };
@@ -184,7 +337,7 @@ namespace DatEngine::DatMaths {
         // Getter
         TColumn& operator[](const size_t pos) { return getColumn(pos); }
 
-        TColumn& operator[](const size_t pos) const { return getColumn(pos); }
+        const TColumn& operator[](const size_t pos) const { return getColumn(pos); }
 
         /**
          * Get a column of the matrix
@@ -209,7 +362,7 @@ namespace DatEngine::DatMaths {
          * @param pos The index of the column to get
          * @return The column at the given position
          */
-        TColumn& getColumn(const size_t pos) const {
+        const TColumn& getColumn(const size_t pos) const {
             assert(pos < TWidth);
             return cells[pos];
         }
@@ -232,20 +385,423 @@ namespace DatEngine::DatMaths {
             return row;
         }
 
-        // Maths
-        //   Add
-        //   Minus
+        /* -------------------------------------------- */
+        /*  Maths                                       */
+        /* -------------------------------------------- */
+
         //   Multiply
-        //   Divide
+        /**
+         * Multiply this matrix by another matrix
+         * <br>
+         * When the product is used to transform a vector, \p rhs is applied first, followed by this matrix.
+         *
+         * @note mat4s of floats use SSE (or AVX when available). Matrices up to 4 wide are expressed as column operations
+         *       on the vector types, all other sizes use a slower generic loop.
+         *
+         * @tparam otherWidth The width of the other Matrix
+         * @param rhs The Matrix to multiply by, its height must match the width of this Matrix
+         * @return The product of the two matrices
+         */
+        template<int otherWidth>
+        Matrix<otherWidth, THeight, TComponent> operator*(const Matrix<otherWidth, TWidth, TComponent>& rhs) const {
+            Matrix<otherWidth, THeight, TComponent> result;
+#ifdef DAT_SIMD_SSE
+            if constexpr (Simd::CSimdFloat<TComponent> && TWidth == 4 && THeight == 4 && otherWidth == 4) {
+                detail::multiplyMat4(&cells[0].x, &rhs[0].x, &result[0].x);
+                return result;
+            }
+#endif
+            if constexpr (TWidth <= 4) {
+                for (int i = 0; i < otherWidth; ++i) {
+                    result[i] = *this * rhs[i];
+                }
+            } else {
+                for (int i = 0; i < otherWidth; ++i) {
+                    for (int k = 0; k < TWidth; ++k) {
+                        const TComponent scale = rhs[i][k];
+                        for (int j = 0; j < THeight; ++j) {
+                            result[i][j] += cells[k][j] * scale;
+                        }
+                    }
+                }
+            }
+
+            return result;
+        }
+
+        /**
+         * Multiply a vector by this matrix
+         *
+         * @param vec The vector to transform, it must have as many components as the Matrix has columns
+         * @return The transformed vector
+         */
+        TColumn operator*(const TRow& vec) const {
+#ifdef DAT_SIMD_SSE
+            if constexpr (Simd::CSimdFloat<TComponent> && TWidth == 4 && THeight == 4) {
+                const __m128 simd = vec.toSimd();
+                __m128 result = _mm_mul_ps(cells[0].toSimd(), _mm_shuffle_ps(simd, simd, _MM_SHUFFLE(0, 0, 0, 0)));
+                result = _mm_add_ps(
+                        result, _mm_mul_ps(cells[1].toSimd(), _mm_shuffle_ps(simd, simd, _MM_SHUFFLE(1, 1, 1, 1)))
+                );
+                result = _mm_add_ps(
+                        result, _mm_mul_ps(cells[2].toSimd(), _mm_shuffle_ps(simd, simd, _MM_SHUFFLE(2, 2, 2, 2)))
+                );
+                result = _mm_add_ps(
+                        result, _mm_mul_ps(cells[3].toSimd(), _mm_shuffle_ps(simd, simd, _MM_SHUFFLE(3, 3, 3, 3)))
+                );
+                return TColumn(result);
+            }
+#endif
+            if constexpr (TWidth == 1) {
+                return cells[0] * vec.x;
+            } else if constexpr (TWidth == 2) {
+                return cells[0] * vec.x + cells[1] * vec.y;
+            } else if constexpr (TWidth == 3) {
+                return cells[0] * vec.x + cells[1] * vec.y + cells[2] * vec.z;
+            } else if constexpr (TWidth == 4) {
+                return cells[0] * vec.x + cells[1] * vec.y + cells[2] * vec.z + cells[3] * vec.w;
+            } else {
+                TColumn result;
+                for (int i = 0; i < TWidth; ++i) {
+                    for (int j = 0; j < THeight; ++j) {
+                        result[j] += cells[i][j] * vec[i];
+                    }
+                }
+
+                return result;
+            }
+        }
+
+        /**
+         * Multiply every cell of the matrix by a scalar
+         *
+         * @param scalar The value to multiply each cell by
+         * @return The scaled Matrix
+         */
+        Matrix operator*(const TComponent scalar) const {
+            Matrix result;
+            for (int i = 0; i < TWidth; ++i) {
+                result.cells[i] = cells[i] * scalar;
+            }
+
+            return result;
+        }
+
+        // Multiply by Matrix In-Place
+        Matrix& operator*=(const Matrix& rhs)
+            requires(TWidth == THeight)
+        {
+            return *this = *this * rhs;
+        }
+
+        // Multiply by Scalar In-Place
+        Matrix& operator*=(const TComponent scalar) {
+            for (int i = 0; i < TWidth; ++i) {
+                cells[i] *= scalar;
+            }
+
+            return *this;
+        }
+
+        /* -------------------------------------------- */
+        /*  Transpose                                   */
+        /* -------------------------------------------- */
+
+        /**
+         * Get a copy of this matrix with the rows and columns swapped
+         *
+         * @return The transposed Matrix
+         */
+        TTranspose transposed() const {
+            TTranspose result;
+#ifdef DAT_SIMD_SSE
+            if constexpr (Simd::CSimdFloat<TComponent> && TWidth == 4 && THeight == 4) {
+                __m128 column0 = cells[0].toSimd();
+                __m128 column1 = cells[1].toSimd();
+                __m128 column2 = cells[2].toSimd();
+                __m128 column3 = cells[3].toSimd();
+                _MM_TRANSPOSE4_PS(column0, column1, column2, column3);
+
+                result[0] = TColumn(column0);
+                result[1] = TColumn(column1);
+                result[2] = TColumn(column2);
+                result[3] = TColumn(column3);
+                return result;
+            }
+#endif
+            for (int i = 0; i < TWidth; ++i) {
+                for (int j = 0; j < THeight; ++j) {
+                    result[j][i] = cells[i][j];
+                }
+            }
+
+            return result;
+        }
+
+        /* -------------------------------------------- */
+        /*  Determinant                                 */
+        /* -------------------------------------------- */
+
+        /**
+         * Get the determinant of the matrix
+         *
+         * @note mat1 to mat4 have closed form implementations, all other sizes use gaussian elimination with partial
+         *       pivoting, which is only meaningful for floating point matrices.
+         *
+         * @return The determinant of the Matrix
+         */
+        TComponent determinant() const
+            requires(TWidth == THeight)
+        {
+            if constexpr (TWidth == 1) {
+                return cells[0].x;
+            } else if constexpr (TWidth == 2) {
+                return cells[0].x * cells[1].y - cells[1].x * cells[0].y;
+            } else if constexpr (TWidth == 3) {
+                // Scalar triple product
+                return cells[0].dotProduct(cells[1].crossProduct(cells[2]));
+            } else if constexpr (TWidth == 4) {
+                // Laplace expansion using the 2x2 determinants of the first two and last two columns
+                const Vector<4, TComponent>& a = cells[0];
+                const Vector<4, TComponent>& b = cells[1];
+                const Vector<4, TComponent>& c = cells[2];
+                const Vector<4, TComponent>& d = cells[3];
+
+                const TComponent s0 = a.x * b.y - b.x * a.y;
+                const TComponent s1 = a.x * b.z - b.x * a.z;
+                const TComponent s2 = a.x * b.w - b.x * a.w;
+                const TComponent s3 = a.y * b.z - b.y * a.z;
+                const TComponent s4 = a.y * b.w - b.y * a.w;
+                const TComponent s5 = a.z * b.w - b.z * a.w;
+
+                const TComponent c5 = c.z * d.w - d.z * c.w;
+                const TComponent c4 = c.y * d.w - d.y * c.w;
+                const TComponent c3 = c.y * d.z - d.y * c.z;
+                const TComponent c2 = c.x * d.w - d.x * c.w;
+                const TComponent c1 = c.x * d.z - d.x * c.z;
+                const TComponent c0 = c.x * d.y - d.x * c.y;
+
+                return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+            } else {
+                // Slow fallback, reduce a copy to upper triangular form and multiply the diagonal
+                Matrix reduced = *this;
+                TComponent result = 1;
 
-        // Transpose
+                for (int col = 0; col < TWidth; ++col) {
+                    const int pivot = reduced.findPivotRow(col);
+                    if (reduced[col][pivot] == 0)
+                        return 0;
+
+                    if (pivot != col) {
+                        reduced.swapRows(col, pivot);
+                        result = -result;
+                    }
+
+                    const TComponent pivotValue = reduced[col][col];
+                    result *= pivotValue;
+
+                    for (int row = col + 1; row < THeight; ++row) {
+                        const TComponent factor = reduced[col][row] / pivotValue;
+                        for (int i = col; i < TWidth; ++i) {
+                            reduced[i][row] -= factor * reduced[i][col];
+                        }
+                    }
+                }
+
+                return result;
+            }
+        }
+
+        /* -------------------------------------------- */
+        /*  Inverse                                     */
+        /* -------------------------------------------- */
+
+        /**
+         * Get the inverse of the matrix
+         * <br>
+         * The result is undefined when the matrix is singular (has a determinant of 0), check the determinant first if
+         * the matrix may not be invertible.
+         *
+         * @note mat4s of floats use SSE, mat2 to mat4 have closed form implementations, all other sizes use Gauss-Jordan
+         *       elimination with partial pivoting.
+         *
+         * @return The inverse of the Matrix
+         */
+        Matrix inverse() const
+            requires(TWidth == THeight && TypeTraits::CFloating<TComponent>)
+        {
+            Matrix result;
+#ifdef DAT_SIMD_SSE
+            if constexpr (Simd::CSimdFloat<TComponent> && TWidth == 4) {
+                detail::inverseMat4(&cells[0].x, &result.cells[0].x);
+                return result;
+            }
+#endif
+            if constexpr (TWidth == 1) {
+                result.cells[0].x = 1 / cells[0].x;
+            } else if constexpr (TWidth == 2) {
+                const TComponent invDet = 1 / determinant();
+                result.cells[0] = TColumn(cells[1].y, -cells[0].y) * invDet;
+                result.cells[1] = TColumn(-cells[1].x, cells[0].x) * invDet;
+            } else if constexpr (TWidth == 3) {
+                // The rows of the inverse are the cross products of the columns, scaled by the determinant
+                const TColumn row0 = cells[1].crossProduct(cells[2]);
+                const TColumn row1 = cells[2].crossProduct(cells[0]);
+                const TColumn row2 = cells[0].crossProduct(cells[1]);
+                const TComponent invDet = 1 / cells[0].dotProduct(row0);
+
+                result.cells[0] = TColumn(row0.x, row1.x, row2.x) * invDet;
+                result.cells[1] = TColumn(row0.y, row1.y, row2.y) * invDet;
+                result.cells[2] = TColumn(row0.z, row1.z, row2.z) * invDet;
+            } else if constexpr (TWidth == 4) {
+                // Cofactors from the same 2x2 determinants as determinant(), inverse(transpose) == transpose(inverse)
+                // so these can be applied to columns as if they were rows
+                const TColumn& a = cells[0];
+                const TColumn& b = cells[1];
+                const TColumn& c = cells[2];
+                const TColumn& d = cells[3];
+
+                const TComponent s0 = a.x * b.y - b.x * a.y;
+                const TComponent s1 = a.x * b.z - b.x * a.z;
+                const TComponent s2 = a.x * b.w - b.x * a.w;
+                const TComponent s3 = a.y * b.z - b.y * a.z;
+                const TComponent s4 = a.y * b.w - b.y * a.w;
+                const TComponent s5 = a.z * b.w - b.z * a.w;
+
+                const TComponent c5 = c.z * d.w - d.z * c.w;
+                const TComponent c4 = c.y * d.w - d.y * c.w;
+                const TComponent c3 = c.y * d.z - d.y * c.z;
+                const TComponent c2 = c.x * d.w - d.x * c.w;
+                const TComponent c1 = c.x * d.z - d.x * c.z;
+                const TComponent c0 = c.x * d.y - d.x * c.y;
+
+                const TComponent invDet = 1 / (s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0);
+
+                result.cells[0] = TColumn(
+                        b.y * c5 - b.z * c4 + b.w * c3,
+                        -a.y * c5 + a.z * c4 - a.w * c3,
+                        d.y * s5 - d.z * s4 + d.w * s3,
+                        -c.y * s5 + c.z * s4 - c.w * s3
+                ) * invDet;
+                result.cells[1] = TColumn(
+                        -b.x * c5 + b.z * c2 - b.w * c1,
+                        a.x * c5 - a.z * c2 + a.w * c1,
+                        -d.x * s5 + d.z * s2 - d.w * s1,
+                        c.x * s5 - c.z * s2 + c.w * s1
+                ) * invDet;
+                result.cells[2] = TColumn(
+                        b.x * c4 - b.y * c2 + b.w * c0,
+                        -a.x * c4 + a.y * c2 - a.w * c0,
+                        d.x * s4 - d.y * s2 + d.w * s0,
+                        -c.x * s4 + c.y * s2 - c.w * s0
+                ) * invDet;
+                result.cells[3] = TColumn(
+                        -b.x * c3 + b.y * c1 - b.z * c0,
+                        a.x * c3 - a.y * c1 + a.z * c0,
+                        -d.x * s3 + d.y * s1 - d.z * s0,
+                        c.x * s3 - c.y * s1 + c.z * s0
+                ) * invDet;
+            } else {
+                // Slow fallback, Gauss-Jordan elimination applying the same row operations to an identity matrix
+                Matrix reduced = *this;
+                result = identity();
+
+                for (int col = 0; col < TWidth; ++col) {
+                    const int pivot = reduced.findPivotRow(col);
+                    if (pivot != col) {
+                        reduced.swapRows(col, pivot);
+                        result.swapRows(col, pivot);
+                    }
+
+                    const TComponent invPivot = 1 / reduced[col][col];
+                    for (int i = 0; i < TWidth; ++i) {
+                        reduced[i][col] *= invPivot;
+                        result[i][col] *= invPivot;
+                    }
+
+                    for (int row = 0; row < THeight; ++row) {
+                        const TComponent factor = reduced[col][row];
+                        if (row == col || factor == 0)
+                            continue;
+
+                        for (int i = 0; i < TWidth; ++i) {
+                            reduced[i][row] -= factor * reduced[i][col];
+                            result[i][row] -= factor * result[i][col];
+                        }
+                    }
+                }
+            }
+
+            return result;
+        }
+
+        /* -------------------------------------------- */
+        /*  Comparison                                  */
+        /* -------------------------------------------- */
+
+        // Equals
+        bool operator==(const Matrix& rhs) const {
+            for (int i = 0; i < TWidth; ++i) {
+                if (cells[i] != rhs.cells[i])
+                    return false;
+            }
+
+            return true;
+        }
+
+        /**
+         * Check if this matrix is equal to another within a small tolerance
+         *
+         * @param rhs The other matrix to compare to
+         * @param tolerance How close each cell needs to be to be regarded as equal
+         * @return true if equal within a tolerance
+         */
+        bool equal(const Matrix& rhs, TComponent tolerance = static_cast<TComponent>(constants::tinyNumber)) const {
+            for (int i = 0; i < TWidth; ++i) {
+                for (int j = 0; j < THeight; ++j) {
+                    if (std::abs(cells[i][j] - rhs.cells[i][j]) >= tolerance)
+                        return false;
+                }
+            }
+
+            return true;
+        }
 
-        // Determinate
-        // Inverse
 
         // Bitwise
         //   And
         //   or
         //   xor
+
+    private:
+        /**
+         * Find the row, at or below the diagonal, with the largest magnitude value in the given column
+         *
+         * Used for partial pivoting by the generic determinant and inverse implementations
+         *
+         * @param col The column to search
+         * @return The index of the row to pivot on
+         */
+        int findPivotRow(const int col) const {
+            int pivot = col;
+            for (int row = col + 1; row < THeight; ++row) {
+                if (std::abs(cells[col][row]) > std::abs(cells[col][pivot]))
+                    pivot = row;
+            }
+
+            return pivot;
+        }
+
+        /**
+         * Swap two rows of the matrix
+         *
+         * @param row1 The index of the first row
+         * @param row2 The index of the second row
+         */
+        void swapRows(const int row1, const int row2) {
+            for (int i = 0; i < TWidth; ++i) {
+                std::swap(cells[i][row1], cells[i][row2]);
+            }
+        }
     };
 } // namespace DatEngine::DatMaths
@@ -0,0 +1,222 @@
+#include "BatchRotation.h"
+
+#include <cassert>
+
+using namespace DatEngine;
+using namespace DatEngine::DatMaths;
+
+namespace {
+#ifdef DAT_SIMD_AVX
+    /**
+     * 8 quaternions held as a register per component
+     */
+    struct QuatX8 {
+        __m256 x, y, z, w;
+    };
+
+    /**
+     * 8 vec3s held as a register per component
+     */
+    struct Vec3X8 {
+        __m256 x, y, z;
+    };
+
+    Vec3X8 cross(const __m256 ax, const __m256 ay, const __m256 az, const Vec3X8& b) {
+        return {
+                _mm256_sub_ps(_mm256_mul_ps(ay, b.z), _mm256_mul_ps(az, b.y)),
+                _mm256_sub_ps(_mm256_mul_ps(az, b.x), _mm256_mul_ps(ax, b.z)),
+                _mm256_sub_ps(_mm256_mul_ps(ax, b.y), _mm256_mul_ps(ay, b.x))
+        };
+    }
+
+    /**
+     * Rotate 8 vectors by 8 quaternions, the same as Quaternion::operator*(const TVec3&)
+     */
+    Vec3X8 rotateX8(const QuatX8& q, const Vec3X8& v) {
+        const __m256 two = _mm256_set1_ps(2.f);
+
+        Vec3X8 t = cross(q.x, q.y, q.z, v);
+        t = {_mm256_mul_ps(t.x, two), _mm256_mul_ps(t.y, two), _mm256_mul_ps(t.z, two)};
+
+        const Vec3X8 qt = cross(q.x, q.y, q.z, t);
+        return {
+                _mm256_add_ps(Simd::multiplyAdd(t.x, q.w, v.x), qt.x),
+                _mm256_add_ps(Simd::multiplyAdd(t.y, q.w, v.y), qt.y),
+                _mm256_add_ps(Simd::multiplyAdd(t.z, q.w, v.z), qt.z)
+        };
+    }
+
+    QuatX8 loadQuatX8(const quat* src) {
+        QuatX8 result;
+        Simd::loadVec4x8(&src->vec.x, result.x, result.y, result.z, result.w);
+        return result;
+    }
+
+    /**
+     * Blend 8 pairs of quaternions with per lane weights
+     */
+    QuatX8 blendX8(const QuatX8& a, const QuatX8& b, const __m256 aWeight, const __m256 bWeight) {
+        return {
+                Simd::multiplyAdd(b.x, bWeight, _mm256_mul_ps(a.x, aWeight)),
+                Simd::multiplyAdd(b.y, bWeight, _mm256_mul_ps(a.y, aWeight)),
+                Simd::multiplyAdd(b.z, bWeight, _mm256_mul_ps(a.z, aWeight)),
+                Simd::multiplyAdd(b.w, bWeight, _mm256_mul_ps(a.w, aWeight))
+        };
+    }
+
+    QuatX8 normaliseX8(const QuatX8& q) {
+        __m256 lengthSquared = _mm256_mul_ps(q.x, q.x);
+        lengthSquared = Simd::multiplyAdd(q.y, q.y, lengthSquared);
+        lengthSquared = Simd::multiplyAdd(q.z, q.z, lengthSquared);
+        lengthSquared = Simd::multiplyAdd(q.w, q.w, lengthSquared);
+
+        const __m256 invLength = DatMaths::invSqrt<Precision::Fast>(lengthSquared);
+        return {
+                _mm256_mul_ps(q.x, invLength), _mm256_mul_ps(q.y, invLength), _mm256_mul_ps(q.z, invLength),
+                _mm256_mul_ps(q.w, invLength)
+        };
+    }
+
+    __m256 dotX8(const QuatX8& a, const QuatX8& b) {
+        __m256 result = _mm256_mul_ps(a.x, b.x);
+        result = Simd::multiplyAdd(a.y, b.y, result);
+        result = Simd::multiplyAdd(a.z, b.z, result);
+        return Simd::multiplyAdd(a.w, b.w, result);
+    }
+#endif
+} // namespace
+
+/* -------------------------------------------- */
+/*  Rotation                                    */
+/* -------------------------------------------- */
+
+void DatMaths::rotate(const quat& rotation, const std::span<const vec3> in, const std::span<vec3> out) {
+    assert(out.size() >= in.size());
+
+    size_t i = 0;
+#ifdef DAT_SIMD_AVX
+    const QuatX8 q = {
+            _mm256_set1_ps(rotation.vec.x), _mm256_set1_ps(rotation.vec.y), _mm256_set1_ps(rotation.vec.z),
+            _mm256_set1_ps(rotation.s)
+    };
+
+    for (; i + 8 <= in.size(); i += 8) {
+        Vec3X8 v;
+        Simd::loadVec3x8(&in[i].x, v.x, v.y, v.z);
+
+        const Vec3X8 result = rotateX8(q, v);
+        Simd::storeVec3x8(&out[i].x, result.x, result.y, result.z);
+    }
+#endif
+    // Tail, or everything when AVX isn't available
+    for (; i < in.size(); ++i) {
+        out[i] = rotation * in[i];
+    }
+}
+
+void DatMaths::rotate(
+        const std::span<const quat> rotations, const std::span<const vec3> in, const std::span<vec3> out
+) {
+    assert(rotations.size() == in.size());
+    assert(out.size() >= in.size());
+
+    size_t i = 0;
+#ifdef DAT_SIMD_AVX
+    for (; i + 8 <= in.size(); i += 8) {
+        Vec3X8 v;
+        Simd::loadVec3x8(&in[i].x, v.x, v.y, v.z);
+
+        const Vec3X8 result = rotateX8(loadQuatX8(&rotations[i]), v);
+        Simd::storeVec3x8(&out[i].x, result.x, result.y, result.z);
+    }
+#endif
+    for (; i < in.size(); ++i) {
+        out[i] = rotations[i] * in[i];
+    }
+}
+
+/* -------------------------------------------- */
+/*  Blending                                    */
+/* -------------------------------------------- */
+
+void DatMaths::nlerp(
+        const std::span<const quat> from, const std::span<const quat> to, const float alpha, const std::span<quat> out
+) {
+    assert(from.size() == to.size());
+    assert(out.size() >= from.size());
+
+    size_t i = 0;
+#ifdef DAT_SIMD_AVX
+    const __m256 signMask = _mm256_set1_ps(-0.f);
+    const __m256 aWeight = _mm256_set1_ps(1 - alpha);
+    const __m256 bWeight = _mm256_set1_ps(alpha);
+
+    for (; i + 8 <= from.size(); i += 8) {
+        const QuatX8 a = loadQuatX8(&from[i]);
+        const QuatX8 b = loadQuatX8(&to[i]);
+
+        // Flip the sign of b's weight wherever it's in the opposite hemisphere, to take the shortest path
+        const __m256 flip = _mm256_and_ps(dotX8(a, b), signMask);
+        const QuatX8 result = normaliseX8(blendX8(a, b, aWeight, _mm256_xor_ps(bWeight, flip)));
+        Simd::storeVec4x8(&out[i].vec.x, result.x, result.y, result.z, result.w);
+    }
+#endif
+    for (; i < from.size(); ++i) {
+        out[i] = nlerp(from[i], to[i], alpha);
+    }
+}
+
+void DatMaths::slerp(
+        const std::span<const quat> from, const std::span<const quat> to, const float alpha, const std::span<quat> out
+) {
+    assert(from.size() == to.size());
+    assert(out.size() >= from.size());
+
+    size_t i = 0;
+#ifdef DAT_SIMD_AVX
+    const __m256 signMask = _mm256_set1_ps(-0.f);
+    const __m256 one = _mm256_set1_ps(1.f);
+    const __m256 alphaX8 = _mm256_set1_ps(alpha);
+    const __m256 invAlphaX8 = _mm256_set1_ps(1 - alpha);
+    const __m256 nlerpThreshold = _mm256_set1_ps(0.9995f);
+
+    for (; i + 8 <= from.size(); i += 8) {
+        const QuatX8 a = loadQuatX8(&from[i]);
+        const QuatX8 b = loadQuatX8(&to[i]);
+
+        const __m256 dot = dotX8(a, b);
+        const __m256 flip = _mm256_and_ps(dot, signMask);
+        const __m256 cosTheta = _mm256_min_ps(_mm256_xor_ps(dot, flip), one);
+
+        // theta = atan2(sin, cos) rather than acos(cos), as there's no 8 wide acos
+        const __m256 sinTheta = _mm256_sqrt_ps(_mm256_sub_ps(one, _mm256_mul_ps(cosTheta, cosTheta)));
+        const __m256 theta = DatMaths::atan2<Precision::Balanced>(sinTheta, cosTheta);
+        const __m256 invSinTheta = _mm256_div_ps(one, sinTheta);
+
+        const __m256 sinA = DatMaths::sin<Precision::Balanced>(_mm256_mul_ps(invAlphaX8, theta));
+        const __m256 sinB = DatMaths::sin<Precision::Balanced>(_mm256_mul_ps(alphaX8, theta));
+        const __m256 slerpA = _mm256_mul_ps(sinA, invSinTheta);
+        const __m256 slerpB = _mm256_mul_ps(sinB, invSinTheta);
+
+        // Lanes with small angles use the nlerp weights, and are normalised afterwards
+        const __m256 useNlerp = _mm256_cmp_ps(cosTheta, nlerpThreshold, _CMP_GT_OQ);
+        const __m256 aWeight = _mm256_blendv_ps(slerpA, invAlphaX8, useNlerp);
+        const __m256 bWeight = _mm256_xor_ps(_mm256_blendv_ps(slerpB, alphaX8, useNlerp), flip);
+
+        QuatX8 result = blendX8(a, b, aWeight, bWeight);
+        if (_mm256_movemask_ps(useNlerp) != 0) {
+            const QuatX8 normalised = normaliseX8(result);
+            result = {
+                    _mm256_blendv_ps(result.x, normalised.x, useNlerp),
+                    _mm256_blendv_ps(result.y, normalised.y, useNlerp),
+                    _mm256_blendv_ps(result.z, normalised.z, useNlerp),
+                    _mm256_blendv_ps(result.w, normalised.w, useNlerp)
+            };
+        }
+        Simd::storeVec4x8(&out[i].vec.x, result.x, result.y, result.z, result.w);
+    }
+#endif
+    for (; i < from.size(); ++i) {
+        out[i] = slerp(from[i], to[i], alpha);
+    }
+}
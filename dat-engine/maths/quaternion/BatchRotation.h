@@ -0,0 +1,63 @@
+#pragma once
+
+#include <span>
+
+#include <maths/Quaternion.h>
+
+namespace DatEngine::DatMaths {
+    /* -------------------------------------------- */
+    /*  Rotation                                    */
+    /* -------------------------------------------- */
+
+    /**
+     * Rotate a span of vectors by a single quaternion
+     *
+     * @note When AVX is available, 8 vectors are rotated per iteration, with any remainder rotated one at a time.
+     *
+     * @param rotation The normalised rotation
+     * @param in The vectors to rotate
+     * @param out Where to write the rotated vectors, must be at least as big as \p in. May be the same span as \p in,
+     *            but must not otherwise overlap it
+     */
+    void rotate(const quat& rotation, std::span<const vec3> in, std::span<vec3> out);
+
+    /**
+     * Rotate each vector in a span by the matching quaternion in another span
+     *
+     * @param rotations The normalised rotations, must be the same size as \p in
+     * @param in The vectors to rotate
+     * @param out Where to write the rotated vectors, must be at least as big as \p in. May be the same span as \p in,
+     *            but must not otherwise overlap it
+     */
+    void rotate(std::span<const quat> rotations, std::span<const vec3> in, std::span<vec3> out);
+
+    /* -------------------------------------------- */
+    /*  Blending                                    */
+    /* -------------------------------------------- */
+
+    /**
+     * Interpolate each quaternion in a span towards the matching quaternion in another span using nlerp()
+     * <br>
+     * Intended for blending between two sampled animation poses.
+     *
+     * @param from The start rotations
+     * @param to The end rotations, must be the same size as \p from
+     * @param alpha How far to interpolate, 0 gives \p from and 1 gives \p to
+     * @param out Where to write the blended rotations, must be at least as big as \p from. May be the same span as
+     *            either input, but must not otherwise overlap them
+     */
+    void nlerp(std::span<const quat> from, std::span<const quat> to, float alpha, std::span<quat> out);
+
+    /**
+     * Interpolate each quaternion in a span towards the matching quaternion in another span using slerp()
+     *
+     * @note The 8 wide path evaluates the trig with Precision::Balanced, so may differ from slerp() by up to 1e-6
+     *
+     * @param from The start rotations
+     * @param to The end rotations, must be the same size as \p from
+     * @param alpha How far to interpolate, 0 gives \p from and 1 gives \p to
+     * @param out Where to write the blended rotations, must be at least as big as \p from. May be the same span as
+     *            either input, but must not otherwise overlap them
+     */
+    void slerp(std::span<const quat> from, std::span<const quat> to, float alpha, std::span<quat> out);
+} // namespace DatEngine::DatMaths
@@ -1,14 +1,474 @@
 #pragma once
 
-#include <maths/vector/Vec3.h>
+#include <cmath>
+
+#include <maths/CommonMaths.h>
+#include <maths/Constants.h>
+#include <maths/Matrix.h>
+#include <maths/Simd.h>
 #include <util/TypeTraits.h>
 
 namespace DatEngine::DatMaths {
+    /**
+     * A quaternion, used to represent rotations
+     * <br>
+     * The components are laid out x, y, z, s (w) in memory so a float quaternion can be loaded straight into an SSE
+     * register. Unless stated otherwise, operations expect the quaternion to be normalised.
+     *
+     * @tparam TComponent The type of the components, must be floating point
+     */
     template<TypeTraits::CFloating TComponent>
-    struct Quaternion {
+    struct alignas(Simd::vec4Alignment<TComponent>) Quaternion {
         typedef Quaternion TQuat;
+        using TVec3 = Vector<3, TComponent>;
+        using TMat3 = Matrix<3, 3, TComponent>;
+        using TMat4 = Matrix<4, 4, TComponent>;
 
+        /** The imaginary (x, y, z) part of the quaternion */
         Vector<3, TComponent> vec;
+
+        /** The real (w) part of the quaternion */
         TComponent s;
+
+        /* -------------------------------------------- */
+        /*  Initialisation                              */
+        /* -------------------------------------------- */
+
+        /**
+         * Initialises to the identity quaternion, i.e. no rotation
+         */
+        Quaternion() : vec(0), s(1) {}
+
+        /**
+         * Initialises each component to their given value
+         * @param x The value to initialise the x component to
+         * @param y The value to initialise the y component to
+         * @param z The value to initialise the z component to
+         * @param s The value to initialise the real component to
+         */
+        Quaternion(TComponent x, TComponent y, TComponent z, TComponent s) : vec(x, y, z), s(s) {}
+
+        /**
+         * Initialises the imaginary and real parts
+         * @param vec The imaginary part
+         * @param s The real part
+         */
+        Quaternion(const TVec3& vec, TComponent s) : vec(vec), s(s) {}
+
+#ifdef DAT_SIMD_SSE
+        /**
+         * Initialises the components from the lanes of an SSE register, in the order x, y, z, s
+         * @param simd The register to copy
+         */
+        explicit Quaternion(const __m128 simd)
+            requires Simd::CSimdFloat<TComponent>
+        {
+            _mm_store_ps(&vec.x, simd);
+        }
+
+        /**
+         * Load the components into an SSE register, in the order x, y, z, s
+         * @return The register holding the components
+         */
+        [[nodiscard]] __m128 toSimd() const
+            requires Simd::CSimdFloat<TComponent>
+        {
+            return _mm_load_ps(&vec.x);
+        }
+#endif
+
+        /**
+         * Get the identity quaternion, i.e. no rotation
+         * @return The identity quaternion
+         */
+        static Quaternion identity() { return {}; }
+
+        /* -------------------------------------------- */
+        /*  Axis Angle                                  */
+        /* -------------------------------------------- */
+
+        /**
+         * Create a quaternion representing a rotation around an axis
+         * @param axis The axis to rotate around, must be normalised
+         * @param angle The angle to rotate by, in radians
+         * @return The rotation
+         */
+        static Quaternion fromAxisAngle(const TVec3& axis, const TComponent angle) {
+            const TComponent halfAngle = angle / 2;
+            return {axis * DatMaths::sin(halfAngle), DatMaths::cos(halfAngle)};
+        }
+
+        /**
+         * Get the axis and angle of the rotation this quaternion represents
+         * <br>
+         * The identity quaternion has no meaningful axis, so the up vector is returned with an angle of 0.
+         *
+         * @param axis Where to write the normalised axis
+         * @param angle Where to write the angle in radians, in the range [0, 2 * pi]
+         */
+        void toAxisAngle(TVec3& axis, TComponent& angle) const {
+            const TComponent clamped = DatMaths::clamp(s, static_cast<TComponent>(-1), static_cast<TComponent>(1));
+            angle = 2 * DatMaths::acos(clamped);
+
+            const TComponent sinHalfAngle = std::sqrt(1 - clamped * clamped);
+            if (sinHalfAngle < static_cast<TComponent>(constants::tinyNumber)) {
+                axis = TVec3::UP;
+                return;
+            }
+            axis = vec / sinHalfAngle;
+        }
+
+        /* -------------------------------------------- */
+        /*  Matrix Conversion                           */
+        /* -------------------------------------------- */
+
+        /**
+         * Create a quaternion from the rotation held in a matrix
+         * <br>
+         * Only the upper 3x3 of the matrix is read, it must be a pure rotation (orthonormal with no scale).
+         * Source: https://www.euclideanspace.com/maths/geometry/rotations/conversions/matrixToQuaternion/
+         *
+         * @tparam size The width and height of the matrix, 3 or 4
+         * @param matrix The rotation matrix
+         * @return The normalised rotation
+         */
+        template<int size>
+            requires(size == 3 || size == 4)
+        static Quaternion fromMatrix(const Matrix<size, size, TComponent>& matrix) {
+            // matrix[column][row]
+            const TComponent m00 = matrix[0][0], m11 = matrix[1][1], m22 = matrix[2][2];
+            const TComponent trace = m00 + m11 + m22;
+
+            Quaternion result;
+            if (trace > 0) {
+                const TComponent scale = std::sqrt(trace + 1) * 2;
+                result.s = scale / 4;
+                result.vec.x = (matrix[1][2] - matrix[2][1]) / scale;
+                result.vec.y = (matrix[2][0] - matrix[0][2]) / scale;
+                result.vec.z = (matrix[0][1] - matrix[1][0]) / scale;
+            } else if (m00 > m11 && m00 > m22) {
+                const TComponent scale = std::sqrt(1 + m00 - m11 - m22) * 2;
+                result.s = (matrix[1][2] - matrix[2][1]) / scale;
+                result.vec.x = scale / 4;
+                result.vec.y = (matrix[1][0] + matrix[0][1]) / scale;
+                result.vec.z = (matrix[2][0] + matrix[0][2]) / scale;
+            } else if (m11 > m22) {
+                const TComponent scale = std::sqrt(1 + m11 - m00 - m22) * 2;
+                result.s = (matrix[2][0] - matrix[0][2]) / scale;
+                result.vec.x = (matrix[1][0] + matrix[0][1]) / scale;
+                result.vec.y = scale / 4;
+                result.vec.z = (matrix[2][1] + matrix[1][2]) / scale;
+            } else {
+                const TComponent scale = std::sqrt(1 + m22 - m00 - m11) * 2;
+                result.s = (matrix[0][1] - matrix[1][0]) / scale;
+                result.vec.x = (matrix[2][0] + matrix[0][2]) / scale;
+                result.vec.y = (matrix[2][1] + matrix[1][2]) / scale;
+                result.vec.z = scale / 4;
+            }
+            result.normalise();
+            return result;
+        }
+
+        /**
+         * Get the rotation matrix this quaternion represents
+         * @return The 3x3 rotation matrix
+         */
+        TMat3 toMat3() const {
+            const TComponent x = vec.x, y = vec.y, z = vec.z;
+            const TComponent xx = x * x, yy = y * y, zz = z * z;
+            const TComponent xy = x * y, xz = x * z, yz = y * z;
+            const TComponent sx = s * x, sy = s * y, sz = s * z;
+
+            TMat3 result;
+            result[0] = {1 - 2 * (yy + zz), 2 * (xy + sz), 2 * (xz - sy)};
+            result[1] = {2 * (xy - sz), 1 - 2 * (xx + zz), 2 * (yz + sx)};
+            result[2] = {2 * (xz + sy), 2 * (yz - sx), 1 - 2 * (xx + yy)};
+            return result;
+        }
+
+        /**
+         * Get the rotation matrix this quaternion represents, with no translation
+         * @return The 4x4 rotation matrix
+         */
+        TMat4 toMat4() const {
+            const TMat3 rotation = toMat3();
+
+            TMat4 result = TMat4::identity();
+            for (int i = 0; i < 3; ++i) {
+                result[i] = Vector<4, TComponent>(rotation[i], 0);
+            }
+            return result;
+        }
+
+        /* -------------------------------------------- */
+        /*  Maths                                       */
+        /* -------------------------------------------- */
+
+        /**
+         * Multiply two quaternions (the Hamilton product)
+         * <br>
+         * The result represents rotating by \p rhs and then by this quaternion.
+         *
+         * @param rhs The right hand quaternion
+         * @return The product
+         */
+        Quaternion operator*(const Quaternion& rhs) const {
+#ifdef DAT_SIMD_SSE
+            if constexpr (Simd::CSimdFloat<TComponent>) {
+                const __m128 lh = toSimd();
+                const __m128 rh = rhs.toSimd();
+
+                // Each lane of the result is a signed combination of the components of rh, scaled by one component
+                // of lh. The shuffles and sign masks line the rh components up with their lh component
+                __m128 result = _mm_mul_ps(_mm_shuffle_ps(lh, lh, _MM_SHUFFLE(3, 3, 3, 3)), rh);
+
+                const __m128 rhX = _mm_xor_ps(
+                        _mm_shuffle_ps(rh, rh, _MM_SHUFFLE(0, 1, 2, 3)), _mm_setr_ps(0.f, -0.f, 0.f, -0.f)
+                );
+                result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(lh, lh, _MM_SHUFFLE(0, 0, 0, 0)), rhX));
+
+                const __m128 rhY = _mm_xor_ps(
+                        _mm_shuffle_ps(rh, rh, _MM_SHUFFLE(1, 0, 3, 2)), _mm_setr_ps(0.f, 0.f, -0.f, -0.f)
+                );
+                result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(lh, lh, _MM_SHUFFLE(1, 1, 1, 1)), rhY));
+
+                const __m128 rhZ = _mm_xor_ps(
+                        _mm_shuffle_ps(rh, rh, _MM_SHUFFLE(2, 3, 0, 1)), _mm_setr_ps(-0.f, 0.f, 0.f, -0.f)
+                );
+                result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(lh, lh, _MM_SHUFFLE(2, 2, 2, 2)), rhZ));
+
+                return Quaternion(result);
+            }
+#endif
+            return {rhs.vec * s + vec * rhs.s + vec.crossProduct(rhs.vec), s * rhs.s - vec.dotProduct(rhs.vec)};
+        }
+
+        /**
+         * Multiply this quaternion by another in place
+         * @see operator*(const Quaternion&)
+         * @param rhs The right hand quaternion
+         * @return This quaternion
+         */
+        Quaternion& operator*=(const Quaternion& rhs) {
+            *this = *this * rhs;
+            return *this;
+        }
+
+        /**
+         * Rotate a vector by this quaternion
+         * <br>
+         * Source: https://fgiesen.wordpress.com/2019/02/09/rotating-a-single-vector-using-a-quaternion/
+         *
+         * @param rhs The vector to rotate
+         * @return The rotated vector
+         */
+        TVec3 operator*(const TVec3& rhs) const {
+            const TVec3 t = vec.crossProduct(rhs) * static_cast<TComponent>(2);
+            return rhs + t * s + vec.crossProduct(t);
+        }
+
+        /* -------------------------------------------- */
+
+        /**
+         * Add the components of two quaternions, used when blending
+         * @param rhs The right hand quaternion
+         * @return The component wise sum
+         */
+        Quaternion operator+(const Quaternion& rhs) const {
+#ifdef DAT_SIMD_SSE
+            if constexpr (Simd::CSimdFloat<TComponent>) {
+                return Quaternion(_mm_add_ps(toSimd(), rhs.toSimd()));
+            }
+#endif
+            return {vec + rhs.vec, s + rhs.s};
+        }
+
+        /**
+         * Multiply every component by a scalar, used when blending
+         * @param scalar The value to multiply by
+         * @return The scaled quaternion
+         */
+        Quaternion operator*(const TComponent scalar) const {
+#ifdef DAT_SIMD_SSE
+            if constexpr (Simd::CSimdFloat<TComponent>) {
+                return Quaternion(_mm_mul_ps(toSimd(), _mm_set1_ps(scalar)));
+            }
+#endif
+            return {vec * scalar, s * scalar};
+        }
+
+        /**
+         * Negate every component. The result represents the same rotation
+         * @return The negated quaternion
+         */
+        Quaternion operator-() const {
+#ifdef DAT_SIMD_SSE
+            if constexpr (Simd::CSimdFloat<TComponent>) {
+                return Quaternion(_mm_xor_ps(toSimd(), _mm_set1_ps(-0.f)));
+            }
+#endif
+            return {-vec, -s};
+        }
+
+        /* -------------------------------------------- */
+
+        /**
+         * Get the dot product of two quaternions, the cosine of half the angle between the rotations
+         * @param rhs The right hand quaternion
+         * @return The dot product
+         */
+        TComponent dotProduct(const Quaternion& rhs) const {
+#ifdef DAT_SIMD_SSE
+            if constexpr (Simd::CSimdFloat<TComponent>) {
+                return _mm_cvtss_f32(_mm_dp_ps(toSimd(), rhs.toSimd(), 0xF1));
+            }
+#endif
+            return vec.dotProduct(rhs.vec) + s * rhs.s;
+        }
+
+        /**
+         * Get the magnitude of the quaternion
+         * @return The magnitude
+         */
+        TComponent length() const { return DatMaths::sqrt(lengthSquared()); }
+
+        /**
+         * Get the magnitude squared of the quaternion
+         * @return The magnitude squared
+         */
+        TComponent lengthSquared() const { return dotProduct(*this); }
+
+        /**
+         * Normalise the quaternion in place, using the fast inverse square root
+         */
+        void normalise() {
+#ifdef DAT_SIMD_SSE
+            if constexpr (Simd::CSimdFloat<TComponent>) {
+                const __m128 simd = toSimd();
+                *this = Quaternion(_mm_mul_ps(simd, DatMaths::invSqrt<Precision::Fast>(_mm_dp_ps(simd, simd, 0xFF))));
+                return;
+            }
+#endif
+            *this = *this * DatMaths::invSqrt<Precision::Fast>(lengthSquared());
+        }
+
+        /**
+         * Get the normalised copy of this quaternion
+         * @return A normalised copy of this quaternion
+         */
+        Quaternion normalised() const {
+            Quaternion out(*this);
+            out.normalise();
+            return out;
+        }
+
+        /**
+         * Get if this quaternion is normalised (has a length of one)
+         * @return true if normalised
+         */
+        bool isNormalised(TComponent tolerance = static_cast<TComponent>(constants::normalisedTolerance)) const {
+            return std::abs(1 - lengthSquared()) < tolerance;
+        }
+
+        /* -------------------------------------------- */
+
+        /**
+         * Get the conjugate of the quaternion, which for a normalised quaternion is the inverse rotation
+         * @return The conjugate
+         */
+        Quaternion conjugate() const {
+#ifdef DAT_SIMD_SSE
+            if constexpr (Simd::CSimdFloat<TComponent>) {
+                return Quaternion(_mm_xor_ps(toSimd(), _mm_setr_ps(-0.f, -0.f, -0.f, 0.f)));
+            }
+#endif
+            return {-vec, s};
+        }
+
+        /**
+         * Get the inverse of the quaternion, this works for quaternions that aren't normalised
+         * @return The inverse
+         */
+        Quaternion inverse() const { return conjugate() * (1 / lengthSquared()); }
+
+        /* -------------------------------------------- */
+        /*  Comparison                                  */
+        /* -------------------------------------------- */
+
+        /**
+         * Compare every component of two quaternions
+         * <br>
+         * A quaternion and its negation represent the same rotation but are not equal.
+         *
+         * @param rhs The quaternion to compare against
+         * @return true if every component is equal
+         */
+        bool operator==(const Quaternion& rhs) const { return vec == rhs.vec && s == rhs.s; }
+
+        /**
+         * Compare every component of two quaternions with a tolerance
+         *
+         * @param rhs The quaternion to compare against
+         * @param tolerance Two components must differ by less than this to be considered equal
+         * @return true if every component is within the tolerance
+         */
+        bool equal(const Quaternion& rhs, TComponent tolerance = static_cast<TComponent>(constants::tinyNumber)) const {
+            return vec.equal(rhs.vec, tolerance) && std::abs(s - rhs.s) < tolerance;
+        }
     };
+
+    /* -------------------------------------------- */
+    /*  Interpolation                               */
+    /* -------------------------------------------- */
+
+    /**
+     * Linearly interpolate between two rotations and normalise the result
+     * <br>
+     * This takes the shortest path, but the angular speed isn't constant, it is fastest at an alpha of 0.5. For small
+     * angles the difference from slerp() is negligible.
+     *
+     * @tparam TComponent The type of the components of the quaternions
+     * @param a The start rotation
+     * @param b The end rotation
+     * @param alpha How far to interpolate, 0 returns \p a and 1 returns \p b
+     * @return The normalised interpolated rotation
+     */
+    template<TypeTraits::CFloating TComponent>
+    Quaternion<TComponent> nlerp(const Quaternion<TComponent>& a, const Quaternion<TComponent>& b, TComponent alpha) {
+        // Flip b into the same hemisphere as a so the shortest path is taken
+        const TComponent bWeight = a.dotProduct(b) < 0 ? -alpha : alpha;
+        return (a * (1 - alpha) + b * bWeight).normalised();
+    }
+
+    /**
+     * Spherically interpolate between two rotations, taking the shortest path at a constant angular speed
+     * <br>
+     * When the rotations are almost the same, this falls back to nlerp(), which is cheaper and avoids dividing by
+     * the sine of a tiny angle.
+     *
+     * @tparam TComponent The type of the components of the quaternions
+     * @param a The start rotation
+     * @param b The end rotation
+     * @param alpha How far to interpolate, 0 returns \p a and 1 returns \p b
+     * @return The interpolated rotation
+     */
+    template<TypeTraits::CFloating TComponent>
+    Quaternion<TComponent> slerp(const Quaternion<TComponent>& a, const Quaternion<TComponent>& b, TComponent alpha) {
+        // Past this the angle is small enough that nlerp is indistinguishable
+        constexpr TComponent nlerpThreshold = static_cast<TComponent>(0.9995);
+
+        TComponent cosTheta = a.dotProduct(b);
+        const TComponent sign = cosTheta < 0 ? -1 : 1;
+        cosTheta *= sign;
+
+        if (cosTheta > nlerpThreshold) {
+            return nlerp(a, b, alpha);
+        }
+
+        const TComponent theta = DatMaths::acos(cosTheta);
+        const TComponent invSinTheta = 1 / DatMaths::sin(theta);
+        const TComponent aWeight = DatMaths::sin((1 - alpha) * theta) * invSinTheta;
+        const TComponent bWeight = DatMaths::sin(alpha * theta) * invSinTheta * sign;
+        return a * aWeight + b * bWeight;
+    }
 } // namespace DatEngine::DatMaths
@@ -141,7 +141,7 @@ struct DatEngine::DatMaths::Vector<1, TComponent> {
     /* -------------------------------------------- */
 
     //   Negation
-    Vector operator-();
+    Vector operator-() const;
 
     /* -------------------------------------------- */
 
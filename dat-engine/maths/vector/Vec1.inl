@@ -100,7 +100,7 @@ namespace DatEngine::DatMaths {
     /* -------------------------------------------- */
 
     template<typename TComponent>
-    Vector<1, TComponent> Vector<1, TComponent>::operator-() {
+    Vector<1, TComponent> Vector<1, TComponent>::operator-() const {
         return {-x};
     }
 
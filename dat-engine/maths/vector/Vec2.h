@@ -182,7 +182,7 @@ struct DatEngine::DatMaths::Vector<2, TComponent> {
     /* -------------------------------------------- */
 
     //   Negation
-    Vector operator-();
+    Vector operator-() const;
 
     /* -------------------------------------------- */
 
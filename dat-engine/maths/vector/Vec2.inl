@@ -114,7 +114,7 @@ namespace DatEngine::DatMaths {
     /* -------------------------------------------- */
 
     template<typename TComponent>
-    Vector<2, TComponent> Vector<2, TComponent>::operator-() {
+    Vector<2, TComponent> Vector<2, TComponent>::operator-() const {
         return {-x, -y};
     }
 
@@ -206,14 +206,14 @@ namespace DatEngine::DatMaths {
 
     template<typename TComponent>
     void Vector<2, TComponent>::normalise() {
-        TComponent invLength = DatMaths::invSqrt(lengthSquared());
+        TComponent invLength = DatMaths::invSqrt<Precision::Fast>(lengthSquared());
         x *= invLength;
         y *= invLength;
     }
 
     template<typename TComponent>
     Vector<2, TComponent> Vector<2, TComponent>::normalised() const {
-        TComponent invLength = DatMaths::invSqrt(lengthSquared());
+        TComponent invLength = DatMaths::invSqrt<Precision::Fast>(lengthSquared());
 
         return {x * invLength, y * invLength};
     }
@@ -6,6 +6,7 @@
 
 #include <maths/CommonMaths.h> // Used by inl
 #include <maths/Constants.h>
+#include <maths/Simd.h>
 
 template<typename TComponent>
 /**
@@ -206,7 +207,7 @@ struct DatEngine::DatMaths::Vector<3, TComponent> {
     /* -------------------------------------------- */
 
     //   Negation
-    Vector operator-();
+    Vector operator-() const;
 
     /* -------------------------------------------- */
 
@@ -128,7 +128,7 @@ namespace DatEngine::DatMaths {
     /* -------------------------------------------- */
 
     template<typename TComponent>
-    Vector<3, TComponent> Vector<3, TComponent>::operator-() {
+    Vector<3, TComponent> Vector<3, TComponent>::operator-() const {
         return {-x, -y, -z};
     }
 
@@ -218,6 +218,20 @@ namespace DatEngine::DatMaths {
     template<typename TComponent>
     template<typename TOther>
     Vector<3, TComponent> Vector<3, TComponent>::crossProduct(Vector<3, TOther> otherVec) const {
+#ifdef DAT_SIMD_SSE
+        if constexpr (Simd::CSimdFloat<TComponent, TOther>) {
+            // a.yzx * b.zxy - a.zxy * b.yzx, computed as (a * b.yzx - a.yzx * b).yzx to save a shuffle
+            const __m128 lh = Simd::load3(&x);
+            const __m128 rh = Simd::load3(&otherVec.x);
+            const __m128 lhYzx = _mm_shuffle_ps(lh, lh, _MM_SHUFFLE(3, 0, 2, 1));
+            const __m128 rhYzx = _mm_shuffle_ps(rh, rh, _MM_SHUFFLE(3, 0, 2, 1));
+            const __m128 result = _mm_sub_ps(_mm_mul_ps(lh, rhYzx), _mm_mul_ps(lhYzx, rh));
+
+            Vector out;
+            Simd::store3(&out.x, _mm_shuffle_ps(result, result, _MM_SHUFFLE(3, 0, 2, 1)));
+            return out;
+        }
+#endif
         return {y * static_cast<TComponent>(otherVec.z) - z * static_cast<TComponent>(otherVec.y),
                 z * static_cast<TComponent>(otherVec.x) - x * static_cast<TComponent>(otherVec.z),
                 x * static_cast<TComponent>(otherVec.y) - y * static_cast<TComponent>(otherVec.x)};
@@ -239,7 +253,14 @@ namespace DatEngine::DatMaths {
 
     template<typename TComponent>
     void Vector<3, TComponent>::normalise() {
-        TComponent invLength = DatMaths::invSqrt(lengthSquared());
+#ifdef DAT_SIMD_SSE
+        if constexpr (Simd::CSimdFloat<TComponent>) {
+            const __m128 simd = Simd::load3(&x);
+            Simd::store3(&x, _mm_mul_ps(simd, DatMaths::invSqrt<Precision::Fast>(_mm_dp_ps(simd, simd, 0x7F))));
+            return;
+        }
+#endif
+        TComponent invLength = DatMaths::invSqrt<Precision::Fast>(lengthSquared());
         x *= invLength;
         y *= invLength;
         z *= invLength;
@@ -247,7 +268,14 @@ namespace DatEngine::DatMaths {
 
     template<typename TComponent>
     Vector<3, TComponent> Vector<3, TComponent>::normalised() const {
-        TComponent invLength = DatMaths::invSqrt(lengthSquared());
+#ifdef DAT_SIMD_SSE
+        if constexpr (Simd::CSimdFloat<TComponent>) {
+            Vector out(*this);
+            out.normalise();
+            return out;
+        }
+#endif
+        TComponent invLength = DatMaths::invSqrt<Precision::Fast>(lengthSquared());
 
         return {x * invLength, y * invLength, z * invLength};
     }
@@ -6,13 +6,17 @@
 
 #include <maths/CommonMaths.h> // Used by inl
 #include <maths/Constants.h>
+#include <maths/Simd.h>
 
 template<typename TComponent>
 /**
  * A struct representing a 4 component vector
+ * <br>
+ * Float vectors are 16 byte aligned, when SIMD is enabled their operators are implemented using SSE, otherwise they
+ * fall back to the scalar implementation used by every other component type.
  * @tparam TComponent The type of the components of the vector
  */
-struct DatEngine::DatMaths::Vector<4, TComponent> {
+struct alignas(DatEngine::DatMaths::Simd::vec4Alignment<TComponent>) DatEngine::DatMaths::Vector<4, TComponent> {
 
     /** The components of the vector */
     TComponent x, y, z, w;
@@ -141,6 +145,29 @@ struct DatEngine::DatMaths::Vector<4, TComponent> {
         x(static_cast<TComponent>(otherVec[0])), y(static_cast<TComponent>(otherVec[1])),
         z(static_cast<TComponent>(otherVec[2])), w(static_cast<TComponent>(otherVec[3])) {}
 
+#ifdef DAT_SIMD_SSE
+    // SIMD
+    /**
+     * Initialise using the lanes of an SSE register
+     * @param simd The register to source the values of the X, Y, Z and W components from
+     */
+    explicit Vector(const __m128 simd)
+        requires Simd::CSimdFloat<TComponent>
+    {
+        _mm_store_ps(&x, simd);
+    }
+
+    /**
+     * Load the components of the vector into an SSE register
+     * @return A register containing {x, y, z, w}
+     */
+    __m128 toSimd() const
+        requires Simd::CSimdFloat<TComponent>
+    {
+        return _mm_load_ps(&x);
+    }
+#endif
+
     /* -------------------------------------------- */
 
     // Assignment operator
@@ -196,7 +223,7 @@ struct DatEngine::DatMaths::Vector<4, TComponent> {
     /* -------------------------------------------- */
 
     //   Negation
-    Vector operator-();
+    Vector operator-() const;
 
     /* -------------------------------------------- */
 
@@ -8,6 +8,12 @@ namespace DatEngine::DatMaths {
     template<typename TComponent>
     template<typename TOther>
     Vector<4, TComponent>& Vector<4, TComponent>::operator=(const Vector<4, TOther>& otherVec) {
+#ifdef DAT_SIMD_SSE
+        if constexpr (Simd::CSimdFloat<TComponent, TOther>) {
+            _mm_store_ps(&x, otherVec.toSimd());
+            return *this;
+        }
+#endif
         x = static_cast<TComponent>(otherVec.x);
         y = static_cast<TComponent>(otherVec.y);
         z = static_cast<TComponent>(otherVec.z);
@@ -38,6 +44,11 @@ namespace DatEngine::DatMaths {
     template<typename TComponent>
     template<typename TOther>
     Vector<4, TComponent> Vector<4, TComponent>::operator+(const Vector<4, TOther>& rhs) const {
+#ifdef DAT_SIMD_SSE
+        if constexpr (Simd::CSimdFloat<TComponent, TOther>) {
+            return Vector(_mm_add_ps(toSimd(), rhs.toSimd()));
+        }
+#endif
         return {x + static_cast<TComponent>(rhs.x),
                 y + static_cast<TComponent>(rhs.y),
                 z + static_cast<TComponent>(rhs.z),
@@ -47,6 +58,11 @@ namespace DatEngine::DatMaths {
     template<typename TComponent>
     template<typename TOther>
     Vector<4, TComponent> Vector<4, TComponent>::operator+(const TOther rhs) const {
+#ifdef DAT_SIMD_SSE
+        if constexpr (Simd::CSimdFloat<TComponent>) {
+            return Vector(_mm_add_ps(toSimd(), _mm_set1_ps(static_cast<float>(rhs))));
+        }
+#endif
         return {x + static_cast<TComponent>(rhs),
                 y + static_cast<TComponent>(rhs),
                 z + static_cast<TComponent>(rhs),
@@ -56,6 +72,12 @@ namespace DatEngine::DatMaths {
     template<typename TComponent>
     template<typename TOther>
     Vector<4, TComponent>& Vector<4, TComponent>::operator+=(const Vector<4, TOther>& rhs) {
+#ifdef DAT_SIMD_SSE
+        if constexpr (Simd::CSimdFloat<TComponent, TOther>) {
+            _mm_store_ps(&x, _mm_add_ps(toSimd(), rhs.toSimd()));
+            return *this;
+        }
+#endif
         x += static_cast<TComponent>(rhs.x);
         y += static_cast<TComponent>(rhs.y);
         z += static_cast<TComponent>(rhs.z);
@@ -67,6 +89,12 @@ namespace DatEngine::DatMaths {
     template<typename TComponent>
     template<typename TOther>
     Vector<4, TComponent>& Vector<4, TComponent>::operator+=(const TOther rhs) {
+#ifdef DAT_SIMD_SSE
+        if constexpr (Simd::CSimdFloat<TComponent>) {
+            _mm_store_ps(&x, _mm_add_ps(toSimd(), _mm_set1_ps(static_cast<float>(rhs))));
+            return *this;
+        }
+#endif
         x += static_cast<TComponent>(rhs);
         y += static_cast<TComponent>(rhs);
         z += static_cast<TComponent>(rhs);
@@ -80,6 +108,11 @@ namespace DatEngine::DatMaths {
     template<typename TComponent>
     template<typename TOther>
     Vector<4, TComponent> Vector<4, TComponent>::operator-(const Vector<4, TOther>& rhs) const {
+#ifdef DAT_SIMD_SSE
+        if constexpr (Simd::CSimdFloat<TComponent, TOther>) {
+            return Vector(_mm_sub_ps(toSimd(), rhs.toSimd()));
+        }
+#endif
         return {x - static_cast<TComponent>(rhs.x),
                 y - static_cast<TComponent>(rhs.y),
                 z - static_cast<TComponent>(rhs.z),
@@ -89,6 +122,11 @@ namespace DatEngine::DatMaths {
     template<typename TComponent>
     template<typename TOther>
     Vector<4, TComponent> Vector<4, TComponent>::operator-(const TOther rhs) const {
+#ifdef DAT_SIMD_SSE
+        if constexpr (Simd::CSimdFloat<TComponent>) {
+            return Vector(_mm_sub_ps(toSimd(), _mm_set1_ps(static_cast<float>(rhs))));
+        }
+#endif
         return {x - static_cast<TComponent>(rhs),
                 y - static_cast<TComponent>(rhs),
                 z - static_cast<TComponent>(rhs),
@@ -98,6 +136,12 @@ namespace DatEngine::DatMaths {
     template<typename TComponent>
     template<typename TOther>
     Vector<4, TComponent>& Vector<4, TComponent>::operator-=(const Vector<4, TOther>& rhs) {
+#ifdef DAT_SIMD_SSE
+        if constexpr (Simd::CSimdFloat<TComponent, TOther>) {
+            _mm_store_ps(&x, _mm_sub_ps(toSimd(), rhs.toSimd()));
+            return *this;
+        }
+#endif
         x -= static_cast<TComponent>(rhs.x);
         y -= static_cast<TComponent>(rhs.y);
         z -= static_cast<TComponent>(rhs.z);
@@ -109,6 +153,12 @@ namespace DatEngine::DatMaths {
     template<typename TComponent>
     template<typename TOther>
     Vector<4, TComponent>& Vector<4, TComponent>::operator-=(const TOther rhs) {
+#ifdef DAT_SIMD_SSE
+        if constexpr (Simd::CSimdFloat<TComponent>) {
+            _mm_store_ps(&x, _mm_sub_ps(toSimd(), _mm_set1_ps(static_cast<float>(rhs))));
+            return *this;
+        }
+#endif
         x -= static_cast<TComponent>(rhs);
         y -= static_cast<TComponent>(rhs);
         z -= static_cast<TComponent>(rhs);
@@ -120,7 +170,12 @@ namespace DatEngine::DatMaths {
     /* -------------------------------------------- */
 
     template<typename TComponent>
-    Vector<4, TComponent> Vector<4, TComponent>::operator-() {
+    Vector<4, TComponent> Vector<4, TComponent>::operator-() const {
+#ifdef DAT_SIMD_SSE
+        if constexpr (Simd::CSimdFloat<TComponent>) {
+            return Vector(_mm_xor_ps(toSimd(), _mm_set1_ps(-0.f)));
+        }
+#endif
         return {-x, -y, -z, -w};
     }
 
@@ -129,6 +184,11 @@ namespace DatEngine::DatMaths {
     template<typename TComponent>
     template<typename TOther>
     Vector<4, TComponent> Vector<4, TComponent>::operator*(const Vector<4, TOther>& rhs) const {
+#ifdef DAT_SIMD_SSE
+        if constexpr (Simd::CSimdFloat<TComponent, TOther>) {
+            return Vector(_mm_mul_ps(toSimd(), rhs.toSimd()));
+        }
+#endif
         return {x * static_cast<TComponent>(rhs.x),
                 y * static_cast<TComponent>(rhs.y),
                 z * static_cast<TComponent>(rhs.z),
@@ -138,6 +198,11 @@ namespace DatEngine::DatMaths {
     template<typename TComponent>
     template<typename TOther>
     Vector<4, TComponent> Vector<4, TComponent>::operator*(const TOther rhs) const {
+#ifdef DAT_SIMD_SSE
+        if constexpr (Simd::CSimdFloat<TComponent>) {
+            return Vector(_mm_mul_ps(toSimd(), _mm_set1_ps(static_cast<float>(rhs))));
+        }
+#endif
         return {x * static_cast<TComponent>(rhs),
                 y * static_cast<TComponent>(rhs),
                 z * static_cast<TComponent>(rhs),
@@ -147,6 +212,12 @@ namespace DatEngine::DatMaths {
     template<typename TComponent>
     template<typename TOther>
     Vector<4, TComponent>& Vector<4, TComponent>::operator*=(const Vector<4, TOther>& rhs) {
+#ifdef DAT_SIMD_SSE
+        if constexpr (Simd::CSimdFloat<TComponent, TOther>) {
+            _mm_store_ps(&x, _mm_mul_ps(toSimd(), rhs.toSimd()));
+            return *this;
+        }
+#endif
         x *= static_cast<TComponent>(rhs.x);
         y *= static_cast<TComponent>(rhs.y);
         z *= static_cast<TComponent>(rhs.z);
@@ -158,6 +229,12 @@ namespace DatEngine::DatMaths {
     template<typename TComponent>
     template<typename TOther>
     Vector<4, TComponent>& Vector<4, TComponent>::operator*=(const TOther rhs) {
+#ifdef DAT_SIMD_SSE
+        if constexpr (Simd::CSimdFloat<TComponent>) {
+            _mm_store_ps(&x, _mm_mul_ps(toSimd(), _mm_set1_ps(static_cast<float>(rhs))));
+            return *this;
+        }
+#endif
         x *= static_cast<TComponent>(rhs);
         y *= static_cast<TComponent>(rhs);
         z *= static_cast<TComponent>(rhs);
@@ -171,6 +248,11 @@ namespace DatEngine::DatMaths {
     template<typename TComponent>
     template<typename TOther>
     Vector<4, TComponent> Vector<4, TComponent>::operator/(const Vector<4, TOther>& rhs) const {
+#ifdef DAT_SIMD_SSE
+        if constexpr (Simd::CSimdFloat<TComponent, TOther>) {
+            return Vector(_mm_div_ps(toSimd(), rhs.toSimd()));
+        }
+#endif
         return {x / static_cast<TComponent>(rhs.x),
                 y / static_cast<TComponent>(rhs.y),
                 z / static_cast<TComponent>(rhs.z),
@@ -180,6 +262,11 @@ namespace DatEngine::DatMaths {
     template<typename TComponent>
     template<typename TOther>
     Vector<4, TComponent> Vector<4, TComponent>::operator/(const TOther rhs) const {
+#ifdef DAT_SIMD_SSE
+        if constexpr (Simd::CSimdFloat<TComponent>) {
+            return Vector(_mm_div_ps(toSimd(), _mm_set1_ps(static_cast<float>(rhs))));
+        }
+#endif
         return {x / static_cast<TComponent>(rhs),
                 y / static_cast<TComponent>(rhs),
                 z / static_cast<TComponent>(rhs),
@@ -189,6 +276,12 @@ namespace DatEngine::DatMaths {
     template<typename TComponent>
     template<typename TOther>
     Vector<4, TComponent>& Vector<4, TComponent>::operator/=(const Vector<4, TOther>& rhs) {
+#ifdef DAT_SIMD_SSE
+        if constexpr (Simd::CSimdFloat<TComponent, TOther>) {
+            _mm_store_ps(&x, _mm_div_ps(toSimd(), rhs.toSimd()));
+            return *this;
+        }
+#endif
         x /= static_cast<TComponent>(rhs.x);
         y /= static_cast<TComponent>(rhs.y);
         z /= static_cast<TComponent>(rhs.z);
@@ -200,6 +293,12 @@ namespace DatEngine::DatMaths {
     template<typename TComponent>
     template<typename TOther>
     Vector<4, TComponent>& Vector<4, TComponent>::operator/=(const TOther rhs) {
+#ifdef DAT_SIMD_SSE
+        if constexpr (Simd::CSimdFloat<TComponent>) {
+            _mm_store_ps(&x, _mm_div_ps(toSimd(), _mm_set1_ps(static_cast<float>(rhs))));
+            return *this;
+        }
+#endif
         x /= static_cast<TComponent>(rhs);
         y /= static_cast<TComponent>(rhs);
         z /= static_cast<TComponent>(rhs);
@@ -213,6 +312,11 @@ namespace DatEngine::DatMaths {
     template<typename TComponent>
     template<typename TOther>
     TComponent Vector<4, TComponent>::dotProduct(Vector<4, TOther> otherVec) const {
+#ifdef DAT_SIMD_SSE
+        if constexpr (Simd::CSimdFloat<TComponent, TOther>) {
+            return _mm_cvtss_f32(_mm_dp_ps(toSimd(), otherVec.toSimd(), 0xFF));
+        }
+#endif
         return x * static_cast<TComponent>(otherVec.x) + y * static_cast<TComponent>(otherVec.y)
                + z * static_cast<TComponent>(otherVec.z) + w * static_cast<TComponent>(otherVec.w);
     }
@@ -226,6 +330,12 @@ namespace DatEngine::DatMaths {
 
     template<typename TComponent>
     TComponent Vector<4, TComponent>::lengthSquared() const {
+#ifdef DAT_SIMD_SSE
+        if constexpr (Simd::CSimdFloat<TComponent>) {
+            const __m128 simd = toSimd();
+            return _mm_cvtss_f32(_mm_dp_ps(simd, simd, 0xFF));
+        }
+#endif
         return x * x + y * y + z * z + w * w;
     }
 
@@ -233,7 +343,14 @@ namespace DatEngine::DatMaths {
 
     template<typename TComponent>
     void Vector<4, TComponent>::normalise() {
-        TComponent invLength = DatMaths::invSqrt(lengthSquared());
+#ifdef DAT_SIMD_SSE
+        if constexpr (Simd::CSimdFloat<TComponent>) {
+            const __m128 simd = toSimd();
+            _mm_store_ps(&x, _mm_mul_ps(simd, DatMaths::invSqrt<Precision::Fast>(_mm_dp_ps(simd, simd, 0xFF))));
+            return;
+        }
+#endif
+        TComponent invLength = DatMaths::invSqrt<Precision::Fast>(lengthSquared());
         x *= invLength;
         y *= invLength;
         z *= invLength;
@@ -242,7 +359,13 @@ namespace DatEngine::DatMaths {
 
     template<typename TComponent>
     Vector<4, TComponent> Vector<4, TComponent>::normalised() const {
-        TComponent invLength = DatMaths::invSqrt(lengthSquared());
+#ifdef DAT_SIMD_SSE
+        if constexpr (Simd::CSimdFloat<TComponent>) {
+            const __m128 simd = toSimd();
+            return Vector(_mm_mul_ps(simd, DatMaths::invSqrt<Precision::Fast>(_mm_dp_ps(simd, simd, 0xFF))));
+        }
+#endif
+        TComponent invLength = DatMaths::invSqrt<Precision::Fast>(lengthSquared());
 
         return {x * invLength, y * invLength, z * invLength, w * invLength};
     }
@@ -259,12 +382,23 @@ namespace DatEngine::DatMaths {
     template<typename TComponent>
     template<typename TOther>
     bool Vector<4, TComponent>::operator==(const Vector<4, TOther>& rhs) const {
+#ifdef DAT_SIMD_SSE
+        if constexpr (Simd::CSimdFloat<TComponent, TOther>) {
+            return _mm_movemask_ps(_mm_cmpeq_ps(toSimd(), rhs.toSimd())) == 0xF;
+        }
+#endif
         return x == rhs.x && y == rhs.y && z == rhs.z && w == rhs.w;
     }
 
     template<typename TComponent>
     template<typename TOther>
     bool Vector<4, TComponent>::equal(const Vector<4, TOther>& rhs, TComponent tolerance) const {
+#ifdef DAT_SIMD_SSE
+        if constexpr (Simd::CSimdFloat<TComponent, TOther>) {
+            const __m128 difference = Simd::abs(_mm_sub_ps(toSimd(), rhs.toSimd()));
+            return _mm_movemask_ps(_mm_cmplt_ps(difference, _mm_set1_ps(tolerance))) == 0xF;
+        }
+#endif
         return std::abs(x - static_cast<TComponent>(rhs.x)) < tolerance
                && std::abs(y - static_cast<TComponent>(rhs.y)) < tolerance
                && std::abs(z - static_cast<TComponent>(rhs.z)) < tolerance
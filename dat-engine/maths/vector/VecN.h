@@ -2,6 +2,7 @@
 
 #include "VecForward.h"
 
+#include <array>
 #include <cassert>
 #include <compare>
 
@@ -190,12 +191,13 @@ namespace DatEngine {
         /* -------------------------------------------- */
 
         //   Negation
-        Vector operator-() {
+        Vector operator-() const {
+            Vector result;
             for (int i = 0; i < size; ++i) {
-                (*this)[i] = -(*this)[i];
+                result[i] = -(*this)[i];
             }
 
-            return *this;
+            return result;
         }
 
         /* -------------------------------------------- */
@@ -334,7 +336,7 @@ namespace DatEngine {
          * Normalise the vector in place
          */
         void normalise() {
-            TComponent invLength = DatMaths::invSqrt(lengthSquared());
+            TComponent invLength = DatMaths::invSqrt<Precision::Fast>(lengthSquared());
 
             for (int i = 0; i < size; ++i) {
                 (*this)[i] *= invLength;
@@ -348,7 +350,7 @@ namespace DatEngine {
         Vector normalised() const {
             Vector newVec;
 
-            TComponent invLength = DatMaths::invSqrt(lengthSquared());
+            TComponent invLength = DatMaths::invSqrt<Precision::Fast>(lengthSquared());
             for (int i = 0; i < size; ++i) {
                 newVec[i] = (*this)[i] * invLength;
             }
@@ -0,0 +1,468 @@
+#include "VecSoA.h"
+
+using namespace DatEngine;
+using namespace DatEngine::DatMaths;
+
+namespace {
+    /* -------------------------------------------- */
+    /*  Component Operations                        */
+    /* -------------------------------------------- */
+
+    // Each operation has an 8 wide overload for AVX and a scalar overload for the tail
+
+    struct Add {
+#ifdef DAT_SIMD_AVX
+        __m256 operator()(const __m256 lhs, const __m256 rhs) const { return _mm256_add_ps(lhs, rhs); }
+#endif
+        float operator()(const float lhs, const float rhs) const { return lhs + rhs; }
+    };
+
+    struct Subtract {
+#ifdef DAT_SIMD_AVX
+        __m256 operator()(const __m256 lhs, const __m256 rhs) const { return _mm256_sub_ps(lhs, rhs); }
+#endif
+        float operator()(const float lhs, const float rhs) const { return lhs - rhs; }
+    };
+
+    struct Multiply {
+#ifdef DAT_SIMD_AVX
+        __m256 operator()(const __m256 lhs, const __m256 rhs) const { return _mm256_mul_ps(lhs, rhs); }
+#endif
+        float operator()(const float lhs, const float rhs) const { return lhs * rhs; }
+    };
+
+    struct MultiplyAdd {
+        float scalar;
+
+#ifdef DAT_SIMD_AVX
+        __m256 operator()(const __m256 lhs, const __m256 rhs) const {
+            return Simd::multiplyAdd(rhs, _mm256_set1_ps(scalar), lhs);
+        }
+#endif
+        float operator()(const float lhs, const float rhs) const { return lhs + rhs * scalar; }
+    };
+
+    struct Lerp {
+        float alpha;
+
+#ifdef DAT_SIMD_AVX
+        __m256 operator()(const __m256 lhs, const __m256 rhs) const {
+            return Simd::multiplyAdd(_mm256_sub_ps(rhs, lhs), _mm256_set1_ps(alpha), lhs);
+        }
+#endif
+        float operator()(const float lhs, const float rhs) const { return lhs + (rhs - lhs) * alpha; }
+    };
+
+    /**
+     * Apply an operation to each element of an array and the matching element of another, in place
+     */
+    template<typename TOp>
+    void applyArrays(float* dst, const float* src, const size_t count, const TOp op) {
+        size_t i = 0;
+#ifdef DAT_SIMD_AVX
+        for (; i + 8 <= count; i += 8) {
+            _mm256_storeu_ps(dst + i, op(_mm256_loadu_ps(dst + i), _mm256_loadu_ps(src + i)));
+        }
+#endif
+        for (; i < count; ++i) {
+            dst[i] = op(dst[i], src[i]);
+        }
+    }
+
+    /**
+     * Apply an operation to each element of an array and a single value, in place
+     */
+    template<typename TOp>
+    void applyValue(float* dst, const float value, const size_t count, const TOp op) {
+        size_t i = 0;
+#ifdef DAT_SIMD_AVX
+        const __m256 broadcast = _mm256_set1_ps(value);
+        for (; i + 8 <= count; i += 8) {
+            _mm256_storeu_ps(dst + i, op(_mm256_loadu_ps(dst + i), broadcast));
+        }
+#endif
+        for (; i < count; ++i) {
+            dst[i] = op(dst[i], value);
+        }
+    }
+
+    /**
+     * Compute the dot product of each vector in two streams, given as an array per component
+     */
+    template<int size>
+    void dotArrays(const float* const* lhs, const float* const* rhs, float* out, const size_t count) {
+        size_t i = 0;
+#ifdef DAT_SIMD_AVX
+        for (; i + 8 <= count; i += 8) {
+            __m256 result = _mm256_mul_ps(_mm256_loadu_ps(lhs[0] + i), _mm256_loadu_ps(rhs[0] + i));
+            for (int c = 1; c < size; ++c) {
+                result = Simd::multiplyAdd(_mm256_loadu_ps(lhs[c] + i), _mm256_loadu_ps(rhs[c] + i), result);
+            }
+            _mm256_storeu_ps(out + i, result);
+        }
+#endif
+        for (; i < count; ++i) {
+            float result = lhs[0][i] * rhs[0][i];
+            for (int c = 1; c < size; ++c) {
+                result += lhs[c][i] * rhs[c][i];
+            }
+            out[i] = result;
+        }
+    }
+} // namespace
+
+/* -------------------------------------------- */
+/*  Initialisation                              */
+/* -------------------------------------------- */
+
+template<int size>
+    requires(size == 3 || size == 4)
+DatMaths::VectorSoA<size>::VectorSoA(const size_t count) {
+    resize(count);
+}
+
+template<int size>
+    requires(size == 3 || size == 4)
+DatMaths::VectorSoA<size>::VectorSoA(const std::span<const TVector> vectors) {
+    copyFrom(vectors);
+}
+
+/* -------------------------------------------- */
+/*  Conversion                                  */
+/* -------------------------------------------- */
+
+template<int size>
+    requires(size == 3 || size == 4)
+void DatMaths::VectorSoA<size>::copyFrom(const std::span<const TVector> vectors) {
+    resize(vectors.size());
+
+    size_t i = 0;
+#ifdef DAT_SIMD_AVX
+    if constexpr (size == 3) {
+        for (; i + 8 <= vectors.size(); i += 8) {
+            __m256 x, y, z;
+            Simd::loadVec3x8(&vectors[i].x, x, y, z);
+            _mm256_storeu_ps(components[0].data() + i, x);
+            _mm256_storeu_ps(components[1].data() + i, y);
+            _mm256_storeu_ps(components[2].data() + i, z);
+        }
+    }
+#endif
+#ifdef DAT_SIMD_SSE
+    if constexpr (size == 4) {
+        for (; i + 4 <= vectors.size(); i += 4) {
+            __m128 x = vectors[i].toSimd();
+            __m128 y = vectors[i + 1].toSimd();
+            __m128 z = vectors[i + 2].toSimd();
+            __m128 w = vectors[i + 3].toSimd();
+            _MM_TRANSPOSE4_PS(x, y, z, w);
+            _mm_storeu_ps(components[0].data() + i, x);
+            _mm_storeu_ps(components[1].data() + i, y);
+            _mm_storeu_ps(components[2].data() + i, z);
+            _mm_storeu_ps(components[3].data() + i, w);
+        }
+    }
+#endif
+    for (; i < vectors.size(); ++i) {
+        set(i, vectors[i]);
+    }
+}
+
+template<int size>
+    requires(size == 3 || size == 4)
+void DatMaths::VectorSoA<size>::copyTo(const std::span<TVector> out) const {
+    assert(out.size() >= count());
+
+    size_t i = 0;
+#ifdef DAT_SIMD_AVX
+    if constexpr (size == 3) {
+        for (; i + 8 <= count(); i += 8) {
+            Simd::storeVec3x8(
+                    &out[i].x, _mm256_loadu_ps(components[0].data() + i), _mm256_loadu_ps(components[1].data() + i),
+                    _mm256_loadu_ps(components[2].data() + i)
+            );
+        }
+    }
+#endif
+#ifdef DAT_SIMD_SSE
+    if constexpr (size == 4) {
+        for (; i + 4 <= count(); i += 4) {
+            __m128 x = _mm_loadu_ps(components[0].data() + i);
+            __m128 y = _mm_loadu_ps(components[1].data() + i);
+            __m128 z = _mm_loadu_ps(components[2].data() + i);
+            __m128 w = _mm_loadu_ps(components[3].data() + i);
+            _MM_TRANSPOSE4_PS(x, y, z, w);
+            out[i] = TVector(x);
+            out[i + 1] = TVector(y);
+            out[i + 2] = TVector(z);
+            out[i + 3] = TVector(w);
+        }
+    }
+#endif
+    for (; i < count(); ++i) {
+        out[i] = get(i);
+    }
+}
+
+/* -------------------------------------------- */
+/*  Access                                      */
+/* -------------------------------------------- */
+
+template<int size>
+    requires(size == 3 || size == 4)
+DatMaths::Vector<size, float> DatMaths::VectorSoA<size>::get(const size_t index) const {
+    assert(index < count());
+
+    TVector result;
+    for (int c = 0; c < size; ++c) {
+        result[c] = components[c][index];
+    }
+    return result;
+}
+
+template<int size>
+    requires(size == 3 || size == 4)
+void DatMaths::VectorSoA<size>::set(const size_t index, const TVector& vec) {
+    assert(index < count());
+
+    for (int c = 0; c < size; ++c) {
+        components[c][index] = vec[c];
+    }
+}
+
+/* -------------------------------------------- */
+/*  Capacity                                    */
+/* -------------------------------------------- */
+
+template<int size>
+    requires(size == 3 || size == 4)
+void DatMaths::VectorSoA<size>::resize(const size_t count) {
+    for (std::vector<float>& component : components) {
+        component.resize(count, 0.f);
+    }
+}
+
+template<int size>
+    requires(size == 3 || size == 4)
+void DatMaths::VectorSoA<size>::reserve(const size_t count) {
+    for (std::vector<float>& component : components) {
+        component.reserve(count);
+    }
+}
+
+template<int size>
+    requires(size == 3 || size == 4)
+void DatMaths::VectorSoA<size>::pushBack(const TVector& vec) {
+    for (int c = 0; c < size; ++c) {
+        components[c].push_back(vec[c]);
+    }
+}
+
+template<int size>
+    requires(size == 3 || size == 4)
+void DatMaths::VectorSoA<size>::clear() {
+    for (std::vector<float>& component : components) {
+        component.clear();
+    }
+}
+
+/* -------------------------------------------- */
+/*  Maths                                       */
+/* -------------------------------------------- */
+
+template<int size>
+    requires(size == 3 || size == 4)
+void DatMaths::VectorSoA<size>::add(const VectorSoA& rhs) {
+    assert(rhs.count() == count());
+
+    for (int c = 0; c < size; ++c) {
+        applyArrays(components[c].data(), rhs.components[c].data(), count(), Add{});
+    }
+}
+
+template<int size>
+    requires(size == 3 || size == 4)
+void DatMaths::VectorSoA<size>::add(const TVector& rhs) {
+    for (int c = 0; c < size; ++c) {
+        applyValue(components[c].data(), rhs[c], count(), Add{});
+    }
+}
+
+template<int size>
+    requires(size == 3 || size == 4)
+void DatMaths::VectorSoA<size>::subtract(const VectorSoA& rhs) {
+    assert(rhs.count() == count());
+
+    for (int c = 0; c < size; ++c) {
+        applyArrays(components[c].data(), rhs.components[c].data(), count(), Subtract{});
+    }
+}
+
+template<int size>
+    requires(size == 3 || size == 4)
+void DatMaths::VectorSoA<size>::multiply(const VectorSoA& rhs) {
+    assert(rhs.count() == count());
+
+    for (int c = 0; c < size; ++c) {
+        applyArrays(components[c].data(), rhs.components[c].data(), count(), Multiply{});
+    }
+}
+
+template<int size>
+    requires(size == 3 || size == 4)
+void DatMaths::VectorSoA<size>::multiply(const float scalar) {
+    for (int c = 0; c < size; ++c) {
+        applyValue(components[c].data(), scalar, count(), Multiply{});
+    }
+}
+
+template<int size>
+    requires(size == 3 || size == 4)
+void DatMaths::VectorSoA<size>::multiplyAdd(const VectorSoA& rhs, const float scalar) {
+    assert(rhs.count() == count());
+
+    for (int c = 0; c < size; ++c) {
+        applyArrays(components[c].data(), rhs.components[c].data(), count(), MultiplyAdd{scalar});
+    }
+}
+
+/* -------------------------------------------- */
+
+template<int size>
+    requires(size == 3 || size == 4)
+void DatMaths::VectorSoA<size>::dotProduct(const VectorSoA& rhs, const std::span<float> out) const {
+    assert(rhs.count() == count());
+    assert(out.size() >= count());
+
+    const float* lhsComponents[size];
+    const float* rhsComponents[size];
+    for (int c = 0; c < size; ++c) {
+        lhsComponents[c] = components[c].data();
+        rhsComponents[c] = rhs.components[c].data();
+    }
+
+    dotArrays<size>(lhsComponents, rhsComponents, out.data(), count());
+}
+
+template<int size>
+    requires(size == 3 || size == 4)
+void DatMaths::VectorSoA<size>::crossProduct(const VectorSoA& rhs, VectorSoA& out) const
+    requires(size == 3)
+{
+    assert(rhs.count() == count());
+
+    const size_t n = count();
+    out.resize(n);
+
+    const float* ax = components[0].data();
+    const float* ay = components[1].data();
+    const float* az = components[2].data();
+    const float* bx = rhs.components[0].data();
+    const float* by = rhs.components[1].data();
+    const float* bz = rhs.components[2].data();
+    float* ox = out.components[0].data();
+    float* oy = out.components[1].data();
+    float* oz = out.components[2].data();
+
+    // Every input for an index is read before any output is written, so out can alias either input
+    size_t i = 0;
+#ifdef DAT_SIMD_AVX
+    for (; i + 8 <= n; i += 8) {
+        const __m256 x0 = _mm256_loadu_ps(ax + i);
+        const __m256 y0 = _mm256_loadu_ps(ay + i);
+        const __m256 z0 = _mm256_loadu_ps(az + i);
+        const __m256 x1 = _mm256_loadu_ps(bx + i);
+        const __m256 y1 = _mm256_loadu_ps(by + i);
+        const __m256 z1 = _mm256_loadu_ps(bz + i);
+
+        _mm256_storeu_ps(ox + i, _mm256_sub_ps(_mm256_mul_ps(y0, z1), _mm256_mul_ps(z0, y1)));
+        _mm256_storeu_ps(oy + i, _mm256_sub_ps(_mm256_mul_ps(z0, x1), _mm256_mul_ps(x0, z1)));
+        _mm256_storeu_ps(oz + i, _mm256_sub_ps(_mm256_mul_ps(x0, y1), _mm256_mul_ps(y0, x1)));
+    }
+#endif
+    for (; i < n; ++i) {
+        const float x = ay[i] * bz[i] - az[i] * by[i];
+        const float y = az[i] * bx[i] - ax[i] * bz[i];
+        const float z = ax[i] * by[i] - ay[i] * bx[i];
+        ox[i] = x;
+        oy[i] = y;
+        oz[i] = z;
+    }
+}
+
+/* -------------------------------------------- */
+
+template<int size>
+    requires(size == 3 || size == 4)
+void DatMaths::VectorSoA<size>::length(const std::span<float> out) const {
+    lengthSquared(out);
+
+    size_t i = 0;
+#ifdef DAT_SIMD_AVX
+    for (; i + 8 <= count(); i += 8) {
+        _mm256_storeu_ps(out.data() + i, DatMaths::sqrt(_mm256_loadu_ps(out.data() + i)));
+    }
+#endif
+    for (; i < count(); ++i) {
+        out[i] = DatMaths::sqrt(out[i]);
+    }
+}
+
+template<int size>
+    requires(size == 3 || size == 4)
+void DatMaths::VectorSoA<size>::lengthSquared(const std::span<float> out) const {
+    dotProduct(*this, out);
+}
+
+template<int size>
+    requires(size == 3 || size == 4)
+void DatMaths::VectorSoA<size>::normalise() {
+    const size_t n = count();
+
+    size_t i = 0;
+#ifdef DAT_SIMD_AVX
+    for (; i + 8 <= n; i += 8) {
+        __m256 values[size];
+        __m256 lengthSquared = _mm256_setzero_ps();
+        for (int c = 0; c < size; ++c) {
+            values[c] = _mm256_loadu_ps(components[c].data() + i);
+            lengthSquared = Simd::multiplyAdd(values[c], values[c], lengthSquared);
+        }
+
+        const __m256 invLength = DatMaths::invSqrt<Precision::Fast>(lengthSquared);
+        for (int c = 0; c < size; ++c) {
+            _mm256_storeu_ps(components[c].data() + i, _mm256_mul_ps(values[c], invLength));
+        }
+    }
+#endif
+    for (; i < n; ++i) {
+        float lengthSquared = 0.f;
+        for (int c = 0; c < size; ++c) {
+            lengthSquared += components[c][i] * components[c][i];
+        }
+
+        const float invLength = DatMaths::invSqrt<Precision::Fast>(lengthSquared);
+        for (int c = 0; c < size; ++c) {
+            components[c][i] *= invLength;
+        }
+    }
+}
+
+/* -------------------------------------------- */
+
+template<int size>
+    requires(size == 3 || size == 4)
+void DatMaths::VectorSoA<size>::lerp(const VectorSoA& target, const float alpha) {
+    assert(target.count() == count());
+
+    for (int c = 0; c < size; ++c) {
+        applyArrays(components[c].data(), target.components[c].data(), count(), Lerp{alpha});
+    }
+}
+
+/* -------------------------------------------- */
+/*  Instantiations                              */
+/* -------------------------------------------- */
+
+template class DatMaths::VectorSoA<3>;
+template class DatMaths::VectorSoA<4>;
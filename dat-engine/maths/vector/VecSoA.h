@@ -0,0 +1,254 @@
+#pragma once
+
+#include <cassert>
+#include <span>
+#include <vector>
+
+#include <maths/Vector.h>
+
+namespace DatEngine::DatMaths {
+    /**
+     * A stream of float vectors stored as a structure of arrays, with a separate contiguous array for each component
+     * <br>
+     * This layout lets the bulk operations process 8 vectors per instruction with AVX, making it preferable to a span
+     * of vectors for large homogeneous workloads like particles and physics. Individual vectors can still be read and
+     * written, but this is slower than with an array of vectors.
+     *
+     * @tparam size The number of components of each vector, either 3 or 4
+     */
+    template<int size>
+        requires(size == 3 || size == 4)
+    class VectorSoA {
+        /** The type of a single vector in the stream */
+        using TVector = Vector<size, float>;
+
+        /** The arrays holding each component of the vectors */
+        std::vector<float> components[size];
+
+    public:
+        /* -------------------------------------------- */
+        /*  Initialisation                              */
+        /* -------------------------------------------- */
+
+        VectorSoA() = default;
+
+        /**
+         * Initialise the stream with a number of zeroed vectors
+         * @param count The number of vectors in the stream
+         */
+        explicit VectorSoA(size_t count);
+
+        /**
+         * Initialise the stream by copying the vectors from an array of vectors
+         * @param vectors The vectors to copy into the stream
+         */
+        explicit VectorSoA(std::span<const TVector> vectors);
+
+        /* -------------------------------------------- */
+        /*  Conversion                                  */
+        /* -------------------------------------------- */
+
+        /**
+         * Replace the contents of the stream with the vectors from an array of vectors
+         * @param vectors The vectors to copy into the stream
+         */
+        void copyFrom(std::span<const TVector> vectors);
+
+        /**
+         * Copy the vectors in the stream into an array of vectors
+         * @param out The span to write the vectors to, must be at least as big as the stream
+         */
+        void copyTo(std::span<TVector> out) const;
+
+        /* -------------------------------------------- */
+        /*  Access                                      */
+        /* -------------------------------------------- */
+
+        /**
+         * Get a copy of the vector at the given index
+         * @param index The index of the vector
+         * @return The vector at the given index
+         */
+        TVector get(size_t index) const;
+
+        /**
+         * Set the vector at the given index
+         * @param index The index of the vector
+         * @param vec The new value of the vector
+         */
+        void set(size_t index, const TVector& vec);
+
+        /**
+         * Get the array for a single component of every vector in the stream
+         * @param component The index of the component (0 for x, 1 for y, etc)
+         * @return The array containing the given component
+         */
+        std::span<float> getComponent(const int component) {
+            assert(component < size);
+            return components[component];
+        }
+
+        /**
+         * Get the array for a single component of every vector in the stream
+         * @param component The index of the component (0 for x, 1 for y, etc)
+         * @return The array containing the given component
+         */
+        std::span<const float> getComponent(const int component) const {
+            assert(component < size);
+            return components[component];
+        }
+
+        std::span<float> x() { return components[0]; }
+        std::span<const float> x() const { return components[0]; }
+
+        std::span<float> y() { return components[1]; }
+        std::span<const float> y() const { return components[1]; }
+
+        std::span<float> z() { return components[2]; }
+        std::span<const float> z() const { return components[2]; }
+
+        std::span<float> w()
+            requires(size == 4)
+        {
+            return components[3];
+        }
+
+        std::span<const float> w() const
+            requires(size == 4)
+        {
+            return components[3];
+        }
+
+        /* -------------------------------------------- */
+        /*  Capacity                                    */
+        /* -------------------------------------------- */
+
+        /**
+         * Get the number of vectors in the stream
+         * @return The number of vectors in the stream
+         */
+        [[nodiscard]] size_t count() const { return components[0].size(); }
+
+        /**
+         * Resize the stream, new vectors will be zeroed
+         * @param count The new number of vectors in the stream
+         */
+        void resize(size_t count);
+
+        /**
+         * Reserve space for a number of vectors so adding them doesn't reallocate
+         * @param count The number of vectors to reserve space for
+         */
+        void reserve(size_t count);
+
+        /**
+         * Add a vector to the end of the stream
+         * @param vec The vector to add
+         */
+        void pushBack(const TVector& vec);
+
+        /**
+         * Remove all vectors from the stream
+         */
+        void clear();
+
+        /* -------------------------------------------- */
+        /*  Maths                                       */
+        /* -------------------------------------------- */
+
+        /**
+         * Add each vector of another stream to the matching vector of this stream, in place
+         * @param rhs The stream to add, must be the same size as this stream
+         */
+        void add(const VectorSoA& rhs);
+
+        /**
+         * Add a single vector to every vector in the stream, in place
+         * @param rhs The vector to add
+         */
+        void add(const TVector& rhs);
+
+        /**
+         * Subtract each vector of another stream from the matching vector of this stream, in place
+         * @param rhs The stream to subtract, must be the same size as this stream
+         */
+        void subtract(const VectorSoA& rhs);
+
+        /**
+         * Multiply each vector in the stream by the matching vector of another stream, component wise, in place
+         * @param rhs The stream to multiply by, must be the same size as this stream
+         */
+        void multiply(const VectorSoA& rhs);
+
+        /**
+         * Multiply every vector in the stream by a scalar, in place
+         * @param scalar The value to multiply by
+         */
+        void multiply(float scalar);
+
+        /**
+         * Add each vector of another stream, multiplied by a scalar, to the matching vector of this stream, in place
+         * <br>
+         * Useful for integration, i.e. @code position.multiplyAdd(velocity, delta)@endcode
+         *
+         * @param rhs The stream to add, must be the same size as this stream
+         * @param scalar The value to multiply the vectors of \p rhs by
+         */
+        void multiplyAdd(const VectorSoA& rhs, float scalar);
+
+        /* -------------------------------------------- */
+
+        /**
+         * Get the dot product of each vector in this stream with the matching vector in another stream
+         * @param rhs The other stream, must be the same size as this stream
+         * @param out The span to write the dot products to, must be at least as big as the stream
+         */
+        void dotProduct(const VectorSoA& rhs, std::span<float> out) const;
+
+        /**
+         * Get the cross product of each vector in this stream with the matching vector in another stream
+         * @param rhs The other stream, must be the same size as this stream
+         * @param out The stream to write the cross products to, will be resized to match this stream. May be this
+         *            stream or \p rhs
+         */
+        void crossProduct(const VectorSoA& rhs, VectorSoA& out) const
+            requires(size == 3);
+
+        /* -------------------------------------------- */
+
+        /**
+         * Get the magnitude of every vector in the stream
+         * @param out The span to write the magnitudes to, must be at least as big as the stream
+         */
+        void length(std::span<float> out) const;
+
+        /**
+         * Get the magnitude squared of every vector in the stream
+         * @param out The span to write the magnitudes to, must be at least as big as the stream
+         */
+        void lengthSquared(std::span<float> out) const;
+
+        /**
+         * Normalise every vector in the stream in place
+         * <br>
+         * Like Vector::normalise(), this uses the fast inverse square root
+         */
+        void normalise();
+
+        /* -------------------------------------------- */
+
+        /**
+         * Linearly interpolate every vector in the stream towards the matching vector of another stream, in place
+         *
+         * @param target The stream to interpolate towards, must be the same size as this stream
+         * @param alpha How far to interpolate, where 0 leaves the stream unchanged and 1 sets it to \p target
+         */
+        void lerp(const VectorSoA& target, float alpha);
+    };
+
+    /** A stream of floating point 3 component vectors */
+    using Vec3SoA = VectorSoA<3>;
+
+    /** A stream of floating point 4 component vectors */
+    using Vec4SoA = VectorSoA<4>;
+} // namespace DatEngine::DatMaths
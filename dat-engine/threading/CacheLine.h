@@ -0,0 +1,13 @@
+#pragma once
+
+#include <cstddef>
+
+namespace DatEngine::Threading {
+    /**
+     * The assumed size of a cache line, used to keep values written by different threads from sharing a line
+     * <br>
+     * std::hardware_destructive_interference_size isn't used as its value can change between compiler flags, which
+     * would change the layout of any type using it.
+     */
+    inline constexpr size_t cacheLineSize = 64;
+} // namespace DatEngine::Threading
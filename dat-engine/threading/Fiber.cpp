@@ -0,0 +1,151 @@
+#include "Fiber.h"
+
+#include <cassert>
+#include <cstdint>
+#include <new>
+
+#if defined(DAT_ENGINE_FIBER_ASM) || defined(DAT_ENGINE_FIBER_UCONTEXT)
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+
+using namespace DatEngine::Threading;
+
+#if defined(DAT_ENGINE_FIBER_ASM)
+/**
+ * Save the callee saved registers and the SSE and x87 control words on the current stack, store the stack pointer in
+ * from, then load to as the stack pointer and restore the same state from it
+ */
+extern "C" void datEngineSwitchFiber(void** from, void* to);
+/**
+ * The first code run on a new fiber, calls the entry function stored in r13 with the argument stored in r12
+ */
+extern "C" void datEngineFiberStart();
+
+// clang-format off
+asm(R"(
+    .text
+    .p2align 4
+    .globl datEngineSwitchFiber
+    .hidden datEngineSwitchFiber
+    .type datEngineSwitchFiber, @function
+datEngineSwitchFiber:
+    pushq %rbp
+    pushq %rbx
+    pushq %r12
+    pushq %r13
+    pushq %r14
+    pushq %r15
+    subq $8, %rsp
+    stmxcsr (%rsp)
+    fnstcw 4(%rsp)
+
+    movq %rsp, (%rdi)
+    movq %rsi, %rsp
+
+    ldmxcsr (%rsp)
+    fldcw 4(%rsp)
+    addq $8, %rsp
+    popq %r15
+    popq %r14
+    popq %r13
+    popq %r12
+    popq %rbx
+    popq %rbp
+    ret
+    .size datEngineSwitchFiber, .-datEngineSwitchFiber
+
+    .p2align 4
+    .globl datEngineFiberStart
+    .hidden datEngineFiberStart
+    .type datEngineFiberStart, @function
+datEngineFiberStart:
+    movq %r12, %rdi
+    callq *%r13
+    ud2
+    .size datEngineFiberStart, .-datEngineFiberStart
+)");
+// clang-format on
+#endif
+
+#if defined(DAT_ENGINE_FIBER_UCONTEXT)
+void Fiber::start(const unsigned int high, const unsigned int low) {
+    // makecontext only passes int arguments, so the fiber pointer is split in two
+    const auto* fiber = reinterpret_cast<Fiber*>(static_cast<uintptr_t>(high) << 32 | low);
+    fiber->entry(fiber->argument);
+    assert(false && "Fiber entry functions must not return");
+}
+#endif
+
+Fiber::Fiber(const Entry entry, void* argument, const size_t stackSize) {
+#if defined(DAT_ENGINE_FIBER_ASM) || defined(DAT_ENGINE_FIBER_UCONTEXT)
+    const auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    this->stackSize = (stackSize + pageSize - 1) / pageSize * pageSize + pageSize;
+
+    void* memory = mmap(nullptr, this->stackSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (memory == MAP_FAILED) throw std::bad_alloc();
+
+    // Stacks grow down, so an overflow hits the guard page at the bottom instead of another fiber's stack
+    if (mprotect(memory, pageSize, PROT_NONE) != 0) {
+        munmap(memory, this->stackSize);
+        throw std::bad_alloc();
+    }
+    stack = static_cast<std::byte*>(memory);
+#endif
+
+#if defined(DAT_ENGINE_FIBER_ASM)
+    // Lay out the stack as datEngineSwitchFiber would have left it, returning into datEngineFiberStart. The top is
+    // page aligned, so the 80 bytes leave the stack 16 byte aligned at the call to entry.
+    auto* frame = reinterpret_cast<uint64_t*>(stack + this->stackSize) - 10;
+    frame[0] = 0x1F80 | static_cast<uint64_t>(0x037F) << 32; // Default MXCSR and x87 control word
+    frame[1] = 0;                                             // r15
+    frame[2] = 0;                                             // r14
+    frame[3] = reinterpret_cast<uint64_t>(entry);             // r13
+    frame[4] = reinterpret_cast<uint64_t>(argument);          // r12
+    frame[5] = 0;                                             // rbx
+    frame[6] = 0;                                             // rbp
+    frame[7] = reinterpret_cast<uint64_t>(&datEngineFiberStart);
+    frame[8] = 0;
+    frame[9] = 0;
+    stackPointer = frame;
+#elif defined(DAT_ENGINE_FIBER_UCONTEXT)
+    this->entry = entry;
+    this->argument = argument;
+
+    getcontext(&context);
+    context.uc_stack.ss_sp = stack;
+    context.uc_stack.ss_size = this->stackSize;
+    context.uc_link = nullptr;
+
+    const auto pointer = reinterpret_cast<uintptr_t>(this);
+    makecontext(
+            &context,
+            reinterpret_cast<void (*)()>(&Fiber::start),
+            2,
+            static_cast<unsigned int>(pointer >> 32),
+            static_cast<unsigned int>(pointer)
+    );
+#else
+    (void) entry;
+    (void) argument;
+    (void) stackSize;
+    assert(false && "Fibers aren't supported on this platform");
+#endif
+}
+
+Fiber::~Fiber() {
+#if defined(DAT_ENGINE_FIBER_ASM) || defined(DAT_ENGINE_FIBER_UCONTEXT)
+    if (stack) munmap(stack, stackSize);
+#endif
+}
+
+void Fiber::switchTo(Fiber& target) {
+#if defined(DAT_ENGINE_FIBER_ASM)
+    datEngineSwitchFiber(&stackPointer, target.stackPointer);
+#elif defined(DAT_ENGINE_FIBER_UCONTEXT)
+    swapcontext(&context, &target.context);
+#else
+    (void) target;
+    assert(false && "Fibers aren't supported on this platform");
+#endif
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstddef>
+
+#if defined(__x86_64__) && defined(__linux__)
+    /** Fibers switch with a hand written context switch for the x86-64 System V ABI */
+    #define DAT_ENGINE_FIBER_ASM
+#elif defined(__unix__) || defined(__APPLE__)
+    /** Fibers switch with ucontext, which is slower as swapcontext also saves the signal mask */
+    #define DAT_ENGINE_FIBER_UCONTEXT
+    #include <ucontext.h>
+#endif
+
+namespace DatEngine::Threading {
+    /**
+     * A user space thread with its own stack, which is switched to and from explicitly
+     * <br>
+     * A fiber can be resumed on a different thread than the one it was suspended on, but any thread_local addresses
+     * the compiler cached across the switch will then be stale, so ThreadManager keeps fibers on one worker.
+     */
+    class Fiber {
+    public:
+        using Entry = void (*)(void* argument);
+
+    private:
+        /** The fiber's stack, including the guard page at the bottom, nullptr for a fiber wrapping a thread */
+        std::byte* stack = nullptr;
+        size_t stackSize = 0;
+
+#if defined(DAT_ENGINE_FIBER_ASM)
+        /** The stack pointer of the fiber while it's suspended, the registers are saved on the stack */
+        void* stackPointer = nullptr;
+#elif defined(DAT_ENGINE_FIBER_UCONTEXT)
+        ucontext_t context{};
+        Entry entry = nullptr;
+        void* argument = nullptr;
+
+        static void start(unsigned int high, unsigned int low);
+#endif
+
+    public:
+        /** The default size of a fiber stack, including its guard page */
+        static constexpr size_t defaultStackSize = 256 * 1024;
+
+        /**
+         * Create a fiber representing the calling thread, so the thread can switch to other fibers and be switched
+         * back to
+         */
+        Fiber() = default;
+
+        /**
+         * Create a fiber that will call a function when it's first switched to
+         *
+         * @param entry The function to run on the fiber, must never return, switch to another fiber instead
+         * @param argument The argument to pass to the function
+         * @param stackSize The size of the fiber's stack, rounded up to a whole number of pages
+         */
+        Fiber(Entry entry, void* argument, size_t stackSize = defaultStackSize);
+        ~Fiber();
+
+        Fiber(const Fiber&) = delete;
+        Fiber& operator=(const Fiber&) = delete;
+
+        /**
+         * Suspend this fiber and resume another, returns once something switches back to this fiber
+         *
+         * @param target The fiber to resume
+         * @note This fiber must be the one running on the calling thread
+         */
+        void switchTo(Fiber& target);
+
+        /**
+         * Check if fibers are supported on this platform
+         *
+         * @return true if fibers can be created
+         */
+        static constexpr bool isSupported() {
+#if defined(DAT_ENGINE_FIBER_ASM) || defined(DAT_ENGINE_FIBER_UCONTEXT)
+            return true;
+#else
+            return false;
+#endif
+        }
+    };
+} // namespace DatEngine::Threading
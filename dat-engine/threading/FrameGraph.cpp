@@ -0,0 +1,101 @@
+#include "FrameGraph.h"
+
+#include <algorithm>
+#include <cassert>
+
+using namespace DatEngine::Threading;
+
+FrameGraph::FrameGraph(ThreadManager& threads, const uint32_t maxFramesInFlight) :
+    threads(threads), slots(std::max(maxFramesInFlight, 1u)) {}
+
+FrameGraph::~FrameGraph() { waitForAll(); }
+
+FrameGraph::TaskId FrameGraph::addTask(
+        std::string name,
+        TaskFunction function,
+        std::vector<TaskId> dependencies,
+        std::vector<TaskId> previousFrameDependencies
+) {
+    // Running jobs hold references to the tasks, so the list can't grow once frames have started
+    assert(frameNumber == 0 && "Tasks must be added before the first frame begins");
+
+    const auto id = static_cast<TaskId>(tasks.size());
+    assert(std::ranges::all_of(dependencies, [id](const TaskId dependency) { return dependency < id; }) &&
+           "Dependencies must be added before the tasks that depend on them");
+    assert(std::ranges::all_of(previousFrameDependencies, [id](const TaskId dependency) { return dependency < id; }) &&
+           "Dependencies must be added before the tasks that depend on them");
+
+    tasks.push_back(
+            {std::move(name), std::move(function), std::move(dependencies), std::move(previousFrameDependencies)}
+    );
+    return id;
+}
+
+void FrameGraph::beginFrame(const float delta) {
+    const uint64_t frame = frameNumber++;
+    FrameSlot& slot = slots[frame % slots.size()];
+
+    // The slot was last used by the frame maxFramesInFlight ago, which has to finish before the slot can be reused
+    if (slot.inFlight) waitForSlot(slot);
+    if (!slot.taskCounters) {
+        slot.taskCounters = std::make_unique<JobCounter[]>(tasks.size());
+        slot.gates = std::make_unique<JobCounter[]>(tasks.size());
+    }
+
+    slot.context = {frame, delta};
+    slot.inFlight = true;
+
+    // With a single slot the previous frame has already finished, and its counters are the ones being reused
+    const FrameSlot* previous = frame > 0 && slots.size() > 1 ? &slots[(frame - 1) % slots.size()] : nullptr;
+
+    // Tasks are stored in dependency order, so every dependency has been submitted by the time its dependents are
+    for (TaskId id = 0; id < tasks.size(); ++id) {
+        submitTask(id, slot, previous);
+    }
+}
+
+void FrameGraph::waitForAll() {
+    const uint64_t first = frameNumber > slots.size() ? frameNumber - slots.size() : 0;
+    for (uint64_t frame = first; frame < frameNumber; ++frame) {
+        if (FrameSlot& slot = slots[frame % slots.size()]; slot.inFlight) waitForSlot(slot);
+    }
+}
+
+void FrameGraph::submitTask(const TaskId id, FrameSlot& slot, const FrameSlot* previous) {
+    const Task& task = tasks[id];
+
+    std::vector<JobCounter*> dependencies;
+    dependencies.reserve(task.dependencies.size() + task.previousFrameDependencies.size() + 1);
+    for (const TaskId dependency : task.dependencies) dependencies.push_back(&slot.taskCounters[dependency]);
+    if (previous) {
+        // A task never overlaps itself, so tasks don't need to be reentrant
+        dependencies.push_back(&previous->taskCounters[id]);
+        for (const TaskId dependency : task.previousFrameDependencies) {
+            dependencies.push_back(&previous->taskCounters[dependency]);
+        }
+    }
+
+    // Only captures two references, so it fits in std::function's local storage
+    auto job = [&task, &context = slot.context] { task.function(context); };
+    JobCounter* counter = &slot.taskCounters[id];
+
+    if (dependencies.empty()) {
+        threads.submit(std::move(job), counter);
+    } else if (dependencies.size() == 1) {
+        threads.submitAfter(*dependencies.front(), std::move(job), counter);
+    } else {
+        // Join the dependencies through the gate, which is only done once an empty job has run after each of them
+        JobCounter& gate = slot.gates[id];
+        for (JobCounter* dependency : dependencies) threads.submitAfter(*dependency, [] {}, &gate);
+        threads.submitAfter(gate, std::move(job), counter);
+    }
+}
+
+void FrameGraph::waitForSlot(FrameSlot& slot) {
+    for (size_t id = 0; id < tasks.size(); ++id) {
+        threads.wait(slot.taskCounters[id]);
+        threads.wait(slot.gates[id]);
+    }
+
+    slot.inFlight = false;
+}
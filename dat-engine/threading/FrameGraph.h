@@ -0,0 +1,127 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Job.h"
+#include "ThreadManager.h"
+
+namespace DatEngine::Threading {
+    /**
+     * Information about the frame a FrameGraph task is running for
+     */
+    struct FrameContext {
+        /** The number of the frame, counting up from 0 */
+        uint64_t frame = 0;
+        /** The time since the previous frame began, in seconds */
+        float delta = 0;
+    };
+
+    /**
+     * A graph of tasks that make up a frame, run on a ThreadManager
+     * <br>
+     * Each task runs once per frame after the tasks it depends on, and after its own run for the previous frame. A
+     * task that doesn't depend on a task from the previous frame can start the next frame while that task is still
+     * running, so simulating frame N+1 overlaps rendering frame N. The number of frames in flight is capped, beginning
+     * a frame past the cap waits for the oldest one to finish.
+     * <br>
+     * Tasks that share data across frames must say so with a previous frame dependency, for example a task that
+     * writes state read by rendering should depend on the previous frame's render task.
+     */
+    class FrameGraph {
+    public:
+        using TaskId = uint32_t;
+        using TaskFunction = std::function<void(const FrameContext&)>;
+
+    private:
+        struct Task {
+            std::string name;
+            TaskFunction function;
+            std::vector<TaskId> dependencies;
+            std::vector<TaskId> previousFrameDependencies;
+        };
+
+        /**
+         * The state of a frame in flight, reused once the frame has finished
+         */
+        struct FrameSlot {
+            FrameContext context;
+            /** One counter per task, done once the task has run for this frame */
+            std::unique_ptr<JobCounter[]> taskCounters;
+            /** One counter per task, used to join tasks with several dependencies */
+            std::unique_ptr<JobCounter[]> gates;
+            bool inFlight = false;
+        };
+
+        ThreadManager& threads;
+        std::vector<Task> tasks;
+        std::vector<FrameSlot> slots;
+        uint64_t frameNumber = 0;
+
+        void submitTask(TaskId id, FrameSlot& slot, const FrameSlot* previous);
+        void waitForSlot(FrameSlot& slot);
+
+    public:
+        /**
+         * @param threads The thread manager to run tasks on, must be initialised before the first frame begins
+         * @param maxFramesInFlight The most frames that can be running at once, at least 1
+         */
+        FrameGraph(ThreadManager& threads, uint32_t maxFramesInFlight);
+        ~FrameGraph();
+
+        FrameGraph(const FrameGraph&) = delete;
+        FrameGraph& operator=(const FrameGraph&) = delete;
+
+        /**
+         * Add a task to the graph, every task must be added before the first frame begins
+         *
+         * @param name The name of the task, for debugging
+         * @param function The work to do each frame, must not throw
+         * @param dependencies Tasks from the same frame that must finish first, must already be in the graph
+         * @param previousFrameDependencies Tasks from the previous frame that must finish first, must already be in
+         *                                  the graph
+         * @return The ID of the task, for use as a dependency
+         */
+        TaskId addTask(
+                std::string name,
+                TaskFunction function,
+                std::vector<TaskId> dependencies = {},
+                std::vector<TaskId> previousFrameDependencies = {}
+        );
+
+        /**
+         * Submit every task for the next frame, first waiting for the oldest frame if too many are in flight
+         * <br>
+         * Must be called from the thread that initialised the ThreadManager, which helps run tasks while it waits.
+         *
+         * @param delta The time since the previous frame began, in seconds
+         */
+        void beginFrame(float delta);
+
+        /**
+         * Wait for every frame in flight to finish
+         */
+        void waitForAll();
+
+        /**
+         * Get the name of a task
+         *
+         * @param id The ID of the task
+         * @return The name given to the task
+         */
+        [[nodiscard]] const std::string& getTaskName(const TaskId id) const { return tasks[id].name; }
+
+        /**
+         * Get the number of frames that have begun
+         */
+        [[nodiscard]] uint64_t getFrameCount() const { return frameNumber; }
+
+        /**
+         * Get the most frames that can be running at once
+         */
+        [[nodiscard]] uint32_t getMaxFramesInFlight() const { return static_cast<uint32_t>(slots.size()); }
+    };
+} // namespace DatEngine::Threading
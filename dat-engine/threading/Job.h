@@ -0,0 +1,64 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace DatEngine::Threading {
+    class ThreadManager;
+    class JobCounter;
+    class Fiber;
+
+    /**
+     * A unit of work for the ThreadManager
+     */
+    struct Job {
+        /** The work to do, must not throw */
+        std::function<void()> function;
+        /** The counter to decrement once the job has finished, may be nullptr */
+        JobCounter* counter = nullptr;
+    };
+
+    /**
+     * Tracks the number of unfinished jobs submitted against it, so a thread can wait for them or queue jobs that
+     * depend on them
+     * <br>
+     * A counter must outlive every job submitted against it, and must not be moved while it has unfinished jobs.
+     */
+    class JobCounter {
+        friend class ThreadManager;
+
+        std::atomic<uint32_t> pending = 0;
+
+        /**
+         * Guards continuations and waitingFibers, so nothing can be queued on the counter while it's releasing them
+         */
+        std::mutex continuationMutex;
+        /** Jobs that are submitted once the counter reaches 0 */
+        std::vector<Job*> continuations;
+        /** Fibers suspended until the counter reaches 0, with the index of the worker each one resumes on */
+        std::vector<std::pair<Fiber*, uint32_t>> waitingFibers;
+
+    public:
+        JobCounter() = default;
+        JobCounter(const JobCounter&) = delete;
+        JobCounter& operator=(const JobCounter&) = delete;
+
+        /**
+         * Check if every job submitted against the counter has finished
+         *
+         * @return true if the counter is 0
+         */
+        [[nodiscard]] bool isDone() const { return pending.load(std::memory_order_acquire) == 0; }
+
+        /**
+         * Get the number of unfinished jobs, this is only a snapshot while jobs are running
+         *
+         * @return The number of unfinished jobs
+         */
+        [[nodiscard]] uint32_t getPending() const { return pending.load(std::memory_order_relaxed); }
+    };
+} // namespace DatEngine::Threading
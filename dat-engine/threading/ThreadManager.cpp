@@ -1 +1,380 @@
 #include "ThreadManager.h"
+
+#include <cassert>
+#include <new>
+#include <utility>
+
+#include <util/CVar.h>
+
+using namespace DatEngine;
+using namespace DatEngine::Threading;
+
+CVarInt workerThreadsCVar(
+        "IWorkerThreads",
+        "The number of job system workers including the main thread, 0 for one per hardware thread",
+        CVarCategory::General,
+        0,
+        CVarFlags::Persistent | CVarFlags::RequiresRestart
+);
+CVarBool jobFibersCVar(
+        "BEnableJobFibers",
+        "Run jobs on fibers, so jobs waiting on other jobs are suspended instead of holding up their worker",
+        CVarCategory::General,
+        true,
+        CVarFlags::Persistent | CVarFlags::RequiresRestart
+);
+
+namespace {
+    /**
+     * The worker the current thread belongs to, if any
+     */
+    struct CurrentWorker {
+        const ThreadManager* manager = nullptr;
+        uint32_t index = ThreadManager::nullWorker;
+    };
+
+    thread_local CurrentWorker currentWorkerInfo;
+
+    /**
+     * A cheap per thread xorshift generator, used to pick which worker to steal from first
+     */
+    uint32_t nextRandom() {
+        thread_local uint32_t state =
+                static_cast<uint32_t>(std::hash<std::thread::id>{}(std::this_thread::get_id())) | 1;
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+} // namespace
+
+ThreadManager::ThreadManager(const uint32_t workerCount) : requestedWorkers(workerCount) {}
+
+ThreadManager::ThreadManager(const uint32_t workerCount, const bool fibers) :
+    requestedWorkers(workerCount), requestedFibers(fibers) {}
+
+ThreadManager::~ThreadManager() { unload(); }
+
+/* -------------------------------------------- */
+/*  Lifecycle                                   */
+/* -------------------------------------------- */
+
+void ThreadManager::init() {
+    assert(!running.load(std::memory_order_relaxed) && "ThreadManager is already running");
+
+    uint32_t workerCount = requestedWorkers;
+    if (workerCount == 0) workerCount = static_cast<uint32_t>(std::max(workerThreadsCVar.get(), 0));
+    if (workerCount == 0) workerCount = std::max(std::thread::hardware_concurrency(), 1u);
+    useFibers = Fiber::isSupported() && requestedFibers.value_or(jobFibersCVar.get());
+
+    workers.reserve(workerCount);
+    for (uint32_t i = 0; i < workerCount; ++i) {
+        workers.push_back(std::make_unique<Worker>());
+    }
+
+    currentWorkerInfo = {this, 0};
+    running.store(true, std::memory_order_release);
+
+    // Workers are only started once every deque exists, as they steal from each other straight away
+    for (uint32_t i = 1; i < workerCount; ++i) {
+        workers[i]->thread = std::thread(&ThreadManager::workerLoop, this, i);
+    }
+}
+
+void ThreadManager::unload() {
+    if (!running.exchange(false, std::memory_order_acq_rel)) return;
+
+    jobSignal.fetch_add(1, std::memory_order_seq_cst);
+    jobSignal.notify_all();
+
+    for (const auto& worker : workers) {
+        if (worker->thread.joinable()) worker->thread.join();
+    }
+
+    // Nothing else can touch the deques now, so worker 0's view of them is safe to drain
+    for (const auto& worker : workers) {
+        while (const std::optional<Job*> job = worker->deque.steal()) delete *job;
+    }
+    for (const Job* job : sharedJobs) delete job;
+
+    sharedJobs.clear();
+    sharedJobCount.store(0, std::memory_order_relaxed);
+    workers.clear();
+
+    if (currentWorkerInfo.manager == this) currentWorkerInfo = {};
+}
+
+/* -------------------------------------------- */
+/*  Jobs                                        */
+/* -------------------------------------------- */
+
+uint32_t ThreadManager::currentWorker() const {
+    return currentWorkerInfo.manager == this ? currentWorkerInfo.index : nullWorker;
+}
+
+void ThreadManager::submit(std::function<void()> function, JobCounter* counter) {
+    if (counter) counter->pending.fetch_add(1, std::memory_order_relaxed);
+    pushJob(new Job{std::move(function), counter});
+}
+
+void ThreadManager::submitAfter(JobCounter& dependency, std::function<void()> function, JobCounter* counter) {
+    if (counter) counter->pending.fetch_add(1, std::memory_order_relaxed);
+    Job* job = new Job{std::move(function), counter};
+
+    {
+        std::scoped_lock lock(dependency.continuationMutex);
+        if (!dependency.isDone()) {
+            dependency.continuations.push_back(job);
+            return;
+        }
+    }
+
+    pushJob(job);
+}
+
+void ThreadManager::wait(JobCounter& counter) {
+    const uint32_t index = currentWorker();
+    Worker* worker = useFibers && index != nullWorker ? workers[index].get() : nullptr;
+
+    while (!counter.isDone()) {
+        if (worker && worker->currentFiber) {
+            // Suspend this fiber until the counter is done, the worker resumes another job or starts a fresh fiber
+            Fiber* next = popReadyFiber(*worker);
+            if (!next) next = acquireFiber(*worker);
+            if (next) {
+                switchFiber(*worker, next, &counter);
+                continue;
+            }
+        }
+
+        if (Job* job = findJob()) {
+            execute(job);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    // The thread that finished the last job may still be releasing the counter's continuations
+    std::scoped_lock lock(counter.continuationMutex);
+}
+
+void ThreadManager::pushJob(Job* job) {
+    assert(running.load(std::memory_order_relaxed) && "ThreadManager must be initialised before submitting jobs");
+
+    if (const uint32_t index = currentWorker(); index != nullWorker) {
+        workers[index]->deque.push(job);
+    } else {
+        std::scoped_lock lock(sharedJobsMutex);
+        sharedJobs.push_back(job);
+        sharedJobCount.fetch_add(1, std::memory_order_release);
+    }
+
+    // Only wake a worker if one might be asleep, see schedulerLoop for the other half of this handshake
+    jobSignal.fetch_add(1, std::memory_order_seq_cst);
+    if (sleepingWorkers.load(std::memory_order_seq_cst) > 0) jobSignal.notify_one();
+}
+
+Job* ThreadManager::findJob() {
+    const uint32_t self = currentWorker();
+    if (self != nullWorker) {
+        if (const std::optional<Job*> job = workers[self]->deque.pop()) return *job;
+    }
+
+    if (sharedJobCount.load(std::memory_order_acquire) > 0) {
+        std::scoped_lock lock(sharedJobsMutex);
+        if (!sharedJobs.empty()) {
+            Job* job = sharedJobs.front();
+            sharedJobs.pop_front();
+            sharedJobCount.fetch_sub(1, std::memory_order_relaxed);
+            return job;
+        }
+    }
+
+    // Start at a random victim so thieves don't all pile onto the same worker
+    const auto workerCount = static_cast<uint32_t>(workers.size());
+    if (workerCount == 0) return nullptr;
+
+    const uint32_t start = nextRandom() % workerCount;
+    for (uint32_t i = 0; i < workerCount; ++i) {
+        const uint32_t victim = (start + i) % workerCount;
+        if (victim == self) continue;
+
+        if (const std::optional<Job*> job = workers[victim]->deque.steal()) return *job;
+    }
+
+    return nullptr;
+}
+
+void ThreadManager::execute(Job* job) {
+    job->function();
+
+    JobCounter* counter = job->counter;
+    delete job;
+
+    if (counter) finishJob(*counter);
+}
+
+void ThreadManager::finishJob(JobCounter& counter) {
+    // Jobs that can't be the last one don't need the lock
+    uint32_t pending = counter.pending.load(std::memory_order_relaxed);
+    while (pending > 1) {
+        if (counter.pending.compare_exchange_weak(
+                    pending, pending - 1, std::memory_order_acq_rel, std::memory_order_relaxed
+            )) {
+            return;
+        }
+    }
+
+    // Hold the lock while reaching 0, so nothing can be queued on the counter that would never be released
+    std::vector<Job*> released;
+    std::vector<std::pair<Fiber*, uint32_t>> resumed;
+    {
+        std::scoped_lock lock(counter.continuationMutex);
+        if (counter.pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            released.swap(counter.continuations);
+            resumed.swap(counter.waitingFibers);
+        }
+    }
+
+    for (Job* job : released) pushJob(job);
+    for (const auto& [fiber, index] : resumed) resumeFiber(fiber, index);
+}
+
+void ThreadManager::workerLoop(const uint32_t index) {
+    currentWorkerInfo = {this, index};
+
+    // Schedule from a fiber, so jobs that wait can be suspended, this returns once the worker stops. Without one the
+    // worker schedules from its own thread, and waits run jobs inline.
+    Worker& worker = *workers[index];
+    if (Fiber* fiber = useFibers ? acquireFiber(worker) : nullptr) {
+        switchFiber(worker, fiber, nullptr);
+    } else {
+        schedulerLoop(index);
+    }
+
+    currentWorkerInfo = {};
+}
+
+void ThreadManager::schedulerLoop(const uint32_t index) {
+    Worker& worker = *workers[index];
+
+    while (running.load(std::memory_order_acquire)) {
+        // Resuming suspended jobs first keeps waits short, this fiber goes back to the pool until it's needed again
+        if (Fiber* fiber = popReadyFiber(worker)) {
+            switchFiber(worker, fiber, nullptr);
+            continue;
+        }
+
+        if (Job* job = findJob()) {
+            execute(job);
+            continue;
+        }
+
+        // Read the signal before checking again, so work submitted after the check changes it and wakes us
+        const uint32_t signal = jobSignal.load(std::memory_order_seq_cst);
+        if (worker.readyFiberCount.load(std::memory_order_acquire) > 0) continue;
+        if (Job* job = findJob()) {
+            execute(job);
+            continue;
+        }
+
+        sleepingWorkers.fetch_add(1, std::memory_order_seq_cst);
+        if (running.load(std::memory_order_acquire)) jobSignal.wait(signal, std::memory_order_seq_cst);
+        sleepingWorkers.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+/* -------------------------------------------- */
+/*  Fibers                                      */
+/* -------------------------------------------- */
+
+void ThreadManager::fiberEntry(void* manager) {
+    auto* self = static_cast<ThreadManager*>(manager);
+    const uint32_t index = self->currentWorker();
+    Worker& worker = *self->workers[index];
+
+    self->completeSwitch(worker);
+    self->schedulerLoop(index);
+
+    // The worker is stopping, hand back to its thread, which never switches back to this fiber
+    self->switchFiber(worker, &worker.threadFiber, nullptr);
+}
+
+Fiber* ThreadManager::acquireFiber(Worker& worker) {
+    if (!worker.freeFibers.empty()) {
+        Fiber* fiber = worker.freeFibers.back();
+        worker.freeFibers.pop_back();
+        return fiber;
+    }
+
+    if (worker.fibers.size() >= maxFibersPerWorker) return nullptr;
+
+    // Failing to allocate a stack isn't fatal, waits run jobs inline instead of suspending
+    try {
+        return worker.fibers.emplace_back(std::make_unique<Fiber>(&ThreadManager::fiberEntry, this)).get();
+    } catch (const std::bad_alloc&) {
+        return nullptr;
+    }
+}
+
+Fiber* ThreadManager::popReadyFiber(Worker& worker) {
+    if (worker.readyFiberCount.load(std::memory_order_acquire) == 0) return nullptr;
+
+    std::scoped_lock lock(worker.readyFibersMutex);
+    if (worker.readyFibers.empty()) return nullptr;
+
+    Fiber* fiber = worker.readyFibers.back();
+    worker.readyFibers.pop_back();
+    worker.readyFiberCount.fetch_sub(1, std::memory_order_relaxed);
+    return fiber;
+}
+
+void ThreadManager::resumeFiber(Fiber* fiber, const uint32_t index) {
+    Worker& worker = *workers[index];
+    {
+        std::scoped_lock lock(worker.readyFibersMutex);
+        worker.readyFibers.push_back(fiber);
+        worker.readyFiberCount.fetch_add(1, std::memory_order_release);
+    }
+
+    // The fiber can only resume on its own worker, so wake every sleeper to make sure that one wakes
+    jobSignal.fetch_add(1, std::memory_order_seq_cst);
+    if (sleepingWorkers.load(std::memory_order_seq_cst) > 0) jobSignal.notify_all();
+}
+
+void ThreadManager::switchFiber(Worker& worker, Fiber* target, JobCounter* parkOn) {
+    Fiber* current = worker.currentFiber;
+    worker.previousFiber = current;
+    worker.parkOn = parkOn;
+    worker.currentFiber = target == &worker.threadFiber ? nullptr : target;
+
+    (current ? *current : worker.threadFiber).switchTo(*target);
+
+    // Resumed, fibers never change worker so this is still the same worker
+    completeSwitch(worker);
+}
+
+void ThreadManager::completeSwitch(Worker& worker) {
+    // The previous fiber can only be parked or freed once it's been switched away from, or another thread could
+    // resume it while it's still running
+    Fiber* previous = std::exchange(worker.previousFiber, nullptr);
+    JobCounter* counter = std::exchange(worker.parkOn, nullptr);
+    if (previous == nullptr) return;
+
+    if (counter == nullptr) {
+        worker.freeFibers.push_back(previous);
+        return;
+    }
+
+    const uint32_t index = currentWorker();
+    {
+        std::scoped_lock lock(counter->continuationMutex);
+        if (!counter->isDone()) {
+            counter->waitingFibers.emplace_back(previous, index);
+            return;
+        }
+    }
+
+    // The counter finished during the switch
+    resumeFiber(previous, index);
+}
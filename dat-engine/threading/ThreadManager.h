@@ -1,10 +1,218 @@
 #pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
 #include "service/EngineService.h"
 
+#include "CacheLine.h"
+#include "Fiber.h"
+#include "Job.h"
+#include "WorkStealingDeque.h"
+
 namespace DatEngine::Threading {
+    /**
+     * A work stealing job system
+     * <br>
+     * Each worker owns a Chase-Lev deque, jobs submitted by a worker are pushed onto its own deque and idle workers
+     * steal from the others. The thread that calls init() becomes worker 0 and only runs jobs while it waits on a
+     * counter, jobs submitted from threads that aren't workers go through a shared queue.
+     * <br>
+     * Waiting on a counter never blocks the worker. With fibers enabled, workers run jobs on fibers and a job that
+     * waits suspends its fiber until the counter reaches 0, while the worker carries on with other jobs on a fiber from
+     * its pool. Without fibers, or on threads that aren't running on a fiber, waiting runs other jobs on top of the
+     * waiting job's stack until the counter reaches 0.
+     */
     class ThreadManager final : public Service::EngineService {
+        struct Worker {
+            WorkStealingDeque<Job*> deque;
+            /** The thread running the worker, empty for worker 0 */
+            std::thread thread;
+
+            /*
+             * Fibers, only used by workers with their own thread when fibers are enabled. Fibers always resume on the
+             * worker that suspended them, so these are only touched by the worker's thread unless noted.
+             */
+
+            /** The worker thread's own context, switched back to when the worker stops */
+            Fiber threadFiber;
+            /** Every fiber the worker has created */
+            std::vector<std::unique_ptr<Fiber>> fibers;
+            /** Fibers ready to run the scheduler loop */
+            std::vector<Fiber*> freeFibers;
+            /** The fiber the worker is running, nullptr when not running on a fiber */
+            Fiber* currentFiber = nullptr;
+            /** The fiber that was switched away from, dealt with by the fiber that was switched to */
+            Fiber* previousFiber = nullptr;
+            /** The counter previousFiber is waiting on, or nullptr if previousFiber is free */
+            JobCounter* parkOn = nullptr;
+
+            /** Suspended fibers whose counters have reached 0, pushed to by any thread */
+            std::vector<Fiber*> readyFibers;
+            std::mutex readyFibersMutex;
+            std::atomic<size_t> readyFiberCount = 0;
+        };
+
+        /** The number of chunks parallelFor aims to give each worker, so workers that finish early can steal more */
+        static constexpr size_t chunksPerWorker = 4;
+        /** The most fibers each worker creates, once they're all suspended waits fall back to running jobs inline */
+        static constexpr size_t maxFibersPerWorker = 64;
+
+        uint32_t requestedWorkers;
+        std::optional<bool> requestedFibers;
+        bool useFibers = false;
+        std::vector<std::unique_ptr<Worker>> workers;
+        std::atomic<bool> running = false;
+
+        /** Jobs submitted by threads that aren't workers */
+        std::deque<Job*> sharedJobs;
+        std::mutex sharedJobsMutex;
+        std::atomic<size_t> sharedJobCount = 0;
+
+        /** Incremented whenever a job is submitted, sleeping workers wait for it to change */
+        alignas(cacheLineSize) std::atomic<uint32_t> jobSignal = 0;
+        std::atomic<uint32_t> sleepingWorkers = 0;
+
+        /**
+         * Get the index of the calling thread's worker
+         *
+         * @return The worker index, or nullWorker if the calling thread isn't one of this manager's workers
+         */
+        [[nodiscard]] uint32_t currentWorker() const;
+
+        void pushJob(Job* job);
+        Job* findJob();
+        void execute(Job* job);
+        void finishJob(JobCounter& counter);
+        void workerLoop(uint32_t index);
+        void schedulerLoop(uint32_t index);
+
+        static void fiberEntry(void* manager);
+        Fiber* acquireFiber(Worker& worker);
+        Fiber* popReadyFiber(Worker& worker);
+        void resumeFiber(Fiber* fiber, uint32_t index);
+        void switchFiber(Worker& worker, Fiber* target, JobCounter* parkOn);
+        void completeSwitch(Worker& worker);
 
     public:
+        /** The worker index of threads that aren't workers */
+        static constexpr uint32_t nullWorker = std::numeric_limits<uint32_t>::max();
+
+        /**
+         * @param workerCount The number of workers including the thread that calls init(), 0 to use the IWorkerThreads
+         *                    CVar
+         */
+        explicit ThreadManager(uint32_t workerCount = 0);
+
+        /**
+         * @param workerCount The number of workers including the thread that calls init(), 0 to use the IWorkerThreads
+         *                    CVar
+         * @param fibers Whether workers run jobs on fibers, ignored if fibers aren't supported on this platform
+         */
+        ThreadManager(uint32_t workerCount, bool fibers);
+        ~ThreadManager() override;
+
+        ThreadManager(const ThreadManager&) = delete;
+        ThreadManager& operator=(const ThreadManager&) = delete;
+
+        /**
+         * Start the worker threads, the calling thread becomes worker 0
+         */
         void init() override;
+
+        /**
+         * Stop and join the worker threads, any jobs that haven't started are discarded
+         * <br>
+         * Must be called from the thread that called init()
+         */
+        void unload() override;
+
+        /**
+         * Get the number of workers, including the thread that called init()
+         */
+        [[nodiscard]] uint32_t getWorkerCount() const { return static_cast<uint32_t>(workers.size()); }
+
+        /**
+         * Check if the calling thread is one of this manager's workers
+         */
+        [[nodiscard]] bool isWorkerThread() const { return currentWorker() != nullWorker; }
+
+        /**
+         * Check if workers run jobs on fibers
+         */
+        [[nodiscard]] bool isUsingFibers() const { return useFibers; }
+
+        /**
+         * Submit a job to be run on any worker
+         *
+         * @param function The work to do, must not throw
+         * @param counter A counter to increment now and decrement once the job has finished, may be nullptr
+         */
+        void submit(std::function<void()> function, JobCounter* counter = nullptr);
+
+        /**
+         * Submit a job that will only be run once every job submitted against a dependency has finished
+         *
+         * @param dependency The counter to wait for
+         * @param function The work to do, must not throw
+         * @param counter A counter to increment now and decrement once the job has finished, may be nullptr
+         */
+        void submitAfter(JobCounter& dependency, std::function<void()> function, JobCounter* counter = nullptr);
+
+        /**
+         * Wait until every job submitted against a counter has finished, running other jobs in the meantime
+         * <br>
+         * On a fiber the waiting job is suspended while the worker runs other jobs, otherwise the other jobs are run on
+         * top of the waiting job. Once this returns, the counter can be reused or destroyed.
+         *
+         * @param counter The counter to wait for
+         */
+        void wait(JobCounter& counter);
+
+        /**
+         * Split a range of indices into chunks and process them in parallel, returning once every chunk is done
+         * <br>
+         * The range is split into a few chunks per worker, the calling thread processes the first chunk and then helps
+         * with the rest.
+         *
+         * @tparam TFunction The type of the function
+         * @param count The number of indices to process
+         * @param function A function taking the first index of a chunk and the index after its last, must not throw
+         * @param minChunkSize The smallest number of indices worth giving to a job
+         */
+        template<typename TFunction>
+        void parallelFor(const size_t count, TFunction&& function, const size_t minChunkSize = 1) {
+            if (count == 0) return;
+
+            const size_t targetChunks = std::max<size_t>(getWorkerCount(), 1) * chunksPerWorker;
+            const size_t chunkSize = std::max({minChunkSize, (count + targetChunks - 1) / targetChunks, size_t{1}});
+            if (chunkSize >= count || !running.load(std::memory_order_relaxed)) {
+                function(size_t{0}, count);
+                return;
+            }
+
+            // Jobs only capture a reference and an index, so they fit in std::function's local storage
+            const auto runChunk = [&function, chunkSize, count](const size_t begin) {
+                function(begin, std::min(begin + chunkSize, count));
+            };
+
+            JobCounter counter;
+            for (size_t begin = chunkSize; begin < count; begin += chunkSize) {
+                submit([&runChunk, begin] { runChunk(begin); }, &counter);
+            }
+
+            runChunk(0);
+            wait(counter);
+        }
     };
-}
+} // namespace DatEngine::Threading
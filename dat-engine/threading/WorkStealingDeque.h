@@ -0,0 +1,160 @@
+/*
+ * Based on "Correct and Efficient Work-Stealing for Weak Memory Models" by Lê, Pop, Cohen and Zappa Nardelli:
+ * https://fzn.fr/readings/ppopp13.pdf
+ */
+
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+#include "CacheLine.h"
+
+namespace DatEngine::Threading {
+    /**
+     * A Chase-Lev work stealing deque
+     * <br>
+     * The owning thread pushes and pops items at the bottom like a stack, while any other thread can steal items from
+     * the top. The owner only synchronises with thieves when they race for the last item.
+     * <br>
+     * When the deque fills up, its items are copied into a buffer twice the size. Old buffers are kept until the deque
+     * is destroyed, as a thief may still be reading from one.
+     *
+     * @tparam T The type of the items, must be trivially copyable as thieves may read an item while it's overwritten
+     */
+    template<typename T>
+        requires(std::is_trivially_copyable_v<T>)
+    class WorkStealingDeque {
+        struct Buffer {
+            int64_t capacity;
+            std::unique_ptr<std::atomic<T>[]> items;
+
+            explicit Buffer(const int64_t capacity) : capacity(capacity), items(new std::atomic<T>[capacity]) {}
+
+            T get(const int64_t index) const { return items[index & (capacity - 1)].load(std::memory_order_relaxed); }
+            void put(const int64_t index, T item) { items[index & (capacity - 1)].store(item, std::memory_order_relaxed); }
+        };
+
+        /** The index of the next item to steal, only ever increases */
+        alignas(cacheLineSize) std::atomic<int64_t> top = 0;
+        /** The index after the last item, only written by the owner */
+        alignas(cacheLineSize) std::atomic<int64_t> bottom = 0;
+        std::atomic<Buffer*> buffer;
+
+        /** Every buffer the deque has used, only touched by the owner */
+        std::vector<std::unique_ptr<Buffer>> buffers;
+
+        Buffer* grow(const Buffer* old, const int64_t bottomIndex, const int64_t topIndex) {
+            Buffer* grown = buffers.emplace_back(std::make_unique<Buffer>(old->capacity * 2)).get();
+            for (int64_t i = topIndex; i < bottomIndex; ++i) grown->put(i, old->get(i));
+
+            buffer.store(grown, std::memory_order_release);
+            return grown;
+        }
+
+    public:
+        /**
+         * @param capacity The initial number of items the deque can hold before growing, must be a power of 2
+         */
+        explicit WorkStealingDeque(const int64_t capacity = 1024) {
+            assert(std::has_single_bit(static_cast<uint64_t>(capacity)) && "Capacity must be a power of 2");
+            buffer.store(buffers.emplace_back(std::make_unique<Buffer>(capacity)).get(), std::memory_order_relaxed);
+        }
+
+        WorkStealingDeque(const WorkStealingDeque&) = delete;
+        WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+        /**
+         * Push an item onto the bottom of the deque, may only be called by the owning thread
+         *
+         * @param item The item to push
+         */
+        void push(T item) {
+            const int64_t bottomIndex = bottom.load(std::memory_order_relaxed);
+            const int64_t topIndex = top.load(std::memory_order_acquire);
+            Buffer* current = buffer.load(std::memory_order_relaxed);
+
+            if (bottomIndex - topIndex > current->capacity - 1) current = grow(current, bottomIndex, topIndex);
+
+            current->put(bottomIndex, item);
+            std::atomic_thread_fence(std::memory_order_release);
+            bottom.store(bottomIndex + 1, std::memory_order_relaxed);
+        }
+
+        /**
+         * Pop the most recently pushed item off the bottom of the deque, may only be called by the owning thread
+         *
+         * @return The item, or nullopt if the deque was empty or a thief took the last item
+         */
+        std::optional<T> pop() {
+            const int64_t bottomIndex = bottom.load(std::memory_order_relaxed) - 1;
+            const Buffer* current = buffer.load(std::memory_order_relaxed);
+            bottom.store(bottomIndex, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t topIndex = top.load(std::memory_order_relaxed);
+
+            if (topIndex > bottomIndex) {
+                bottom.store(bottomIndex + 1, std::memory_order_relaxed);
+                return std::nullopt;
+            }
+
+            T item = current->get(bottomIndex);
+            if (topIndex == bottomIndex) {
+                // Last item, race any thieves for it
+                const bool won = top.compare_exchange_strong(
+                        topIndex, topIndex + 1, std::memory_order_seq_cst, std::memory_order_relaxed
+                );
+                bottom.store(bottomIndex + 1, std::memory_order_relaxed);
+                if (!won) return std::nullopt;
+            }
+
+            return item;
+        }
+
+        /**
+         * Steal the oldest item from the top of the deque, may be called by any thread
+         *
+         * @return The item, or nullopt if the deque was empty or another thread took the item first
+         */
+        std::optional<T> steal() {
+            int64_t topIndex = top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const int64_t bottomIndex = bottom.load(std::memory_order_acquire);
+
+            if (topIndex >= bottomIndex) return std::nullopt;
+
+            T item = buffer.load(std::memory_order_acquire)->get(topIndex);
+            if (!top.compare_exchange_strong(
+                        topIndex, topIndex + 1, std::memory_order_seq_cst, std::memory_order_relaxed
+                )) {
+                return std::nullopt;
+            }
+
+            return item;
+        }
+
+        /**
+         * Get the number of items in the deque, this is only a snapshot while other threads are stealing
+         *
+         * @return The number of items
+         */
+        [[nodiscard]] size_t size() const {
+            const int64_t bottomIndex = bottom.load(std::memory_order_relaxed);
+            const int64_t topIndex = top.load(std::memory_order_relaxed);
+            return bottomIndex > topIndex ? static_cast<size_t>(bottomIndex - topIndex) : 0;
+        }
+
+        /**
+         * Check if the deque is empty, this is only a snapshot while other threads are stealing
+         *
+         * @return true if the deque has no items
+         */
+        [[nodiscard]] bool empty() const { return size() == 0; }
+    };
+} // namespace DatEngine::Threading
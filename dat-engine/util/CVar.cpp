@@ -1,10 +1,16 @@
 #include "CVar.h"
 
+#include <algorithm>
 #include <cassert>
 #include <format>
+#include <memory>
+#include <mutex>
+#include <new>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
+#include <threading/CacheLine.h>
 #include <util/EngineConstants.h>
 
 using namespace DatEngine;
@@ -51,15 +57,31 @@ struct DatEngine::CVarParameter {
 };
 
 /**
- * A structure containing the values of a CVar in storage
+ * How CVars of a type are stored, int, bool and float values are stored directly in an atomic, while strings are
+ * stored as a pointer to an immutable string that's swapped out when the CVar is set
+ * @tparam T The type of the CVar
+ */
+template<typename T>
+using CVarValue = std::conditional_t<std::is_same_v<T, std::string>, const std::string*, T>;
+
+/**
+ * The CVarType that stores values of a type
+ * @tparam T The type of the CVar
+ */
+template<typename T>
+constexpr CVarType cvarTypeOf = std::is_same_v<T, bool>     ? CVarType::BOOL
+                              : std::is_same_v<T, double>   ? CVarType::FLOAT
+                              : std::is_same_v<T, int32_t>  ? CVarType::INT
+                                                            : CVarType::STRING;
+
+/**
+ * The rarely accessed parts of a CVar in storage
  * @tparam T The type being stored
  */
 template<typename T>
 struct CVarStorage {
     /** The initial value of the CVar */
     T initial{};
-    /** The current value of the CVar */
-    T current{};
     /** The parameters of the CVar */
     CVarParameter* parameter{};
 
@@ -68,6 +90,10 @@ struct CVarStorage {
 
 /**
  * A container for storing CVars of a specific type
+ * <br>
+ * The current values are packed together in their own cache line aligned array, apart from the initial values and
+ * parameters, so the CVars read every frame share as few cache lines as possible. Values are never moved, so
+ * pointers to them can be held for the lifetime of the program.
  * @tparam T The type of the CVars stored by this array
  */
 template<typename T>
@@ -77,6 +103,11 @@ struct CVarArray {
      */
     CVarStorage<T>* const cvars;
 
+    /**
+     * The current value of each CVar, read without locking from any thread
+     */
+    std::atomic<CVarValue<T>>* const values;
+
     const size_t maxSize;
 
     /**
@@ -84,9 +115,43 @@ struct CVarArray {
      */
     uint32_t lastCvar{0};
 
-    CVarArray(const size_t size) : cvars(new CVarStorage<T>[size]), maxSize(size) {}
+    /**
+     * Serialises setting string CVars, readers never take it
+     */
+    std::mutex writeMutex;
+
+    /**
+     * A string that's been replaced, kept until no reader can still be using it
+     */
+    struct RetiredString {
+        std::unique_ptr<const std::string> value;
+        /** The reclaim epoch the string was replaced in */
+        uint64_t epoch;
+    };
+
+    /**
+     * Strings that have been replaced, in the order they were replaced
+     */
+    std::vector<RetiredString> retiredStrings;
 
-    ~CVarArray() { delete[] cvars; }
+    /**
+     * The number of times {@link reclaim} has been called, guarded by the write mutex
+     */
+    uint64_t reclaimEpoch = 0;
+
+    CVarArray(const size_t size) :
+        cvars(new CVarStorage<T>[size]),
+        values(new(std::align_val_t(Threading::cacheLineSize)) std::atomic<CVarValue<T>>[size]),
+        maxSize(size) {}
+
+    ~CVarArray() {
+        if constexpr (std::is_same_v<T, std::string>) {
+            for (uint32_t i = 0; i < lastCvar; ++i) delete values[i].load(std::memory_order_relaxed);
+        }
+
+        delete[] cvars;
+        ::operator delete[](values, std::align_val_t(Threading::cacheLineSize));
+    }
 
     /**
      * Get a full {@link CVarStorage} from the container
@@ -107,21 +172,57 @@ struct CVarArray {
      * @param index The index of the CVar
      * @return The current value of the Cvar
      */
-    T getCurrent(const uint32_t index) { return getStorage(index).current; }
+    T getCurrent(const uint32_t index) {
+        if constexpr (std::is_same_v<T, std::string>) {
+            return *values[index].load(std::memory_order_acquire);
+        } else {
+            return values[index].load(std::memory_order_relaxed);
+        }
+    }
 
     /**
      * Get the current value of the CVar at the given index
      * @param index The index of the CVar
-     * @return The current value of the Cvar
+     * @return The atomic holding the current value of the Cvar
      */
-    T* getCurrentPtr(const uint32_t index) { return &(getStorage(index).current); }
+    std::atomic<CVarValue<T>>* getCurrentPtr(const uint32_t index) { return &values[index]; }
 
     /**
      * Set the current value of the CVar at the given index
      * @param index The index of the CVar
      * @param val The value to set the CVar to
      */
-    void setCurrent(const uint32_t index, const T& val) { getStorage(index).current = val; }
+    void setCurrent(const uint32_t index, const T& val) {
+        if constexpr (std::is_same_v<T, std::string>) {
+            // Publish a new string, the old one is kept until reclaim() knows readers are done with it
+            auto* newValue = new std::string(val);
+            std::lock_guard lock(writeMutex);
+            retiredStrings.push_back({
+                    std::unique_ptr<const std::string>(values[index].exchange(newValue, std::memory_order_acq_rel)),
+                    reclaimEpoch
+            });
+        } else {
+            values[index].store(val, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * Free the strings replaced more than \p delay calls ago
+     * @param delay The number of calls a replaced string must survive, so readers in that many frames can finish
+     * @return The number of strings freed
+     */
+    size_t reclaim(const uint32_t delay) {
+        std::lock_guard lock(writeMutex);
+        ++reclaimEpoch;
+
+        // Strings are retired in epoch order, so the ones old enough to free are all at the front
+        const auto firstKept = std::ranges::find_if(retiredStrings, [&](const RetiredString& retired) {
+            return retired.epoch + delay >= reclaimEpoch;
+        });
+        const auto freed = static_cast<size_t>(firstKept - retiredStrings.begin());
+        retiredStrings.erase(retiredStrings.begin(), firstKept);
+        return freed;
+    }
 
     /**
      * Reset the current value of the CVar to it's initial value
@@ -129,8 +230,9 @@ struct CVarArray {
      * @return The new value of the CVar
      */
     T reset(const uint32_t index) {
-        CVarStorage<T>& storage = getStorage(index);
-        return storage.current = storage.initial;
+        const T& initial = getStorage(index).initial;
+        setCurrent(index, initial);
+        return initial;
     }
 
     /**
@@ -144,8 +246,12 @@ struct CVarArray {
         assert(lastCvar < maxSize);
 
         cvars[lastCvar].initial = initial;
-        cvars[lastCvar].current = value;
         cvars[lastCvar].parameter = param;
+        if constexpr (std::is_same_v<T, std::string>) {
+            values[lastCvar].store(new std::string(value), std::memory_order_release);
+        } else {
+            values[lastCvar].store(value, std::memory_order_relaxed);
+        }
 
         param->arrayIndex = lastCvar;
 
@@ -200,12 +306,12 @@ public:
      * Get the value of the CVar
      * @tparam T The type of the CVar Array
      * @param nameHash The name of the CVar
-     * @return The current value of the CVar
+     * @return The current value of the CVar, or nullptr if there's no such CVar of type T
      */
     template<typename T>
-    T* getCVarCurrent(const StringUtils::StringHash nameHash) {
+    std::atomic<CVarValue<T>>* getCVarCurrent(const StringUtils::StringHash nameHash) {
         CVarParameter* parameter = getCVar(nameHash);
-        if (!parameter)
+        if (!parameter || parameter->type != cvarTypeOf<T>)
             return nullptr;
 
         return getCVarArray<T>()->getCurrentPtr(parameter->arrayIndex);
@@ -220,10 +326,10 @@ public:
     template<typename T>
     void setCVarCurrent(const StringUtils::StringHash nameHash, const T& value) {
         CVarParameter* parameter = getCVar(nameHash);
-        if (!parameter)
+        if (!parameter || parameter->type != cvarTypeOf<T>)
             return;
 
-        getCVarArray<T>()->setCurrent(nameHash, value);
+        getCVarArray<T>()->setCurrent(parameter->arrayIndex, value);
     }
 
     /**
@@ -231,7 +337,7 @@ public:
      * @param hash The name of the CVar
      * @return A pointer to the value of the CVar
      */
-    int32_t* getIntCVar(StringUtils::StringHash hash) override;
+    std::atomic<int32_t>* getIntCVar(StringUtils::StringHash hash) override;
     /**
      * Set the value of an integer CVar by its name
      * @param hash The name of the CVar
@@ -244,7 +350,7 @@ public:
      * @param hash The name of the CVar
      * @return A pointer to the value of the CVar
      */
-    bool* getBoolCVar(StringUtils::StringHash hash) override;
+    std::atomic<bool>* getBoolCVar(StringUtils::StringHash hash) override;
     /**
      * Set the value of an integer CVar by its name
      * @param hash The name of the CVar
@@ -258,7 +364,7 @@ public:
      * @param hash The name of the CVar
      * @return A pointer to the value of the CVar
      */
-    double* getFloatCVar(StringUtils::StringHash hash) override;
+    std::atomic<double>* getFloatCVar(StringUtils::StringHash hash) override;
     /**
      * Set the value of a float CVar by its name
      * @param hash The name of the CVar
@@ -271,13 +377,25 @@ public:
      * @param hash The name of the CVar
      * @return A pointer to the value of the CVar
      */
-    std::string* getStringCVar(StringUtils::StringHash hash) override;
+    const std::string* getStringCVar(StringUtils::StringHash hash) override;
+    /**
+     * Get where a string CVar's current value is published
+     * @param hash The name of the CVar
+     * @return A pointer to the atomic holding the CVar's current string
+     */
+    std::atomic<const std::string*>* getStringCVarPtr(StringUtils::StringHash hash) override;
     /**
      * Set the value of a string CVar by its name
      * @param hash The name of the CVar
      * @param value The new value of the CVar
      */
     void setStringCVar(StringUtils::StringHash hash, const char* value) override;
+    /**
+     * Free the strings replaced by setting string CVars that no reader can still hold
+     * @param framesInFlight The number of frames that may still be reading a replaced string
+     * @return The number of strings freed
+     */
+    size_t reclaimStrings(uint32_t framesInFlight) override;
 
     /**
      * Create a new Integer CVar
@@ -439,25 +557,36 @@ CVarParameter* ::CVarSystemImpl::getCVar(const StringUtils::StringHash hash) {
 /*  CVar Parameter                              */
 /* -------------------------------------------- */
 
-int32_t* ::CVarSystemImpl::getIntCVar(const StringUtils::StringHash hash) { return getCVarCurrent<int32_t>(hash); }
+std::atomic<int32_t>* ::CVarSystemImpl::getIntCVar(const StringUtils::StringHash hash) {
+    return getCVarCurrent<int32_t>(hash);
+}
 
 void ::CVarSystemImpl::setIntCVar(const StringUtils::StringHash hash, const int32_t value) {
     setCVarCurrent<int32_t>(hash, value);
 }
 
-bool* ::CVarSystemImpl::getBoolCVar(const StringUtils::StringHash hash) { return getCVarCurrent<bool>(hash); }
+std::atomic<bool>* ::CVarSystemImpl::getBoolCVar(const StringUtils::StringHash hash) {
+    return getCVarCurrent<bool>(hash);
+}
 
 void ::CVarSystemImpl::setBoolCVar(const StringUtils::StringHash hash, const bool value) {
     setCVarCurrent<bool>(hash, value);
 }
 
-double* ::CVarSystemImpl::getFloatCVar(const StringUtils::StringHash hash) { return getCVarCurrent<double>(hash); }
+std::atomic<double>* ::CVarSystemImpl::getFloatCVar(const StringUtils::StringHash hash) {
+    return getCVarCurrent<double>(hash);
+}
 
 void ::CVarSystemImpl::setFloatCVar(const StringUtils::StringHash hash, const double value) {
     setCVarCurrent<double>(hash, value);
 }
 
-std::string* ::CVarSystemImpl::getStringCVar(const StringUtils::StringHash hash) {
+const std::string* ::CVarSystemImpl::getStringCVar(const StringUtils::StringHash hash) {
+    const std::atomic<const std::string*>* value = getCVarCurrent<std::string>(hash);
+    return value ? value->load(std::memory_order_acquire) : nullptr;
+}
+
+std::atomic<const std::string*>* ::CVarSystemImpl::getStringCVarPtr(const StringUtils::StringHash hash) {
     return getCVarCurrent<std::string>(hash);
 }
 
@@ -465,6 +594,10 @@ void ::CVarSystemImpl::setStringCVar(const StringUtils::StringHash hash, const c
     setCVarCurrent<std::string>(hash, value);
 }
 
+size_t ::CVarSystemImpl::reclaimStrings(const uint32_t framesInFlight) {
+    return stringCVars.reclaim(framesInFlight);
+}
+
 CVarParameter* ::CVarSystemImpl::createIntCVar(
         const char* name, const char* description, const CVarCategory category, const int32_t value
 ) {
@@ -603,10 +736,10 @@ T getCVarDefaultValueByIndex(const uint32_t index) {
  * Get a pointer to the value of a CVar by index
  * @tparam T The type of the CVar
  * @param index The index of the CVar
- * @return The pointer to the current value of the CVar
+ * @return The pointer to the atomic holding the current value of the CVar
  */
 template<typename T>
-T* getCVarValuePtrByIndex(uint32_t index) {
+std::atomic<CVarValue<T>>* getCVarValuePtrByIndex(uint32_t index) {
     return ::CVarSystemImpl::get()->getCVarArray<T>()->getCurrentPtr(index);
 }
 
@@ -632,6 +765,21 @@ T resetCVarValueByIndex(uint32_t index) {
     return ::CVarSystemImpl::get()->getCVarArray<T>()->reset(index);
 }
 
+// Atomic
+template<typename T>
+T CVarAtomic<T>::getDefault() const {
+    return getCVarDefaultValueByIndex<T>(this->index);
+}
+
+template<typename T>
+T CVarAtomic<T>::reset() {
+    return resetCVarValueByIndex<T>(this->index);
+}
+
+template struct DatEngine::CVarAtomic<int32_t>;
+template struct DatEngine::CVarAtomic<bool>;
+template struct DatEngine::CVarAtomic<double>;
+
 // Int
 CVarInt::CVarInt(
         const char* name,
@@ -643,6 +791,7 @@ CVarInt::CVarInt(
     CVarParameter* cvar = CVarSystem::get()->createIntCVar(name, description, category, defaultValue);
     cvar->flags = flags;
     index = cvar->arrayIndex;
+    this->value = getCVarValuePtrByIndex<TCvar>(index);
 }
 
 CVarInt::CVarInt(
@@ -656,18 +805,9 @@ CVarInt::CVarInt(
     CVarParameter* cvar = CVarSystem::get()->createIntCVar(name, description, category, defaultValue, value);
     cvar->flags = flags;
     index = cvar->arrayIndex;
+    this->value = getCVarValuePtrByIndex<TCvar>(index);
 }
 
-int32_t CVarInt::get() { return getCVarValueByIndex<TCvar>(index); }
-
-int32_t CVarInt::getDefault() { return getCVarDefaultValueByIndex<TCvar>(index); }
-
-int32_t* CVarInt::getPtr() { return getCVarValuePtrByIndex<TCvar>(index); }
-
-void CVarInt::set(const int32_t value) { setCVarValueByIndex<TCvar>(index, value); }
-
-int32_t CVarInt::reset() { return resetCVarValueByIndex<TCvar>(index); }
-
 // Bool
 CVarBool::CVarBool(
         const char* name,
@@ -679,6 +819,7 @@ CVarBool::CVarBool(
     CVarParameter* cvar = CVarSystem::get()->createBoolCVar(name, description, category, defaultValue);
     cvar->flags = flags;
     index = cvar->arrayIndex;
+    this->value = getCVarValuePtrByIndex<TCvar>(index);
 }
 
 CVarBool::CVarBool(
@@ -692,18 +833,9 @@ CVarBool::CVarBool(
     CVarParameter* cvar = CVarSystem::get()->createBoolCVar(name, description, category, defaultValue, value);
     cvar->flags = flags;
     index = cvar->arrayIndex;
+    this->value = getCVarValuePtrByIndex<TCvar>(index);
 }
 
-bool CVarBool::get() { return getCVarValueByIndex<TCvar>(index); }
-
-bool CVarBool::getDefault() { return getCVarDefaultValueByIndex<TCvar>(index); }
-
-bool* CVarBool::getPtr() { return getCVarValuePtrByIndex<TCvar>(index); }
-
-void CVarBool::set(const bool value) { setCVarValueByIndex<TCvar>(index, value); }
-
-bool CVarBool::reset() { return resetCVarValueByIndex<TCvar>(index); }
-
 // Double
 CVarFloat::CVarFloat(
         const char* name,
@@ -715,6 +847,7 @@ CVarFloat::CVarFloat(
     CVarParameter* cvar = CVarSystem::get()->createFloatCVar(name, description, category, defaultValue);
     cvar->flags = flags;
     index = cvar->arrayIndex;
+    this->value = getCVarValuePtrByIndex<TCvar>(index);
 }
 
 CVarFloat::CVarFloat(
@@ -728,20 +861,9 @@ CVarFloat::CVarFloat(
     CVarParameter* cvar = CVarSystem::get()->createFloatCVar(name, description, category, defaultValue, value);
     cvar->flags = flags;
     index = cvar->arrayIndex;
+    this->value = getCVarValuePtrByIndex<TCvar>(index);
 }
 
-float CVarFloat::getFloat() { return static_cast<float>(get()); }
-
-double CVarFloat::get() { return getCVarValueByIndex<TCvar>(index); }
-
-double CVarFloat::getDefault() { return getCVarDefaultValueByIndex<TCvar>(index); }
-
-double* CVarFloat::getPtr() { return getCVarValuePtrByIndex<TCvar>(index); }
-
-void CVarFloat::set(double value) { setCVarValueByIndex<TCvar>(index, value); }
-
-double CVarFloat::reset() { return resetCVarValueByIndex<TCvar>(index); }
-
 // String
 CVarString::CVarString(
         const char* name,
@@ -753,6 +875,7 @@ CVarString::CVarString(
     CVarParameter* cvar = CVarSystem::get()->createStringCVar(name, description, category, defaultValue);
     cvar->flags = flags;
     index = cvar->arrayIndex;
+    this->value = getCVarValuePtrByIndex<TCvar>(index);
 }
 
 CVarString::CVarString(
@@ -766,14 +889,11 @@ CVarString::CVarString(
     CVarParameter* cvar = CVarSystem::get()->createStringCVar(name, description, category, defaultValue, value);
     cvar->flags = flags;
     index = cvar->arrayIndex;
+    this->value = getCVarValuePtrByIndex<TCvar>(index);
 }
 
-std::string CVarString::get() { return getCVarValueByIndex<TCvar>(index); }
-
-std::string CVarString::getDefault() { return getCVarDefaultValueByIndex<TCvar>(index); }
-
-std::string* CVarString::getPtr() { return getCVarValuePtrByIndex<TCvar>(index); }
+std::string CVarString::getDefault() const { return getCVarDefaultValueByIndex<TCvar>(index); }
 
-void CVarString::set(std::string value) { setCVarValueByIndex<TCvar>(index, value); }
+void CVarString::set(std::string newValue) { setCVarValueByIndex<TCvar>(index, std::move(newValue)); }
 
 std::string CVarString::reset() { return resetCVarValueByIndex<TCvar>(index); }
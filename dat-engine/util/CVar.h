@@ -4,7 +4,11 @@
 
 #pragma once
 
+#include <atomic>
+#include <cassert>
+#include <cstddef>
 #include <cstdint>
+#include <string>
 #include <type_traits>
 #include <util/StringUtils.h>
 
@@ -175,9 +179,9 @@ namespace DatEngine {
          * Get the value of an Integer CVar by its hash
          *
          * @param hash The hash of the CVar to get
-         * @return A pointer to the value of the CVar with the given hash
+         * @return A pointer to the value of the CVar with the given hash, or nullptr if there's no such CVar
          */
-        virtual int32_t* getIntCVar(StringUtils::StringHash hash) = 0;
+        virtual std::atomic<int32_t>* getIntCVar(StringUtils::StringHash hash) = 0;
         /**
          * Set the value of an Integer CVar
          *
@@ -189,9 +193,9 @@ namespace DatEngine {
          * Get the value of a Boolean CVar by its hash
          *
          * @param hash The hash of the CVar to get
-         * @return A pointer to the value of the CVar with the given hash
+         * @return A pointer to the value of the CVar with the given hash, or nullptr if there's no such CVar
          */
-        virtual bool* getBoolCVar(StringUtils::StringHash hash) = 0;
+        virtual std::atomic<bool>* getBoolCVar(StringUtils::StringHash hash) = 0;
         /**
          * Set the value of a Boolean CVar
          *
@@ -204,9 +208,9 @@ namespace DatEngine {
          * Get the value of a Float CVar by its hash
          *
          * @param hash The hash of the CVar to get
-         * @return A pointer to the value of the CVar with the given hash
+         * @return A pointer to the value of the CVar with the given hash, or nullptr if there's no such CVar
          */
-        virtual double* getFloatCVar(StringUtils::StringHash hash) = 0;
+        virtual std::atomic<double>* getFloatCVar(StringUtils::StringHash hash) = 0;
         /**
          * Set the value of a Float CVar
          *
@@ -219,9 +223,18 @@ namespace DatEngine {
          * Get the value of a String CVar by its hash
          *
          * @param hash The hash of the CVar to get
-         * @return A pointer to the value of the CVar with the given hash
+         * @return The value of the CVar with the given hash when called, or nullptr if there's no such CVar. Setting
+         *         the CVar publishes a new string rather than modifying this one, so the pointer stays valid until
+         *         the string is reclaimed, see reclaimStrings().
          */
-        virtual std::string* getStringCVar(StringUtils::StringHash hash) = 0;
+        virtual const std::string* getStringCVar(StringUtils::StringHash hash) = 0;
+        /**
+         * Get where the value of a String CVar is published by its hash
+         *
+         * @param hash The hash of the CVar to get
+         * @return A pointer to the atomic holding the CVar's current string, or nullptr if there's no such CVar
+         */
+        virtual std::atomic<const std::string*>* getStringCVarPtr(StringUtils::StringHash hash) = 0;
         /**
          * Set the value of a String CVar
          *
@@ -229,12 +242,28 @@ namespace DatEngine {
          * @param value The value to set the CVar to
          */
         virtual void setStringCVar(StringUtils::StringHash hash, const char* value) = 0;
+        /**
+         * Free the strings replaced by setting String CVars once no reader can still be using them
+         * <br>
+         * Replaced strings are kept until they've survived \p framesInFlight later calls, so the engine calls this
+         * once per frame after the oldest frame in flight has finished. Pointers to a string CVar's value must not be
+         * held past the end of the frame they were read in. Without calls to this, every string a CVar is set to is
+         * kept until shutdown.
+         *
+         * @param framesInFlight The number of frames that may still be reading a replaced string
+         * @return The number of strings freed
+         */
+        virtual size_t reclaimStrings(uint32_t framesInFlight) = 0;
     };
 
     /**
      * Base class for Automatic CVar Registration
      *
      * This should not be used directly, instead one of the specific child classes should be used.
+     * <br>
+     * Every CVar can be read from any thread without locking. Int, bool and float values are atomics read with relaxed
+     * ordering, so a read sees some recent value but isn't ordered with other memory. String values are published
+     * by swapping in a new immutable string, so readers never see a string being modified.
      *
      * @tparam T The type of the CVar
      *
@@ -250,40 +279,54 @@ namespace DatEngine {
         /** The index of the CVar in it's CVarArray */
         uint32_t index = 0;
         using TCvar = T;
+    };
+
+    /**
+     * Base class for CVars stored as atomics, which resolve their value's address once on registration so reads are a
+     * single relaxed load
+     *
+     * @tparam T The type of the CVar, must be lock free as an atomic
+     */
+    template<typename T>
+    struct CVarAtomic : CVar<T> {
+        static_assert(std::atomic<T>::is_always_lock_free, "Atomic CVar values must be lock free");
+
+    protected:
+        /** The CVar's current value, owned by the CVar system */
+        std::atomic<T>* value = nullptr;
 
     public:
-        virtual ~CVar() = default;
         /**
          * get the value of the CVar
          * @return The current value of the CVar
          */
-        virtual T get() = 0;
+        T get() const { return value->load(std::memory_order_relaxed); }
         /**
          * Get the default value of the CVar
          * @return The default value of the CVar
          */
-        virtual T getDefault() = 0;
+        T getDefault() const;
         /**
          * Get a pointer to the value of the CVar
-         * @return A pointer to the CVar value
+         * @return A pointer to the CVar value, which is valid for the lifetime of the program
          */
-        virtual T* getPtr() = 0;
+        std::atomic<T>* getPtr() const { return value; }
         /**
          * Set the value of the CVar
-         * @param value The new value of the CVar
+         * @param newValue The new value of the CVar
          */
-        virtual void set(T value) = 0;
+        void set(T newValue) { value->store(newValue, std::memory_order_relaxed); }
         /**
          * Reset the CVar to it's default value
          * @return The new value of the CVar
          */
-        virtual T reset() = 0;
+        T reset();
     };
 
     /**
      * CVar Specialisation for Integer values
      */
-    struct CVarInt : CVar<int32_t> {
+    struct CVarInt : CVarAtomic<int32_t> {
         CVarInt(const char* name,
                 const char* description,
                 CVarCategory category,
@@ -295,18 +338,12 @@ namespace DatEngine {
                 int value,
                 int defaultValue,
                 CVarFlags flags = CVarFlags::None);
-
-        int get() override;
-        int getDefault() override;
-        int* getPtr() override;
-        void set(int value) override;
-        int reset() override;
     };
 
     /**
      * CVar Specialisation for Boolean values
      */
-    struct CVarBool : CVar<bool> {
+    struct CVarBool : CVarAtomic<bool> {
         CVarBool(
                 const char* name,
                 const char* description,
@@ -322,18 +359,12 @@ namespace DatEngine {
                 bool defaultValue,
                 CVarFlags flags = CVarFlags::None
         );
-
-        bool get() override;
-        bool getDefault() override;
-        bool* getPtr() override;
-        void set(bool value) override;
-        bool reset() override;
     };
 
     /**
      * CVar Specialisation for floating point values
      */
-    struct CVarFloat : CVar<double> {
+    struct CVarFloat : CVarAtomic<double> {
         CVarFloat(
                 const char* name,
                 const char* description,
@@ -354,13 +385,7 @@ namespace DatEngine {
          * Get the CVar value as a float instead of a double
          * @return The CVar value as a float
          */
-        float getFloat();
-
-        double get() override;
-        double getDefault() override;
-        double* getPtr() override;
-        void set(double value) override;
-        double reset() override;
+        float getFloat() const { return static_cast<float>(get()); }
     };
 
     /**
@@ -383,11 +408,36 @@ namespace DatEngine {
                 CVarFlags flags = CVarFlags::None
         );
 
-        std::string get() override;
-        std::string getDefault() override;
-        std::string* getPtr() override;
-        void set(std::string value) override;
-        std::string reset() override;
+        /**
+         * get the value of the CVar
+         * @return The current value of the CVar
+         */
+        std::string get() const { return *getPtr(); }
+        /**
+         * Get the default value of the CVar
+         * @return The default value of the CVar
+         */
+        std::string getDefault() const;
+        /**
+         * Get the current value of the CVar without copying it
+         * @return The value when called, which stays unchanged after the CVar is set and valid until the end of the
+         *         frame, see CVarSystem::reclaimStrings()
+         */
+        const std::string* getPtr() const { return value->load(std::memory_order_acquire); }
+        /**
+         * Set the value of the CVar, publishing a new string
+         * @param newValue The new value of the CVar
+         */
+        void set(std::string newValue);
+        /**
+         * Reset the CVar to it's default value
+         * @return The new value of the CVar
+         */
+        std::string reset();
+
+    private:
+        /** The CVar's current value, owned by the CVar system */
+        std::atomic<const std::string*>* value = nullptr;
     };
 
     /**
@@ -418,13 +468,13 @@ namespace DatEngine {
          * Get the value stored in the CVar as the enum type
          * @return The enum value stored in the CVar
          */
-        T getEnum() { return static_cast<T>(CVarInt::get()); }
+        T getEnum() const { return static_cast<T>(CVarInt::get()); }
 
         /**
          * Get the default value stored in the CVar as the enum type
          * @return The default enum value stored in the CVar
          */
-        T getDefaultEnum() { return static_cast<T>(CVarInt::getDefault()); }
+        T getDefaultEnum() const { return static_cast<T>(CVarInt::getDefault()); }
 
         /**
          * Set the value of the CVar using the enum representation
@@ -438,4 +488,108 @@ namespace DatEngine {
          */
         T resetEnum() { return static_cast<T>(CVarInt::reset()); }
     };
+
+    /**
+     * The name of a CVar checked at compile time, created with the _cvar literal
+     *
+     * @tparam T The type of the CVar, given by the first letter of its name
+     */
+    template<typename T>
+    struct CVarName {
+        StringUtils::StringHash hash;
+    };
+
+    /**
+     * A string literal usable as a template parameter, so _cvar can inspect the name at compile time
+     */
+    template<size_t N>
+    struct CVarNameLiteral {
+        char name[N]{};
+
+        consteval CVarNameLiteral(const char (&literal)[N]) {
+            for (size_t i = 0; i < N; ++i) name[i] = literal[i];
+        }
+    };
+
+    /**
+     * Name a CVar, hashing the name and deducing its type from the prefix at compile time
+     * <br>
+     * The prefix is I for int, E for enum, B for bool, F for float and S for string, anything else fails to compile.
+     * Whether the CVar exists can only be checked once it's resolved by a CVarRef.
+     *
+     * @return The CVarName of the CVar
+     */
+    template<CVarNameLiteral Literal>
+    consteval auto operator""_cvar() {
+        constexpr char prefix = Literal.name[0];
+        constexpr StringUtils::StringHash hash(StringUtils::fnv1a_32(Literal.name, sizeof(Literal.name) - 1));
+
+        if constexpr (prefix == 'I' || prefix == 'E') return CVarName<int32_t>{hash};
+        else if constexpr (prefix == 'B') return CVarName<bool>{hash};
+        else if constexpr (prefix == 'F') return CVarName<double>{hash};
+        else if constexpr (prefix == 'S') return CVarName<std::string>{hash};
+        else static_assert(prefix == 'I', "CVar names must start with I, E, B, F or S for their type");
+    }
+
+    /**
+     * A handle to a CVar that's looked up once, then reads and writes the CVar's storage directly
+     * <br>
+     * Use this for CVars owned elsewhere that are read often, where looking them up by name each time would hash the
+     * name and search every CVar. The CVar must have been registered before the reference is created.
+     *
+     * @tparam T The type of the CVar, int32_t, bool, double or std::string
+     */
+    template<typename T>
+    class CVarRef {
+        using TValue = std::conditional_t<std::is_same_v<T, std::string>, const std::string*, T>;
+
+        std::atomic<TValue>* value = nullptr;
+
+    public:
+        CVarRef() = default;
+
+        /**
+         * Look up a CVar by its name hash
+         *
+         * @param hash The hash of the CVar's name
+         */
+        explicit CVarRef(const StringUtils::StringHash hash) {
+            CVarSystem* system = CVarSystem::get();
+            if constexpr (std::is_same_v<T, int32_t>) value = system->getIntCVar(hash);
+            else if constexpr (std::is_same_v<T, bool>) value = system->getBoolCVar(hash);
+            else if constexpr (std::is_same_v<T, double>) value = system->getFloatCVar(hash);
+            else value = system->getStringCVarPtr(hash);
+        }
+
+        /**
+         * Look up a CVar named with the _cvar literal
+         *
+         * @param name The name of the CVar, which must exist with type T
+         */
+        CVarRef(const CVarName<T> name) : CVarRef(name.hash) { assert(isValid() && "No CVar with this name and type"); }
+
+        /**
+         * Check if the CVar was found with the right type
+         */
+        [[nodiscard]] bool isValid() const { return value != nullptr; }
+
+        /**
+         * get the value of the CVar
+         * @return The current value of the CVar
+         */
+        T get() const {
+            if constexpr (std::is_same_v<T, std::string>) return *value->load(std::memory_order_acquire);
+            else return value->load(std::memory_order_relaxed);
+        }
+
+        /**
+         * Set the value of the CVar
+         * @param newValue The new value of the CVar
+         */
+        void set(const T& newValue)
+            requires(!std::is_same_v<T, std::string>)
+        {
+            value->store(newValue, std::memory_order_relaxed);
+        }
+    };
 } // namespace DatEngine
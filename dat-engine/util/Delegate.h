@@ -0,0 +1,147 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace DatEngine {
+    /** The default number of bytes a Delegate can store inline, enough for a lambda capturing four pointers */
+    inline constexpr size_t defaultDelegateCapacity = 4 * sizeof(void*);
+
+    template<typename TSignature, size_t Capacity = defaultDelegateCapacity>
+    class Delegate;
+
+    /**
+     * A callable wrapper like std::function that stores the callable inline and never allocates
+     * <br>
+     * Callables that don't fit in the buffer are rejected at compile time instead of spilling to the heap. Calling a
+     * delegate is a single indirect call, and delegates holding trivially copyable callables (plain function pointers
+     * and lambdas capturing pointers or values) are copied with memcpy.
+     *
+     * @tparam TReturn The return type of the delegate
+     * @tparam TArgs The argument types of the delegate
+     * @tparam Capacity The number of bytes available to store the callable
+     */
+    template<typename TReturn, typename... TArgs, size_t Capacity>
+    class Delegate<TReturn(TArgs...), Capacity> {
+        enum class Operation { Copy, Move, Destroy };
+
+        using Invoker = TReturn (*)(void* storage, TArgs... args);
+        /** Copies, moves or destroys the stored callable, nullptr when it can be memcpy'd and needs no destructor */
+        using Manager = void (*)(Operation operation, void* destination, void* source);
+
+        alignas(std::max_align_t) std::byte storage[Capacity];
+        Invoker invoker = nullptr;
+        Manager manager = nullptr;
+
+        template<typename TCallable>
+        static TReturn invoke(void* storage, TArgs... args) {
+            return std::invoke(*std::launder(static_cast<TCallable*>(storage)), std::forward<TArgs>(args)...);
+        }
+
+        template<typename TCallable>
+        static void manage(const Operation operation, void* destination, void* source) {
+            auto* callable = std::launder(static_cast<TCallable*>(source));
+            switch (operation) {
+                case Operation::Copy: new (destination) TCallable(*callable); break;
+                case Operation::Move: new (destination) TCallable(std::move(*callable)); [[fallthrough]];
+                case Operation::Destroy: callable->~TCallable(); break;
+            }
+        }
+
+        void copyFrom(const Delegate& other) {
+            invoker = other.invoker;
+            manager = other.manager;
+            if (manager) {
+                manager(Operation::Copy, storage, const_cast<std::byte*>(other.storage));
+            } else {
+                std::memcpy(storage, other.storage, Capacity);
+            }
+        }
+
+        void moveFrom(Delegate& other) noexcept {
+            invoker = std::exchange(other.invoker, nullptr);
+            manager = std::exchange(other.manager, nullptr);
+            if (manager) {
+                manager(Operation::Move, storage, other.storage);
+            } else {
+                std::memcpy(storage, other.storage, Capacity);
+            }
+        }
+
+    public:
+        /**
+         * Create an empty delegate, which must be assigned before it's called
+         */
+        Delegate() = default;
+
+        /**
+         * Create a delegate holding a callable
+         *
+         * @tparam TCallable The type of the callable, must fit in the delegate's buffer
+         * @param callable The callable to store
+         */
+        template<typename TCallable>
+            requires(!std::is_same_v<std::remove_cvref_t<TCallable>, Delegate> &&
+                     std::is_invocable_r_v<TReturn, std::decay_t<TCallable>&, TArgs...>)
+        Delegate(TCallable&& callable) { // NOLINT(*-explicit-constructor), converts like std::function
+            using TStored = std::decay_t<TCallable>;
+            static_assert(sizeof(TStored) <= Capacity, "Callable is too large for the delegate's buffer");
+            static_assert(alignof(TStored) <= alignof(std::max_align_t), "Callable is over aligned");
+            static_assert(std::is_nothrow_move_constructible_v<TStored>, "Callable must be nothrow movable");
+
+            new (storage) TStored(std::forward<TCallable>(callable));
+            invoker = &invoke<TStored>;
+            if constexpr (!std::is_trivially_copyable_v<TStored> || !std::is_trivially_destructible_v<TStored>) {
+                manager = &manage<TStored>;
+            }
+        }
+
+        Delegate(const Delegate& other) { copyFrom(other); }
+        Delegate(Delegate&& other) noexcept { moveFrom(other); }
+
+        Delegate& operator=(const Delegate& other) {
+            if (this != &other) {
+                reset();
+                copyFrom(other);
+            }
+            return *this;
+        }
+
+        Delegate& operator=(Delegate&& other) noexcept {
+            if (this != &other) {
+                reset();
+                moveFrom(other);
+            }
+            return *this;
+        }
+
+        ~Delegate() { reset(); }
+
+        /**
+         * Destroy the stored callable, leaving the delegate empty
+         */
+        void reset() {
+            if (manager) manager(Operation::Destroy, nullptr, storage);
+            invoker = nullptr;
+            manager = nullptr;
+        }
+
+        /**
+         * Call the stored callable
+         *
+         * @note The delegate must not be empty
+         */
+        TReturn operator()(TArgs... args) const {
+            return invoker(const_cast<std::byte*>(storage), std::forward<TArgs>(args)...);
+        }
+
+        /**
+         * Check if the delegate holds a callable
+         */
+        explicit operator bool() const { return invoker != nullptr; }
+    };
+} // namespace DatEngine
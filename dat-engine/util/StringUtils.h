@@ -16,9 +16,17 @@
 namespace DatEngine::StringUtils {
     /**
      * Calculate the hash of a string using the FNV-1a 32bit hashing algorithm.
+     *
+     * @note The character at s[count] is included in the hash, so for a null terminated string of length count the
+     *       terminator is hashed too
      */
     constexpr uint32_t fnv1a_32(char const* s, const std::size_t count) {
-        return ((count ? fnv1a_32(s, count - 1) : 2166136261u) ^ s[count]) * 16777619u;
+        // A loop rather than recursion, so long strings don't hit constexpr depth limits or recurse at runtime
+        uint32_t hash = 2166136261u;
+        for (std::size_t i = 0; i <= count; ++i) {
+            hash = (hash ^ s[i]) * 16777619u;
+        }
+        return hash;
     }
 
     /**
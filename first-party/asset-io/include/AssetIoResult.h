@@ -8,6 +8,7 @@ namespace DatAssetIO {
         SUCCESS = 0,
         INVALID_SIGNATURE = 1,
         VERSION_MISMATCH = 2,
-        CORRUPT_FILE = 3
+        CORRUPT_FILE = 3,
+        UNSUPPORTED_TYPE = 4
     };
 }
\ No newline at end of file
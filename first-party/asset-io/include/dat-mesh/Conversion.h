@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+#include "../AssetIoResult.h"
+#include "Meta.h"
+
+namespace DatAssetIO::DatMesh {
+    /* -------------------------------------------- */
+    /*  Half Floats                                 */
+    /* -------------------------------------------- */
+
+    /**
+     * Convert a float to an IEEE 754 half precision float, rounding to the nearest representable value
+     * <br>
+     * Values too large for a half become infinity, and NaNs stay NaN.
+     *
+     * @param value The float to convert
+     * @return The bits of the half precision float
+     */
+    uint16_t floatToHalf(float value);
+
+    /**
+     * Convert an IEEE 754 half precision float to a float, this is always exact
+     *
+     * @param half The bits of the half precision float
+     * @return The float equivalent of the half
+     */
+    float halfToFloat(uint16_t half);
+
+    /* -------------------------------------------- */
+    /*  Bulk Conversion                             */
+    /* -------------------------------------------- */
+
+    /**
+     * Convert a span of float components into the packed representation of a type hint, for example to quantise vertex
+     * attributes before writing them to a DatMesh
+     * <br>
+     * SFloat components are rounded to the nearest float of the primitive size. UNorm and SNorm components are
+     * clamped to 0 to 1 or -1 to 1 and scaled to the integer range, and all other integer types are rounded to nearest,
+     * saturating at the limits of the range. NaNs become 0 for all of the integer types.
+     *
+     * @note 8 and 16 bit integer types use SSE4.1, and 16 bit floats use F16C, when available.
+     *
+     * @param typeHint The type to convert to
+     * @param in The components to convert, the size must be a multiple of the component count of \p typeHint
+     * @param out Where to write the converted values, must be at least
+     *            @code in.size() * getPrimitiveSize(typeHint)@endcode bytes
+     * @return SUCCESS, or UNSUPPORTED_TYPE if the type hint has no valid representation (R8SFloat)
+     */
+    AssetIOResult convertFromFloat(TypeHint typeHint, std::span<const float> in, std::span<uint8_t> out);
+
+    /**
+     * Convert the packed representation of a type hint into float components, for example to decode vertex attributes
+     * when a mesh is loaded
+     * <br>
+     * UNorm values are mapped to 0 to 1, SNorm values to -1 to 1, and all other types are converted to the nearest
+     * float.
+     *
+     * @note 8 and 16 bit integer types use SSE4.1, and 16 bit floats use F16C, when available.
+     *
+     * @param typeHint The type to convert from
+     * @param in The packed values to convert, the size must be a multiple of @code getTypeSize(typeHint)@endcode
+     * @param out Where to write the components, must be at least @code in.size() / getPrimitiveSize(typeHint)@endcode
+     *            big
+     * @return SUCCESS, or UNSUPPORTED_TYPE if the type hint has no valid representation (R8SFloat)
+     */
+    AssetIOResult convertToFloat(TypeHint typeHint, std::span<const uint8_t> in, std::span<float> out);
+} // namespace DatAssetIO::DatMesh
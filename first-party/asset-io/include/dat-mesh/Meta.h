@@ -106,10 +106,10 @@ namespace DatAssetIO::DatMesh {
     TypeHint getPrimitiveTypeHint(TypeHint typeHint);
 
     /**
-     * Get the size in bits of each component in the given type
+     * Get the size in bytes of each component in the given type
      *
      * @param typeHint The type hint to get the component size of
-     * @return The component size of the Type in bits
+     * @return The component size of the Type in bytes
      */
     uint32_t getPrimitiveSize(TypeHint typeHint);
 
@@ -120,4 +120,12 @@ namespace DatAssetIO::DatMesh {
      * @return The number of components in the type
      */
     uint32_t getComponentCount(TypeHint typeHint);
+
+    /**
+     * Get the size in bytes of a whole value of the type, including all of its components
+     *
+     * @param typeHint The type hint to get the size of
+     * @return The size of the Type in bytes
+     */
+    uint32_t getTypeSize(TypeHint typeHint);
 } // namespace DatAsset::DatMesh
@@ -0,0 +1,381 @@
+#include "dat-mesh/Conversion.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+// The instruction sets are detected from the compiler flags, DAT_ASSET_IO_NO_SIMD forces the scalar fallbacks
+#if !defined(DAT_ASSET_IO_NO_SIMD) && (defined(__SSE4_1__) || defined(__AVX__))
+#define DAT_CONVERSION_SSE 1
+#endif
+
+// MSVC doesn't define __F16C__, so there it's enabled with DAT_ASSET_IO_ENABLE_F16C instead
+#if defined(DAT_CONVERSION_SSE) && defined(__AVX__) &&                                                                \
+        (defined(__F16C__) || (defined(_MSC_VER) && defined(DAT_ASSET_IO_F16C)))
+#define DAT_CONVERSION_F16C 1
+#endif
+
+#ifdef DAT_CONVERSION_SSE
+#include <immintrin.h>
+#endif
+
+using namespace DatAssetIO;
+using namespace DatAssetIO::DatMesh;
+
+namespace {
+    /* -------------------------------------------- */
+    /*  Integers                                    */
+    /* -------------------------------------------- */
+
+    /**
+     * The type the conversion maths is done in, floats are exact for anything up to 16 bits
+     */
+    template<typename T>
+    using ComputeType = std::conditional_t<(sizeof(T) <= 2), float, double>;
+
+    /**
+     * How float components map to an integer type
+     * <br>
+     * Encoding multiplies by scale and clamps between min and max, decoding divides by scale and clamps to min / scale.
+     */
+    template<typename T>
+    struct IntegerFormat {
+        ComputeType<T> scale;
+        ComputeType<T> min;
+        ComputeType<T> max;
+    };
+
+    template<typename T>
+    IntegerFormat<T> getIntegerFormat(const bool normalised) {
+        using TCompute = ComputeType<T>;
+        constexpr auto typeMin = static_cast<TCompute>(std::numeric_limits<T>::min());
+        constexpr auto typeMax = static_cast<TCompute>(std::numeric_limits<T>::max());
+
+        // SNorm is symmetric, so the most negative value is unused and -1 is exactly representable
+        if (normalised) return {typeMax, std::is_signed_v<T> ? -typeMax : 0, typeMax};
+        return {1, typeMin, typeMax};
+    }
+
+    /**
+     * Cast a value that has been rounded and clamped to the range of T, the clamp may have rounded the upper limit of
+     * 64 bit types up to a value out of range, which saturates instead
+     */
+    template<typename T, typename TCompute>
+    T saturateCast(const TCompute value) {
+        if (value >= static_cast<TCompute>(std::numeric_limits<T>::max())) return std::numeric_limits<T>::max();
+        return static_cast<T>(value);
+    }
+
+    template<typename T>
+    T encodeInteger(const IntegerFormat<T>& format, const float value) {
+        using TCompute = ComputeType<T>;
+        if (std::isnan(value)) return 0;
+
+        const TCompute scaled = std::clamp(static_cast<TCompute>(value) * format.scale, format.min, format.max);
+        return saturateCast<T>(std::nearbyint(scaled));
+    }
+
+    template<typename T>
+    float decodeInteger(const IntegerFormat<T>& format, const T value) {
+        using TCompute = ComputeType<T>;
+        return static_cast<float>(std::max(static_cast<TCompute>(value) / format.scale, format.min / format.scale));
+    }
+
+#ifdef DAT_CONVERSION_SSE
+    /**
+     * Convert 4 floats to clamped, rounded int32s, with NaNs converted to 0
+     */
+    __m128i encodeX4(const __m128 value, const __m128 scale, const __m128 min, const __m128 max) {
+        const __m128 notNan = _mm_cmpord_ps(value, value);
+        const __m128 scaled = _mm_mul_ps(_mm_and_ps(value, notNan), scale);
+        return _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(scaled, min), max));
+    }
+
+    /**
+     * Encode 8 floats into 8 values of an 8 or 16 bit integer type
+     */
+    template<typename T>
+    void encodeIntegersX8(const float* in, uint8_t* out, const __m128 scale, const __m128 min, const __m128 max) {
+        const __m128i low = encodeX4(_mm_loadu_ps(in), scale, min, max);
+        const __m128i high = encodeX4(_mm_loadu_ps(in + 4), scale, min, max);
+
+        // The values are already clamped to the range of T, so the saturation of the packs never kicks in
+        if constexpr (std::is_same_v<T, uint8_t>) {
+            const __m128i packed = _mm_packs_epi32(low, high);
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(out), _mm_packus_epi16(packed, packed));
+        } else if constexpr (std::is_same_v<T, int8_t>) {
+            const __m128i packed = _mm_packs_epi32(low, high);
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(out), _mm_packs_epi16(packed, packed));
+        } else if constexpr (std::is_same_v<T, uint16_t>) {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_packus_epi32(low, high));
+        } else {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_packs_epi32(low, high));
+        }
+    }
+
+    /**
+     * Decode 8 values of an 8 or 16 bit integer type into 8 floats
+     */
+    template<typename T>
+    void decodeIntegersX8(const uint8_t* in, float* out, const __m128 scale, const __m128 min) {
+        __m128i low;
+        __m128i high;
+        if constexpr (sizeof(T) == 1) {
+            const __m128i packed = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(in));
+            const __m128i packedHigh = _mm_srli_si128(packed, 4);
+            low = std::is_signed_v<T> ? _mm_cvtepi8_epi32(packed) : _mm_cvtepu8_epi32(packed);
+            high = std::is_signed_v<T> ? _mm_cvtepi8_epi32(packedHigh) : _mm_cvtepu8_epi32(packedHigh);
+        } else {
+            const __m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+            const __m128i packedHigh = _mm_srli_si128(packed, 8);
+            low = std::is_signed_v<T> ? _mm_cvtepi16_epi32(packed) : _mm_cvtepu16_epi32(packed);
+            high = std::is_signed_v<T> ? _mm_cvtepi16_epi32(packedHigh) : _mm_cvtepu16_epi32(packedHigh);
+        }
+
+        _mm_storeu_ps(out, _mm_max_ps(_mm_div_ps(_mm_cvtepi32_ps(low), scale), min));
+        _mm_storeu_ps(out + 4, _mm_max_ps(_mm_div_ps(_mm_cvtepi32_ps(high), scale), min));
+    }
+#endif
+
+    template<typename T>
+    void encodeIntegers(const bool normalised, const std::span<const float> in, uint8_t* out) {
+        const IntegerFormat<T> format = getIntegerFormat<T>(normalised);
+
+        size_t i = 0;
+#ifdef DAT_CONVERSION_SSE
+        if constexpr (sizeof(T) <= 2) {
+            const __m128 scale = _mm_set1_ps(format.scale);
+            const __m128 min = _mm_set1_ps(format.min);
+            const __m128 max = _mm_set1_ps(format.max);
+            for (; i + 8 <= in.size(); i += 8) {
+                encodeIntegersX8<T>(&in[i], out + i * sizeof(T), scale, min, max);
+            }
+        }
+#endif
+        // Tail, or everything when SSE isn't available
+        for (; i < in.size(); ++i) {
+            const T value = encodeInteger(format, in[i]);
+            std::memcpy(out + i * sizeof(T), &value, sizeof(T));
+        }
+    }
+
+    template<typename T>
+    void decodeIntegers(const bool normalised, const uint8_t* in, const std::span<float> out) {
+        const IntegerFormat<T> format = getIntegerFormat<T>(normalised);
+
+        size_t i = 0;
+#ifdef DAT_CONVERSION_SSE
+        if constexpr (sizeof(T) <= 2) {
+            const __m128 scale = _mm_set1_ps(format.scale);
+            const __m128 min = _mm_set1_ps(format.min / format.scale);
+            for (; i + 8 <= out.size(); i += 8) {
+                decodeIntegersX8<T>(in + i * sizeof(T), &out[i], scale, min);
+            }
+        }
+#endif
+        for (; i < out.size(); ++i) {
+            T value;
+            std::memcpy(&value, in + i * sizeof(T), sizeof(T));
+            out[i] = decodeInteger(format, value);
+        }
+    }
+
+    /**
+     * Call a function with a std::type_identity of the integer type with the given size and signedness
+     */
+    template<typename TFunction>
+    void visitIntegerType(const uint32_t size, const bool isSigned, TFunction&& function) {
+        switch (size) {
+            case 1:
+                isSigned ? function(std::type_identity<int8_t>{}) : function(std::type_identity<uint8_t>{});
+                break;
+            case 2:
+                isSigned ? function(std::type_identity<int16_t>{}) : function(std::type_identity<uint16_t>{});
+                break;
+            case 4:
+                isSigned ? function(std::type_identity<int32_t>{}) : function(std::type_identity<uint32_t>{});
+                break;
+            default:
+                isSigned ? function(std::type_identity<int64_t>{}) : function(std::type_identity<uint64_t>{});
+                break;
+        }
+    }
+
+    /* -------------------------------------------- */
+    /*  Floats                                      */
+    /* -------------------------------------------- */
+
+    void encodeHalves(const std::span<const float> in, uint8_t* out) {
+        size_t i = 0;
+#ifdef DAT_CONVERSION_F16C
+        for (; i + 8 <= in.size(); i += 8) {
+            const __m128i halves = _mm256_cvtps_ph(_mm256_loadu_ps(&in[i]), _MM_FROUND_TO_NEAREST_INT);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i * sizeof(uint16_t)), halves);
+        }
+#endif
+        for (; i < in.size(); ++i) {
+            const uint16_t half = floatToHalf(in[i]);
+            std::memcpy(out + i * sizeof(uint16_t), &half, sizeof(uint16_t));
+        }
+    }
+
+    void decodeHalves(const uint8_t* in, const std::span<float> out) {
+        size_t i = 0;
+#ifdef DAT_CONVERSION_F16C
+        for (; i + 8 <= out.size(); i += 8) {
+            const __m128i halves = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i * sizeof(uint16_t)));
+            _mm256_storeu_ps(&out[i], _mm256_cvtph_ps(halves));
+        }
+#endif
+        for (; i < out.size(); ++i) {
+            uint16_t half;
+            std::memcpy(&half, in + i * sizeof(uint16_t), sizeof(uint16_t));
+            out[i] = halfToFloat(half);
+        }
+    }
+
+    void encodeDoubles(const std::span<const float> in, uint8_t* out) {
+        for (size_t i = 0; i < in.size(); ++i) {
+            const double value = in[i];
+            std::memcpy(out + i * sizeof(double), &value, sizeof(double));
+        }
+    }
+
+    void decodeDoubles(const uint8_t* in, const std::span<float> out) {
+        for (size_t i = 0; i < out.size(); ++i) {
+            double value;
+            std::memcpy(&value, in + i * sizeof(double), sizeof(double));
+            out[i] = static_cast<float>(value);
+        }
+    }
+} // namespace
+
+/* -------------------------------------------- */
+/*  Half Floats                                 */
+/* -------------------------------------------- */
+
+uint16_t DatAssetIO::DatMesh::floatToHalf(const float value) {
+    const uint32_t bits = std::bit_cast<uint32_t>(value);
+    const auto sign = static_cast<uint16_t>((bits >> 16) & 0x8000);
+    uint32_t absBits = bits & 0x7FFFFFFF;
+
+    // Infinity and NaN, NaNs are made quiet but otherwise keep the top of their payload like F16C does
+    if (absBits >= 0x7F800000) {
+        const uint32_t nan = absBits > 0x7F800000 ? 0x200 | ((absBits >> 13) & 0x3FF) : 0;
+        return static_cast<uint16_t>(sign | 0x7C00 | nan);
+    }
+
+    // Too big for a half, 65536 and above always round to infinity
+    if (absBits >= 0x47800000) return static_cast<uint16_t>(sign | 0x7C00);
+
+    // Too small to be a normal half, adding 0.5 lines the denormal half's mantissa up with the bottom of the float's
+    // mantissa, letting the FPU do the rounding
+    if (absBits < 0x38800000) {
+        constexpr uint32_t denormalMagic = 126u << 23;
+        const float shifted = std::bit_cast<float>(absBits) + std::bit_cast<float>(denormalMagic);
+        return static_cast<uint16_t>(sign | (std::bit_cast<uint32_t>(shifted) - denormalMagic));
+    }
+
+    // Rebias the exponent and round to nearest even, a mantissa that rounds up carries into the exponent correctly
+    const uint32_t mantissaOdd = (absBits >> 13) & 1;
+    absBits += (static_cast<uint32_t>(15 - 127) << 23) + 0xFFF + mantissaOdd;
+    return static_cast<uint16_t>(sign | (absBits >> 13));
+}
+
+float DatAssetIO::DatMesh::halfToFloat(const uint16_t half) {
+    const uint32_t sign = static_cast<uint32_t>(half & 0x8000) << 16;
+    const uint32_t exponent = (half >> 10) & 0x1F;
+    const uint32_t mantissa = half & 0x3FF;
+
+    // Infinity and NaN, NaNs are made quiet like F16C does
+    if (exponent == 0x1F) {
+        return std::bit_cast<float>(sign | 0x7F800000 | (mantissa << 13) | (mantissa != 0 ? 0x400000 : 0));
+    }
+
+    // Zero and denormals, which are all normal floats
+    if (exponent == 0) {
+        const float magnitude = static_cast<float>(mantissa) * 0x1p-24f;
+        return sign != 0 ? -magnitude : magnitude;
+    }
+
+    return std::bit_cast<float>(sign | ((exponent + 127 - 15) << 23) | (mantissa << 13));
+}
+
+/* -------------------------------------------- */
+/*  Bulk Conversion                             */
+/* -------------------------------------------- */
+
+AssetIOResult DatAssetIO::DatMesh::convertFromFloat(
+        const TypeHint typeHint, const std::span<const float> in, const std::span<uint8_t> out
+) {
+    const uint32_t primitiveSize = getPrimitiveSize(typeHint);
+    assert(in.size() % getComponentCount(typeHint) == 0);
+    assert(out.size() >= in.size() * primitiveSize);
+
+    const TypeHint primitive = getPrimitiveTypeHint(typeHint);
+    switch (primitive) {
+        case TypeHint::R8SFloat:
+            if (primitiveSize == 1) return AssetIOResult::UNSUPPORTED_TYPE;
+            if (primitiveSize == 2) encodeHalves(in, out.data());
+            else if (primitiveSize == 4) std::memcpy(out.data(), in.data(), in.size_bytes());
+            else encodeDoubles(in, out.data());
+            return AssetIOResult::SUCCESS;
+        case TypeHint::R8UInt:
+        case TypeHint::R8SInt:
+        case TypeHint::R8UNorm:
+        case TypeHint::R8SNorm:
+        case TypeHint::R8UScaled:
+        case TypeHint::R8SScaled: {
+            const bool isSigned =
+                    primitive == TypeHint::R8SInt || primitive == TypeHint::R8SNorm || primitive == TypeHint::R8SScaled;
+            const bool normalised = primitive == TypeHint::R8UNorm || primitive == TypeHint::R8SNorm;
+            visitIntegerType(primitiveSize, isSigned, [&]<typename T>(std::type_identity<T>) {
+                encodeIntegers<T>(normalised, in, out.data());
+            });
+            return AssetIOResult::SUCCESS;
+        }
+        default:
+            return AssetIOResult::UNSUPPORTED_TYPE;
+    }
+}
+
+AssetIOResult DatAssetIO::DatMesh::convertToFloat(
+        const TypeHint typeHint, const std::span<const uint8_t> in, const std::span<float> out
+) {
+    const uint32_t primitiveSize = getPrimitiveSize(typeHint);
+    assert(in.size() % getTypeSize(typeHint) == 0);
+    assert(out.size() >= in.size() / primitiveSize);
+
+    // Only convert as many components as there are in the input
+    const std::span<float> components = out.first(in.size() / primitiveSize);
+
+    const TypeHint primitive = getPrimitiveTypeHint(typeHint);
+    switch (primitive) {
+        case TypeHint::R8SFloat:
+            if (primitiveSize == 1) return AssetIOResult::UNSUPPORTED_TYPE;
+            if (primitiveSize == 2) decodeHalves(in.data(), components);
+            else if (primitiveSize == 4) std::memcpy(components.data(), in.data(), in.size_bytes());
+            else decodeDoubles(in.data(), components);
+            return AssetIOResult::SUCCESS;
+        case TypeHint::R8UInt:
+        case TypeHint::R8SInt:
+        case TypeHint::R8UNorm:
+        case TypeHint::R8SNorm:
+        case TypeHint::R8UScaled:
+        case TypeHint::R8SScaled: {
+            const bool isSigned =
+                    primitive == TypeHint::R8SInt || primitive == TypeHint::R8SNorm || primitive == TypeHint::R8SScaled;
+            const bool normalised = primitive == TypeHint::R8UNorm || primitive == TypeHint::R8SNorm;
+            visitIntegerType(primitiveSize, isSigned, [&]<typename T>(std::type_identity<T>) {
+                decodeIntegers<T>(normalised, in.data(), components);
+            });
+            return AssetIOResult::SUCCESS;
+        }
+        default:
+            return AssetIOResult::UNSUPPORTED_TYPE;
+    }
+}
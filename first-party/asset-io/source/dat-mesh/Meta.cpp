@@ -11,3 +11,7 @@ uint32_t DatAssetIO::DatMesh::getPrimitiveSize(const TypeHint typeHint) {
 uint32_t DatAssetIO::DatMesh::getComponentCount(const TypeHint typeHint) {
     return ((static_cast<uint32_t>(typeHint) & 0b00110000) >> 4) + 1;
 }
+
+uint32_t DatAssetIO::DatMesh::getTypeSize(const TypeHint typeHint) {
+    return getPrimitiveSize(typeHint) * getComponentCount(typeHint);
+}
@@ -0,0 +1,217 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <maths/Bounds.h>
+#include <maths/bounds/FrustumCulling.h>
+
+#include <string>
+#include <vector>
+
+using namespace DatEngine::DatMaths;
+
+namespace {
+    /**
+     * A Vulkan style (zero to one depth) perspective projection looking down -Z with a 90 degree FOV, so at a depth
+     * of d the frustum spans -d to d on X and Y
+     */
+    mat4 makeProjection(const float near, const float far, const bool zeroToOneDepth = true) {
+        mat4 projection;
+        projection[0][0] = 1;
+        projection[1][1] = 1;
+        projection[2][3] = -1;
+        if (zeroToOneDepth) {
+            projection[2][2] = far / (near - far);
+            projection[3][2] = near * far / (near - far);
+        } else {
+            projection[2][2] = (far + near) / (near - far);
+            projection[3][2] = 2 * near * far / (near - far);
+        }
+        return projection;
+    }
+
+    /**
+     * A small deterministic random number generator, returns values in [min, max)
+     */
+    struct Random {
+        uint32_t state = 12345;
+
+        float next(const float min, const float max) {
+            state = state * 1664525u + 1013904223u;
+            return min + (max - min) * static_cast<float>(state >> 8) / static_cast<float>(1 << 24);
+        }
+    };
+} // namespace
+
+/* -------------------------------------------- */
+/*  AABB                                        */
+/* -------------------------------------------- */
+
+TEST_CASE("AABB", "[DatMaths, Bounds, AABB]") {
+    const AABB box(vec3(-1, -2, -3), vec3(1, 2, 3));
+
+    SECTION("Centre and Extents") {
+        const AABB offset = AABB::fromCentreExtents(vec3(5, 5, 5), vec3(1, 2, 3));
+        REQUIRE(offset.min == vec3(4, 3, 2));
+        REQUIRE(offset.max == vec3(6, 7, 8));
+        REQUIRE(offset.getCentre() == vec3(5, 5, 5));
+        REQUIRE(offset.getExtents() == vec3(1, 2, 3));
+    }
+
+    SECTION("Contains") {
+        REQUIRE(box.contains(vec3(0, 0, 0)));
+        REQUIRE(box.contains(vec3(1, 2, 3)));
+        REQUIRE_FALSE(box.contains(vec3(0, 2.1f, 0)));
+    }
+
+    SECTION("Intersects") {
+        REQUIRE(box.intersects(AABB(vec3(0.5f, 0, 0), vec3(4, 4, 4))));
+        REQUIRE(box.intersects(AABB(vec3(1, 2, 3), vec3(4, 4, 4))));
+        REQUIRE_FALSE(box.intersects(AABB(vec3(1.5f, 0, 0), vec3(4, 4, 4))));
+    }
+
+    SECTION("Expand") {
+        AABB expanded = box;
+        expanded.expand(vec3(5, -5, 0));
+        REQUIRE(expanded.min == vec3(-1, -5, -3));
+        REQUIRE(expanded.max == vec3(5, 2, 3));
+
+        expanded.expand(AABB(vec3(-10, 0, 0), vec3(0, 0, 10)));
+        REQUIRE(expanded.min == vec3(-10, -5, -3));
+        REQUIRE(expanded.max == vec3(5, 2, 10));
+    }
+
+    SECTION("Transformed") {
+        mat4 transform = mat4::identity();
+        transform[3] = vec4(10, 0, 0, 1);
+
+        const AABB moved = box.transformed(transform);
+        REQUIRE(moved.min == vec3(9, -2, -3));
+        REQUIRE(moved.max == vec3(11, 2, 3));
+
+        // A 90 degree rotation around Y swaps the X and Z extents
+        mat4 rotation = mat4::identity();
+        rotation[0] = vec4(0, 0, -1, 0);
+        rotation[2] = vec4(1, 0, 0, 0);
+
+        const AABB rotated = box.transformed(rotation);
+        REQUIRE(rotated.min.equal(vec3(-3, -2, -1), 1e-6f));
+        REQUIRE(rotated.max.equal(vec3(3, 2, 1), 1e-6f));
+    }
+}
+
+/* -------------------------------------------- */
+/*  Bounding Sphere                             */
+/* -------------------------------------------- */
+
+TEST_CASE("Bounding Sphere", "[DatMaths, Bounds, Sphere]") {
+    const BoundingSphere sphere(vec3(1, 0, 0), 2);
+
+    SECTION("Contains") {
+        REQUIRE(sphere.contains(vec3(3, 0, 0)));
+        REQUIRE_FALSE(sphere.contains(vec3(3, 0.1f, 0)));
+    }
+
+    SECTION("Intersects Sphere") {
+        REQUIRE(sphere.intersects(BoundingSphere(vec3(4, 0, 0), 1)));
+        REQUIRE_FALSE(sphere.intersects(BoundingSphere(vec3(4.1f, 0, 0), 1)));
+    }
+
+    SECTION("Intersects AABB") {
+        REQUIRE(sphere.intersects(AABB(vec3(2.5f, -1, -1), vec3(4, 1, 1))));
+        REQUIRE_FALSE(sphere.intersects(AABB(vec3(2.5f, 1.9f, -1), vec3(4, 3, 1))));
+    }
+
+    SECTION("From AABB") {
+        const BoundingSphere fromBox = BoundingSphere::fromAABB(AABB(vec3(0, 0, 0), vec3(2, 4, 4)));
+        REQUIRE(fromBox.centre == vec3(1, 2, 2));
+        REQUIRE(fromBox.radius == Catch::Approx(3));
+    }
+}
+
+/* -------------------------------------------- */
+/*  Frustum                                     */
+/* -------------------------------------------- */
+
+TEST_CASE("Frustum", "[DatMaths, Bounds, Frustum]") {
+    const Frustum frustum(makeProjection(1, 100));
+
+    SECTION("Planes") {
+        REQUIRE(frustum.distance(Frustum::Near, vec3(0, 0, -1)) == Catch::Approx(0).margin(1e-5));
+        REQUIRE(frustum.distance(Frustum::Far, vec3(0, 0, -100)) == Catch::Approx(0).margin(1e-3));
+        REQUIRE(frustum.distance(Frustum::Near, vec3(0, 0, -3)) == Catch::Approx(2));
+    }
+
+    SECTION("Contains") {
+        REQUIRE(frustum.contains(vec3(0, 0, -5)));
+        REQUIRE(frustum.contains(vec3(9, -9, -10)));
+        REQUIRE_FALSE(frustum.contains(vec3(0, 0, 5)));
+        REQUIRE_FALSE(frustum.contains(vec3(0, 0, -0.5f)));
+        REQUIRE_FALSE(frustum.contains(vec3(0, 0, -150)));
+        REQUIRE_FALSE(frustum.contains(vec3(11, 0, -10)));
+        REQUIRE_FALSE(frustum.contains(vec3(0, 11, -10)));
+    }
+
+    SECTION("OpenGL Depth") {
+        const Frustum glFrustum(makeProjection(1, 100, false), false);
+        REQUIRE(glFrustum.distance(Frustum::Near, vec3(0, 0, -1)) == Catch::Approx(0).margin(1e-5));
+        REQUIRE(glFrustum.contains(vec3(0, 0, -5)));
+        REQUIRE_FALSE(glFrustum.contains(vec3(0, 0, -0.5f)));
+    }
+
+    SECTION("Spheres") {
+        // 2 units past the right plane at a depth of 10, sqrt(2) away from it
+        REQUIRE(frustum.intersects(BoundingSphere(vec3(12, 0, -10), 1.5f)));
+        REQUIRE_FALSE(frustum.intersects(BoundingSphere(vec3(12, 0, -10), 1.3f)));
+        REQUIRE_FALSE(frustum.intersects(BoundingSphere(vec3(0, 0, 5), 1)));
+    }
+
+    SECTION("AABBs") {
+        REQUIRE(frustum.intersects(AABB::fromCentreExtents(vec3(0, 0, -10), vec3(1))));
+        REQUIRE(frustum.intersects(AABB::fromCentreExtents(vec3(12, 0, -10), vec3(1.5f))));
+        REQUIRE_FALSE(frustum.intersects(AABB::fromCentreExtents(vec3(12, 0, -10), vec3(0.5f))));
+        REQUIRE_FALSE(frustum.intersects(AABB::fromCentreExtents(vec3(0, 0, 10), vec3(5))));
+    }
+}
+
+/* -------------------------------------------- */
+/*  Batch Culling                               */
+/* -------------------------------------------- */
+
+TEST_CASE("Frustum Culling", "[DatMaths, Bounds, Frustum, Batch]") {
+    const Frustum frustum(makeProjection(1, 100));
+
+    // Sizes either side of the 8 wide SIMD width and the 64 bit mask words
+    for (const size_t count : {0, 1, 7, 8, 9, 64, 65, 130}) {
+        SECTION("Size " + std::to_string(count)) {
+            Random random;
+            Vec3SoA centres;
+            Vec3SoA extents;
+            std::vector<float> radii;
+            for (size_t i = 0; i < count; ++i) {
+                centres.pushBack(vec3(random.next(-60, 60), random.next(-60, 60), random.next(-120, 20)));
+                extents.pushBack(vec3(random.next(0, 10), random.next(0, 10), random.next(0, 10)));
+                radii.push_back(random.next(0, 10));
+            }
+
+            // Start with every bit set, to check the unused bits get cleared
+            std::vector<uint64_t> visibility(visibilityMaskSize(count) + 1, ~uint64_t{0});
+            const auto isVisible = [&](const size_t i) { return (visibility[i / 64] >> (i % 64) & 1) != 0; };
+
+            cullSpheres(frustum, centres, radii, visibility);
+            for (size_t i = 0; i < count; ++i) {
+                REQUIRE(isVisible(i) == frustum.intersects(BoundingSphere(centres.get(i), radii[i])));
+            }
+            for (size_t i = count; i < visibilityMaskSize(count) * 64; ++i) {
+                REQUIRE_FALSE(isVisible(i));
+            }
+            // Words past the mask aren't touched
+            REQUIRE(visibility.back() == ~uint64_t{0});
+
+            cullAABBs(frustum, centres, extents, visibility);
+            for (size_t i = 0; i < count; ++i) {
+                const AABB box = AABB::fromCentreExtents(centres.get(i), extents.get(i));
+                REQUIRE(isVisible(i) == frustum.intersects(box));
+            }
+        }
+    }
+}
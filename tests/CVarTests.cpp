@@ -0,0 +1,183 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <util/CVar.h>
+
+using namespace DatEngine;
+
+namespace {
+    enum class TestMode : int32_t { First, Second, Third };
+
+    CVarInt testIntCVar("ITestInt", "An int CVar for tests", CVarCategory::General, 5);
+    CVarBool testBoolCVar("BTestBool", "A bool CVar for tests", CVarCategory::General, false);
+    CVarFloat testFloatCVar("FTestFloat", "A float CVar for tests", CVarCategory::General, 0.5);
+    CVarString testStringCVar("STestString", "A string CVar for tests", CVarCategory::General, "default");
+    CVarEnum testEnumCVar("ETestEnum", "An enum CVar for tests", CVarCategory::General, TestMode::Second);
+} // namespace
+
+TEST_CASE("CVar Values", "[Util, CVar]") {
+    SECTION("Int") {
+        REQUIRE(testIntCVar.get() == 5);
+        testIntCVar.set(10);
+        REQUIRE(testIntCVar.get() == 10);
+        REQUIRE(testIntCVar.getPtr()->load() == 10);
+        REQUIRE(testIntCVar.getDefault() == 5);
+        REQUIRE(testIntCVar.reset() == 5);
+        REQUIRE(testIntCVar.get() == 5);
+    }
+
+    SECTION("Bool") {
+        testBoolCVar.set(true);
+        REQUIRE(testBoolCVar.get());
+        REQUIRE_FALSE(testBoolCVar.reset());
+    }
+
+    SECTION("Float") {
+        testFloatCVar.set(2.25);
+        REQUIRE(testFloatCVar.get() == 2.25);
+        REQUIRE(testFloatCVar.getFloat() == 2.25f);
+        REQUIRE(testFloatCVar.reset() == 0.5);
+    }
+
+    SECTION("String") {
+        const std::string* before = testStringCVar.getPtr();
+        testStringCVar.set("changed");
+
+        // The old value is left untouched for any reader still holding it
+        REQUIRE(*before == "default");
+        REQUIRE(testStringCVar.get() == "changed");
+        REQUIRE(testStringCVar.getDefault() == "default");
+        REQUIRE(testStringCVar.reset() == "default");
+        REQUIRE(testStringCVar.get() == "default");
+    }
+
+    SECTION("Enum") {
+        REQUIRE(testEnumCVar.getEnum() == TestMode::Second);
+        testEnumCVar.set(TestMode::Third);
+        REQUIRE(testEnumCVar.getEnum() == TestMode::Third);
+        REQUIRE(testEnumCVar.resetEnum() == TestMode::Second);
+    }
+}
+
+TEST_CASE("CVar System Lookup", "[Util, CVar]") {
+    CVarSystem* system = CVarSystem::get();
+
+    SECTION("By Name") {
+        REQUIRE(system->getIntCVar("ITestInt") == testIntCVar.getPtr());
+        REQUIRE(system->getBoolCVar("BTestBool") == testBoolCVar.getPtr());
+        REQUIRE(system->getFloatCVar("FTestFloat") == testFloatCVar.getPtr());
+        REQUIRE(*system->getStringCVar("STestString") == testStringCVar.get());
+        REQUIRE(system->getIntCVar("IMissing") == nullptr);
+        REQUIRE(system->getStringCVar("SMissing") == nullptr);
+    }
+
+    SECTION("Set By Name") {
+        system->setIntCVar("ITestInt", 42);
+        REQUIRE(testIntCVar.get() == 42);
+        system->setStringCVar("STestString", "by name");
+        REQUIRE(testStringCVar.get() == "by name");
+
+        testIntCVar.reset();
+        testStringCVar.reset();
+    }
+}
+
+TEST_CASE("CVar Concurrent Access", "[Util, CVar, Threading]") {
+    constexpr int readerCount = 4;
+    constexpr int writes = 2000;
+
+    std::atomic<bool> done = false;
+    std::atomic<bool> valid = true;
+    std::vector<std::thread> readers;
+    for (int i = 0; i < readerCount; ++i) {
+        readers.emplace_back([&] {
+            while (!done.load(std::memory_order_acquire)) {
+                // Every string ever published is one of the two values, and is never seen half written
+                const std::string value = testStringCVar.get();
+                if (value != "default" && value != std::string(64, 'x')) valid = false;
+                if (testIntCVar.get() < 5) valid = false;
+            }
+        });
+    }
+
+    for (int i = 0; i < writes; ++i) {
+        testIntCVar.set(5 + i);
+        testStringCVar.set(i % 2 ? "default" : std::string(64, 'x'));
+    }
+    done = true;
+    for (std::thread& reader : readers) reader.join();
+
+    REQUIRE(valid);
+    testIntCVar.reset();
+    testStringCVar.reset();
+}
+
+TEST_CASE("CVar String Reclamation", "[Util, CVar]") {
+    CVarSystem* system = CVarSystem::get();
+    // Anything left over from earlier tests is old enough to free by the third call
+    system->reclaimStrings(2);
+    system->reclaimStrings(2);
+    system->reclaimStrings(2);
+
+    const std::string* before = testStringCVar.getPtr();
+    testStringCVar.set("changed");
+
+    // The replaced string survives as many calls as there are frames in flight
+    REQUIRE(system->reclaimStrings(2) == 0);
+    REQUIRE(system->reclaimStrings(2) == 0);
+    REQUIRE(*before == "default");
+    REQUIRE(system->reclaimStrings(2) == 1);
+    REQUIRE(testStringCVar.get() == "changed");
+
+    testStringCVar.reset();
+}
+
+TEST_CASE("CVar References", "[Util, CVar]") {
+    SECTION("Literal") {
+        STATIC_REQUIRE(std::is_same_v<decltype("ITestInt"_cvar), CVarName<int32_t>>);
+        STATIC_REQUIRE(std::is_same_v<decltype("ETestEnum"_cvar), CVarName<int32_t>>);
+        STATIC_REQUIRE(std::is_same_v<decltype("BTestBool"_cvar), CVarName<bool>>);
+        STATIC_REQUIRE(std::is_same_v<decltype("FTestFloat"_cvar), CVarName<double>>);
+        STATIC_REQUIRE(std::is_same_v<decltype("STestString"_cvar), CVarName<std::string>>);
+        STATIC_REQUIRE("ITestInt"_cvar.hash == StringUtils::StringHash("ITestInt"));
+    }
+
+    SECTION("Values") {
+        const CVarRef intRef = "ITestInt"_cvar;
+        const CVarRef floatRef = "FTestFloat"_cvar;
+        const CVarRef stringRef = "STestString"_cvar;
+        CVarRef boolRef = "BTestBool"_cvar;
+
+        REQUIRE(intRef.get() == testIntCVar.get());
+        REQUIRE(floatRef.get() == testFloatCVar.get());
+        REQUIRE(stringRef.get() == testStringCVar.get());
+
+        testIntCVar.set(7);
+        testStringCVar.set("through ref");
+        REQUIRE(intRef.get() == 7);
+        REQUIRE(stringRef.get() == "through ref");
+
+        boolRef.set(true);
+        REQUIRE(testBoolCVar.get());
+
+        testIntCVar.reset();
+        testBoolCVar.reset();
+        testStringCVar.reset();
+    }
+
+    SECTION("Enum") {
+        const CVarRef enumRef = "ETestEnum"_cvar;
+        REQUIRE(static_cast<TestMode>(enumRef.get()) == testEnumCVar.getEnum());
+    }
+
+    SECTION("Invalid") {
+        REQUIRE_FALSE(CVarRef<int32_t>(StringUtils::StringHash("IMissing")).isValid());
+        // A CVar of a different type isn't found, rather than reading the wrong storage
+        REQUIRE_FALSE(CVarRef<int32_t>(StringUtils::StringHash("BTestBool")).isValid());
+    }
+}
@@ -0,0 +1,182 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <maths/CommonMaths.h>
+
+#include <cmath>
+#include <functional>
+
+using namespace DatEngine::DatMaths;
+
+namespace {
+    /**
+     * Sample a function evenly over a range and get the largest error compared to a reference
+     * @param relative Whether to measure the error relative to the reference value rather than absolute
+     */
+    double maxError(
+            const std::function<float(float)>& func, const std::function<double(double)>& reference, const float min,
+            const float max, const bool relative = false, const int samples = 100000
+    ) {
+        double worst = 0;
+        for (int i = 0; i <= samples; ++i) {
+            const float value = min + (max - min) * static_cast<float>(i) / samples;
+            const double expected = reference(value);
+            double error = std::abs(func(value) - expected);
+            if (relative) {
+                error /= std::abs(expected);
+            }
+            worst = std::max(worst, error);
+        }
+        return worst;
+    }
+} // namespace
+
+/* -------------------------------------------- */
+/*  Square Root                                 */
+/* -------------------------------------------- */
+
+// The maximum errors measured here are the bounds documented on Precision
+
+TEST_CASE("Sqrt Precision", "[DatMaths, CommonMaths, Sqrt]") {
+    const auto reference = [](const double value) { return std::sqrt(value); };
+
+    SECTION("Fast") {
+        REQUIRE(maxError(sqrt<Precision::Fast, float>, reference, 1e-6f, 1e6f, true) < 1e-6);
+        REQUIRE(sqrt<Precision::Fast>(0.f) == 0);
+    }
+
+    SECTION("Balanced") {
+        REQUIRE(maxError(sqrt<Precision::Balanced, float>, reference, 1e-6f, 1e6f, true) < 1e-7);
+    }
+
+    SECTION("Exact") {
+        REQUIRE(sqrt(16.f) == 4);
+        REQUIRE(sqrt(2.0) == std::sqrt(2.0));
+    }
+}
+
+TEST_CASE("Inverse Sqrt Precision", "[DatMaths, CommonMaths, Sqrt]") {
+    const auto reference = [](const double value) { return 1 / std::sqrt(value); };
+
+    SECTION("Fast") {
+        REQUIRE(maxError(invSqrt<Precision::Fast, float>, reference, 1e-6f, 1e6f, true) < 1e-6);
+    }
+
+    SECTION("Balanced") {
+        REQUIRE(maxError(invSqrt<Precision::Balanced, float>, reference, 1e-6f, 1e6f, true) < 2e-7);
+    }
+
+    SECTION("Exact") {
+        REQUIRE(invSqrt(4.f) == 0.5f);
+    }
+}
+
+/* -------------------------------------------- */
+/*  Trigonometry                                */
+/* -------------------------------------------- */
+
+TEST_CASE("Sin Precision", "[DatMaths, CommonMaths, Trigonometry]") {
+    const auto reference = [](const double value) { return std::sin(value); };
+    constexpr float range = 8 * constants::pi;
+
+    SECTION("Fast") {
+        REQUIRE(maxError(sin<Precision::Fast, float>, reference, -range, range) < 1e-4);
+    }
+
+    SECTION("Balanced") {
+        REQUIRE(maxError(sin<Precision::Balanced, float>, reference, -range, range) < 1e-6);
+    }
+
+    SECTION("Exact") {
+        REQUIRE(sin(1.f) == std::sin(1.f));
+    }
+}
+
+TEST_CASE("Cos Precision", "[DatMaths, CommonMaths, Trigonometry]") {
+    const auto reference = [](const double value) { return std::cos(value); };
+    constexpr float range = 8 * constants::pi;
+
+    SECTION("Fast") {
+        REQUIRE(maxError(cos<Precision::Fast, float>, reference, -range, range) < 1e-4);
+    }
+
+    SECTION("Balanced") {
+        REQUIRE(maxError(cos<Precision::Balanced, float>, reference, -range, range) < 1e-6);
+    }
+
+    SECTION("Exact") {
+        REQUIRE(cos(1.f) == std::cos(1.f));
+    }
+}
+
+TEST_CASE("Atan2 Precision", "[DatMaths, CommonMaths, Trigonometry]") {
+    // Sweep points around a circle, so every octant is covered
+    const auto reference = [](const double angle) { return std::atan2(std::sin(angle), std::cos(angle)); };
+    const auto circle = [](const auto atan2Func) {
+        return [atan2Func](const float angle) {
+            return atan2Func(3 * static_cast<float>(std::sin(angle)), 3 * static_cast<float>(std::cos(angle)));
+        };
+    };
+    constexpr float range = constants::pi - 1e-3f;
+
+    SECTION("Fast") {
+        REQUIRE(maxError(circle(atan2<Precision::Fast, float>), reference, -range, range) < 1e-4);
+        REQUIRE(atan2<Precision::Fast>(0.f, 0.f) == 0);
+    }
+
+    SECTION("Balanced") {
+        REQUIRE(maxError(circle(atan2<Precision::Balanced, float>), reference, -range, range) < 1e-6);
+    }
+
+    SECTION("Exact") {
+        REQUIRE(atan2(1.f, 2.f) == std::atan2(1.f, 2.f));
+    }
+}
+
+/* -------------------------------------------- */
+/*  8 Wide                                      */
+/* -------------------------------------------- */
+
+#ifdef DAT_SIMD_AVX
+TEST_CASE("8 Wide Matches Scalar", "[DatMaths, CommonMaths, Simd]") {
+    alignas(32) float values[8] = {-20.f, -3.f, -1.f, 0.25f, 1.f, 2.5f, 7.f, 100.f};
+    alignas(32) float others[8] = {1.f, -2.f, 0.5f, -0.25f, 3.f, 0.f, -7.f, 2.f};
+    alignas(32) float out[8];
+    const __m256 simd = _mm256_load_ps(values);
+    const __m256 otherSimd = _mm256_load_ps(others);
+
+    SECTION("Sin") {
+        _mm256_store_ps(out, sin<Precision::Fast>(simd));
+        for (int i = 0; i < 8; ++i) {
+            REQUIRE(out[i] == Catch::Approx(sin<Precision::Fast>(values[i])).margin(1e-6));
+        }
+    }
+
+    SECTION("Cos") {
+        _mm256_store_ps(out, cos<Precision::Balanced>(simd));
+        for (int i = 0; i < 8; ++i) {
+            REQUIRE(out[i] == Catch::Approx(cos<Precision::Balanced>(values[i])).margin(1e-6));
+        }
+    }
+
+    SECTION("Atan2") {
+        _mm256_store_ps(out, atan2<Precision::Fast>(simd, otherSimd));
+        for (int i = 0; i < 8; ++i) {
+            REQUIRE(out[i] == Catch::Approx(atan2<Precision::Fast>(values[i], others[i])).margin(1e-6));
+        }
+    }
+
+    SECTION("Sqrt") {
+        const __m256 positive = _mm256_andnot_ps(_mm256_set1_ps(-0.f), simd);
+        _mm256_store_ps(out, invSqrt<Precision::Fast>(positive));
+        for (int i = 0; i < 8; ++i) {
+            REQUIRE(out[i] == Catch::Approx(1 / std::sqrt(std::abs(values[i]))).epsilon(1e-6));
+        }
+
+        _mm256_store_ps(out, sqrt<Precision::Fast>(positive));
+        for (int i = 0; i < 8; ++i) {
+            REQUIRE(out[i] == Catch::Approx(std::sqrt(std::abs(values[i]))).epsilon(1e-6));
+        }
+    }
+}
+#endif
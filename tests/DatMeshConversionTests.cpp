@@ -0,0 +1,256 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <dat-mesh/Conversion.h>
+
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+using namespace DatAssetIO;
+using namespace DatAssetIO::DatMesh;
+
+namespace {
+    /**
+     * Encode then decode a set of components, checking both conversions succeed
+     */
+    std::vector<float> roundTrip(const TypeHint typeHint, const std::vector<float>& components) {
+        std::vector<uint8_t> encoded(components.size() * getPrimitiveSize(typeHint));
+        REQUIRE(convertFromFloat(typeHint, components, encoded) == AssetIOResult::SUCCESS);
+
+        std::vector<float> decoded(components.size());
+        REQUIRE(convertToFloat(typeHint, encoded, decoded) == AssetIOResult::SUCCESS);
+        return decoded;
+    }
+
+    template<typename T>
+    std::vector<T> encode(const TypeHint typeHint, const std::vector<float>& components) {
+        std::vector<uint8_t> encoded(components.size() * sizeof(T));
+        REQUIRE(convertFromFloat(typeHint, components, encoded) == AssetIOResult::SUCCESS);
+
+        std::vector<T> result(components.size());
+        std::memcpy(result.data(), encoded.data(), encoded.size());
+        return result;
+    }
+
+    /**
+     * Components covering both ends of every range, rounding ties and NaN, repeated to cover the SIMD and scalar paths
+     */
+    std::vector<float> makeComponents(const size_t count) {
+        const float specials[] = {
+                0, -0.f, 1, -1, 0.5f, -0.5f, 2, -2, 0.1f, 1.f / 255, 127.5f, 128.5f, -128.5f, 32767.5f, 40000, -40000,
+                65504, 70000, 1e-6f, 6e-8f, std::numeric_limits<float>::infinity(),
+                -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::quiet_NaN()
+        };
+
+        std::vector<float> result;
+        for (size_t i = 0; i < count; ++i) {
+            result.push_back(specials[i % std::size(specials)] * (i < std::size(specials) ? 1.f : 0.37f));
+        }
+        return result;
+    }
+} // namespace
+
+/* -------------------------------------------- */
+/*  Meta                                        */
+/* -------------------------------------------- */
+
+TEST_CASE("TypeHint Meta", "[DatMesh, Meta]") {
+    REQUIRE(getPrimitiveTypeHint(TypeHint::R16G16B16A16SFloat) == TypeHint::R8SFloat);
+    REQUIRE(getPrimitiveSize(TypeHint::R16G16SNorm) == 2);
+    REQUIRE(getComponentCount(TypeHint::R8G8B8UNorm) == 3);
+    REQUIRE(getTypeSize(TypeHint::R32G32B32A32SFloat) == 16);
+    REQUIRE(getTypeSize(TypeHint::R64G64SInt) == 16);
+}
+
+/* -------------------------------------------- */
+/*  Half Floats                                 */
+/* -------------------------------------------- */
+
+TEST_CASE("Half Floats", "[DatMesh, Conversion, Half]") {
+    SECTION("Known Values") {
+        REQUIRE(floatToHalf(0.f) == 0x0000);
+        REQUIRE(floatToHalf(-0.f) == 0x8000);
+        REQUIRE(floatToHalf(1.f) == 0x3C00);
+        REQUIRE(floatToHalf(-2.f) == 0xC000);
+        REQUIRE(floatToHalf(0.1f) == 0x2E66);
+        REQUIRE(floatToHalf(65504.f) == 0x7BFF);
+        REQUIRE(floatToHalf(0x1p-24f) == 0x0001);
+        REQUIRE(floatToHalf(0x1p-14f) == 0x0400);
+    }
+
+    SECTION("Rounding") {
+        // Ties round to even
+        REQUIRE(floatToHalf(1.f + 0x1p-11f) == 0x3C00);
+        REQUIRE(floatToHalf(1.f + 3 * 0x1p-11f) == 0x3C02);
+        REQUIRE(floatToHalf(0x1p-25f) == 0x0000);
+        REQUIRE(floatToHalf(3 * 0x1p-25f) == 0x0002);
+
+        // Anything that rounds past the largest half overflows to infinity
+        REQUIRE(floatToHalf(65519.f) == 0x7BFF);
+        REQUIRE(floatToHalf(65520.f) == 0x7C00);
+        REQUIRE(floatToHalf(1e10f) == 0x7C00);
+        REQUIRE(floatToHalf(-1e10f) == 0xFC00);
+    }
+
+    SECTION("Infinity and NaN") {
+        REQUIRE(floatToHalf(std::numeric_limits<float>::infinity()) == 0x7C00);
+        REQUIRE(halfToFloat(0xFC00) == -std::numeric_limits<float>::infinity());
+        REQUIRE(std::isnan(halfToFloat(floatToHalf(std::numeric_limits<float>::quiet_NaN()))));
+    }
+
+    SECTION("Round Trip") {
+        // Every half that isn't a NaN converts to a float and back unchanged
+        for (uint32_t half = 0; half <= 0xFFFF; ++half) {
+            if ((half & 0x7C00) == 0x7C00 && (half & 0x3FF) != 0) continue;
+            REQUIRE(floatToHalf(halfToFloat(static_cast<uint16_t>(half))) == half);
+        }
+    }
+}
+
+/* -------------------------------------------- */
+/*  Bulk Conversion                             */
+/* -------------------------------------------- */
+
+TEST_CASE("Bulk Float Conversion", "[DatMesh, Conversion]") {
+    SECTION("Half") {
+        // Sizes either side of the 8 wide F16C path
+        for (const size_t count : {1, 7, 8, 9, 23, 40}) {
+            const std::vector<float> components = makeComponents(count);
+            const std::vector<uint16_t> halves = encode<uint16_t>(TypeHint::R16SFloat, components);
+            for (size_t i = 0; i < count; ++i) {
+                REQUIRE(halves[i] == floatToHalf(components[i]));
+            }
+
+            const std::vector<float> decoded = roundTrip(TypeHint::R16SFloat, components);
+            for (size_t i = 0; i < count; ++i) {
+                REQUIRE(std::bit_cast<uint32_t>(decoded[i]) == std::bit_cast<uint32_t>(halfToFloat(halves[i])));
+            }
+        }
+    }
+
+    SECTION("Single and Double") {
+        const std::vector<float> components = {1.5f, -3.25f, 1e20f, 0.1f, -0.f, 7};
+        REQUIRE(roundTrip(TypeHint::R32G32B32SFloat, components) == components);
+        REQUIRE(roundTrip(TypeHint::R64G64SFloat, components) == components);
+    }
+
+    SECTION("Unsupported") {
+        std::vector<float> components(4);
+        std::vector<uint8_t> encoded(4);
+        REQUIRE(convertFromFloat(TypeHint::R8SFloat, components, encoded) == AssetIOResult::UNSUPPORTED_TYPE);
+        REQUIRE(convertToFloat(TypeHint::R8SFloat, encoded, components) == AssetIOResult::UNSUPPORTED_TYPE);
+    }
+}
+
+TEST_CASE("Bulk Normalised Conversion", "[DatMesh, Conversion]") {
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+
+    SECTION("UNorm") {
+        const std::vector<float> components = {0, 1, 0.5f, -1, 2, nan, 1.f / 255, 0.25f, 0.75f};
+        REQUIRE(encode<uint8_t>(TypeHint::R8UNorm, components) ==
+                std::vector<uint8_t>{0, 255, 128, 0, 255, 0, 1, 64, 191});
+        REQUIRE(encode<uint16_t>(TypeHint::R16UNorm, components)[1] == 65535);
+
+        const std::vector<float> decoded = roundTrip(TypeHint::R8UNorm, components);
+        REQUIRE(decoded[0] == 0);
+        REQUIRE(decoded[1] == 1);
+        REQUIRE(decoded[2] == Catch::Approx(128.f / 255));
+    }
+
+    SECTION("SNorm") {
+        const std::vector<float> components = {0, 1, -1, -2, 2, nan, 0.5f, -0.5f, 0.25f};
+        REQUIRE(encode<int8_t>(TypeHint::R8SNorm, components) ==
+                std::vector<int8_t>{0, 127, -127, -127, 127, 0, 64, -64, 32});
+
+        const std::vector<float> decoded = roundTrip(TypeHint::R16G16B16SNorm, components);
+        REQUIRE(decoded[1] == 1);
+        REQUIRE(decoded[2] == -1);
+
+        // The unused most negative value still decodes to -1
+        const std::vector<uint8_t> mostNegative(9, 0x80);
+        std::vector<float> out(9);
+        REQUIRE(convertToFloat(TypeHint::R8SNorm, mostNegative, out) == AssetIOResult::SUCCESS);
+        for (const float value : out) {
+            REQUIRE(value == -1);
+        }
+    }
+
+    SECTION("Accuracy") {
+        // Sizes either side of the 8 wide SSE path
+        for (const size_t count : {3, 12, 15, 24, 33}) {
+            std::vector<float> components(count);
+            for (size_t i = 0; i < count; ++i) {
+                components[i] = std::sin(static_cast<float>(i));
+            }
+
+            const std::vector<float> snorm8 = roundTrip(TypeHint::R8G8B8SNorm, components);
+            const std::vector<float> snorm16 = roundTrip(TypeHint::R16G16B16SNorm, components);
+            for (size_t i = 0; i < count; ++i) {
+                REQUIRE(std::abs(snorm8[i] - components[i]) <= 0.5f / 127 + 1e-6f);
+                REQUIRE(std::abs(snorm16[i] - components[i]) <= 0.5f / 32767 + 1e-6f);
+            }
+        }
+    }
+}
+
+TEST_CASE("Bulk Integer Conversion", "[DatMesh, Conversion]") {
+    SECTION("Saturation") {
+        const std::vector<float> components = {40000, -40000, 1.5f, 2.5f, -1.5f, 300, -300, 0.4f, 100};
+        REQUIRE(encode<int16_t>(TypeHint::R16SInt, components) ==
+                std::vector<int16_t>{32767, -32768, 2, 2, -2, 300, -300, 0, 100});
+        REQUIRE(encode<uint8_t>(TypeHint::R8UScaled, components) ==
+                std::vector<uint8_t>{255, 0, 2, 2, 0, 255, 0, 0, 100});
+        REQUIRE(encode<int8_t>(TypeHint::R8SInt, components) ==
+                std::vector<int8_t>{127, -128, 2, 2, -2, 127, -128, 0, 100});
+    }
+
+    SECTION("Round Trip") {
+        const std::vector<float> components = {0, 1, -1, 100, -100, 12345, -12345, 30000, 5, 6, 7, 8};
+        for (const TypeHint typeHint : {TypeHint::R16G16SInt, TypeHint::R32G32B32A32SInt, TypeHint::R64SInt}) {
+            REQUIRE(roundTrip(typeHint, components) == components);
+        }
+
+        const std::vector<float> unsignedComponents = {0, 1, 2, 100, 200, 255, 3, 4};
+        for (const TypeHint typeHint : {TypeHint::R8G8B8A8UInt, TypeHint::R16G16UScaled, TypeHint::R32UInt}) {
+            REQUIRE(roundTrip(typeHint, unsignedComponents) == unsignedComponents);
+        }
+    }
+
+    SECTION("Wide Limits") {
+        const std::vector<float> components = {1e30f, -1e30f};
+        REQUIRE(encode<uint32_t>(TypeHint::R32G32UInt, components) == std::vector<uint32_t>{4294967295u, 0});
+        REQUIRE(encode<int64_t>(TypeHint::R64G64SInt, components) ==
+                std::vector<int64_t>{std::numeric_limits<int64_t>::max(), std::numeric_limits<int64_t>::min()});
+        REQUIRE(encode<uint64_t>(TypeHint::R64G64UInt, components) ==
+                std::vector<uint64_t>{std::numeric_limits<uint64_t>::max(), 0});
+    }
+
+    SECTION("Matches Scalar") {
+        // Each SIMD kernel should give the same bits as the scalar tail, which handles the last element
+        const std::vector<float> components = makeComponents(23);
+        for (const TypeHint typeHint :
+             {TypeHint::R8UNorm, TypeHint::R8SNorm, TypeHint::R8UInt, TypeHint::R8SInt, TypeHint::R16UNorm,
+              TypeHint::R16SNorm, TypeHint::R16UInt, TypeHint::R16SInt}) {
+            const uint32_t size = getPrimitiveSize(typeHint);
+            std::vector<uint8_t> encoded(components.size() * size);
+            REQUIRE(convertFromFloat(typeHint, components, encoded) == AssetIOResult::SUCCESS);
+
+            std::vector<float> decoded(components.size());
+            REQUIRE(convertToFloat(typeHint, encoded, decoded) == AssetIOResult::SUCCESS);
+
+            for (size_t i = 0; i < components.size(); ++i) {
+                std::vector<uint8_t> single(size);
+                REQUIRE(convertFromFloat(typeHint, std::span(&components[i], 1), single) == AssetIOResult::SUCCESS);
+                REQUIRE(std::memcmp(single.data(), &encoded[i * size], size) == 0);
+
+                float singleDecoded;
+                REQUIRE(convertToFloat(typeHint, single, std::span(&singleDecoded, 1)) == AssetIOResult::SUCCESS);
+                REQUIRE(std::bit_cast<uint32_t>(singleDecoded) == std::bit_cast<uint32_t>(decoded[i]));
+            }
+        }
+    }
+}
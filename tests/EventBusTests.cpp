@@ -0,0 +1,558 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <event-bus/EventBus.h>
+#include <event-bus/EventRecorder.h>
+#include <event-bus/EventReplayer.h>
+#include <util/Delegate.h>
+
+using namespace DatEngine;
+using namespace DatEngine::Events;
+
+namespace {
+    struct DamageEvent : Event {
+        int amount = 0;
+    };
+
+    struct HealEvent : Event {
+        int amount = 0;
+    };
+
+    struct CriticalDamageEvent : DamageEvent {};
+
+    struct InteractEvent : CancellableEvent {
+        int interactions = 0;
+    };
+
+    struct SequenceEvent : Event {
+        int thread = 0;
+        int sequence = 0;
+    };
+
+    int addOne(const int value) { return value + 1; }
+
+    DamageEvent makeDamage(const int amount) {
+        DamageEvent event;
+        event.amount = amount;
+        return event;
+    }
+
+    HealEvent makeHeal(const int amount) {
+        HealEvent event;
+        event.amount = amount;
+        return event;
+    }
+
+    SequenceEvent makeSequence(const int thread, const int sequence) {
+        SequenceEvent event;
+        event.thread = thread;
+        event.sequence = sequence;
+        return event;
+    }
+} // namespace
+
+TEST_CASE("Delegate", "[Util, Delegate]") {
+    SECTION("Function Pointer") {
+        const Delegate<int(int)> delegate = &addOne;
+
+        REQUIRE(delegate);
+        REQUIRE(delegate(1) == 2);
+    }
+
+    SECTION("Empty") {
+        Delegate<int(int)> delegate;
+        REQUIRE_FALSE(delegate);
+
+        delegate = [](const int value) { return value * 2; };
+        REQUIRE(delegate(4) == 8);
+
+        delegate.reset();
+        REQUIRE_FALSE(delegate);
+    }
+
+    SECTION("Copies Captured State") {
+        int calls = 0;
+        Delegate<void()> delegate = [&calls, step = 2] { calls += step; };
+        const Delegate<void()> copy = delegate;
+
+        delegate();
+        copy();
+        REQUIRE(calls == 4);
+    }
+
+    SECTION("Non Trivial Callables") {
+        const auto shared = std::make_shared<int>(5);
+        Delegate<int()> delegate = [shared] { return *shared; };
+        REQUIRE(shared.use_count() == 2);
+
+        Delegate<int()> copy = delegate;
+        REQUIRE(shared.use_count() == 3);
+
+        Delegate<int()> moved = std::move(delegate);
+        REQUIRE(shared.use_count() == 3);
+        REQUIRE(moved() == 5);
+        REQUIRE_FALSE(delegate);
+
+        copy.reset();
+        moved = Delegate<int()>();
+        REQUIRE(shared.use_count() == 1);
+    }
+
+    SECTION("Survives Reallocation") {
+        std::vector<Delegate<std::string()>> delegates;
+        for (int i = 0; i < 100; ++i) {
+            delegates.emplace_back([text = std::make_shared<std::string>(std::to_string(i))] { return *text; });
+        }
+
+        for (int i = 0; i < 100; ++i) {
+            REQUIRE(delegates[i]() == std::to_string(i));
+        }
+    }
+}
+
+TEST_CASE("EventBus Dispatch", "[Events, EventBus]") {
+    EventBus bus;
+
+    SECTION("Calls Listeners By Priority") {
+        std::vector<int> order;
+        bus.addListener<DamageEvent>([&order](const DamageEvent*) { order.push_back(2); });
+        bus.addListener<DamageEvent>([&order](const DamageEvent*) { order.push_back(4); }, ListenerPriority::Lowest);
+        bus.addListener<DamageEvent>([&order](const DamageEvent*) { order.push_back(0); }, ListenerPriority::Highest);
+        bus.addListener<DamageEvent>([&order](const DamageEvent*) { order.push_back(3); }, ListenerPriority::Low);
+        bus.addListener<DamageEvent>([&order](const DamageEvent*) { order.push_back(1); }, ListenerPriority::High);
+
+        DamageEvent event;
+        bus.callEvent(&event);
+
+        REQUIRE(order == std::vector{0, 1, 2, 3, 4});
+        REQUIRE(bus.getListenerCount<DamageEvent>() == 5);
+    }
+
+    SECTION("Listeners Can Modify The Event") {
+        bus.addListener<DamageEvent>([](DamageEvent* event) { event->amount *= 2; });
+        bus.addListener<DamageEvent>([](DamageEvent* event) { event->amount += 1; });
+
+        DamageEvent event;
+        event.amount = 10;
+        bus.callEvent(&event);
+
+        REQUIRE(event.amount == 21);
+    }
+
+    SECTION("Only Calls Listeners For The Exact Type") {
+        int damage = 0;
+        int heal = 0;
+        bus.addListener<DamageEvent>([&damage](const DamageEvent* event) { damage += event->amount; });
+        bus.addListener<HealEvent>([&heal](const HealEvent* event) { heal += event->amount; });
+
+        HealEvent healEvent;
+        healEvent.amount = 3;
+        bus.callEvent(&healEvent);
+
+        CriticalDamageEvent critical;
+        critical.amount = 100;
+        bus.callEvent(&critical);
+
+        REQUIRE(damage == 0);
+        REQUIRE(heal == 3);
+    }
+
+    SECTION("No Listeners") {
+        DamageEvent event;
+        bus.callEvent(&event);
+
+        REQUIRE(bus.getListenerCount<HealEvent>() == 0);
+    }
+
+    SECTION("Adding Listeners While Dispatching") {
+        int calls = 0;
+        bus.addListener<DamageEvent>([&](const DamageEvent*) {
+            ++calls;
+            bus.addListener<DamageEvent>([&calls](const DamageEvent*) { ++calls; });
+            bus.addListener<HealEvent>([](const HealEvent*) {});
+        });
+
+        DamageEvent event;
+        bus.callEvent(&event);
+        REQUIRE(calls == 1);
+
+        bus.callEvent(&event);
+        REQUIRE(calls == 3);
+    }
+
+    SECTION("Throwing Listeners") {
+        int calls = 0;
+        bus.addListener<DamageEvent>([&](const DamageEvent*) {
+            bus.addListener<HealEvent>([&calls](const HealEvent*) { ++calls; });
+            throw std::runtime_error("listener failed");
+        });
+
+        DamageEvent event;
+        REQUIRE_THROWS_AS(bus.callEvent(&event), std::runtime_error);
+
+        // The dispatch still ended, so the deferred listener was added and later changes aren't deferred
+        REQUIRE(bus.getListenerCount<HealEvent>() == 1);
+        bus.addListener<HealEvent>([&calls](const HealEvent*) { ++calls; });
+        HealEvent heal;
+        bus.callEvent(&heal);
+        REQUIRE(calls == 2);
+    }
+}
+
+TEST_CASE("EventBus Listener Handles", "[Events, EventBus]") {
+    EventBus bus;
+
+    SECTION("Remove") {
+        int calls = 0;
+        const ListenerHandle first = bus.addListener<DamageEvent>([&calls](const DamageEvent*) { calls += 1; });
+        const ListenerHandle second = bus.addListener<DamageEvent>([&calls](const DamageEvent*) { calls += 10; });
+        REQUIRE(bus.isListening(first));
+
+        REQUIRE(bus.removeListener(first));
+        REQUIRE_FALSE(bus.isListening(first));
+        REQUIRE(bus.isListening(second));
+        REQUIRE(bus.getListenerCount<DamageEvent>() == 1);
+
+        DamageEvent event;
+        bus.callEvent(&event);
+        REQUIRE(calls == 10);
+    }
+
+    SECTION("Stale Handles") {
+        const ListenerHandle handle = bus.addListener<DamageEvent>([](const DamageEvent*) {});
+        REQUIRE(bus.removeListener(handle));
+        REQUIRE_FALSE(bus.removeListener(handle));
+        REQUIRE_FALSE(bus.removeListener(ListenerHandle{}));
+
+        // The new listener reuses the slot, but the old handle can't remove it
+        const ListenerHandle reused = bus.addListener<DamageEvent>([](const DamageEvent*) {});
+        REQUIRE(reused.index == handle.index);
+        REQUIRE_FALSE(bus.removeListener(handle));
+        REQUIRE(bus.isListening(reused));
+    }
+
+    SECTION("Keeps Priority Order Through Churn") {
+        // Add and remove listeners in every band, checking the bands are still called in order after each removal
+        std::vector<ListenerHandle> handles;
+        std::vector<int> priorities;
+        for (int i = 0; i < 200; ++i) {
+            const int priority = (i * 7) % static_cast<int>(listenerPriorityCount);
+            handles.push_back(bus.addListener<DamageEvent>(
+                    [&priorities, priority](const DamageEvent*) { priorities.push_back(priority); },
+                    static_cast<ListenerPriority>(priority)
+            ));
+        }
+
+        for (size_t i = 0; i < handles.size(); i += 3) {
+            REQUIRE(bus.removeListener(handles[i]));
+
+            priorities.clear();
+            DamageEvent event;
+            bus.callEvent(&event);
+            REQUIRE(std::ranges::is_sorted(priorities));
+        }
+        REQUIRE(bus.getListenerCount<DamageEvent>() == 133);
+        REQUIRE(priorities.size() == 133);
+    }
+
+    SECTION("Remove While Dispatching") {
+        int calls = 0;
+        ListenerHandle other;
+        const ListenerHandle self = bus.addListener<DamageEvent>(
+                [&](const DamageEvent*) {
+                    ++calls;
+                    bus.removeListener(other);
+                },
+                ListenerPriority::High
+        );
+        other = bus.addListener<DamageEvent>([&calls](const DamageEvent*) { calls += 10; });
+
+        DamageEvent event;
+        bus.callEvent(&event);
+        REQUIRE_FALSE(bus.isListening(other));
+        REQUIRE(bus.getListenerCount<DamageEvent>() == 1);
+
+        calls = 0;
+        bus.callEvent(&event);
+        REQUIRE(calls == 1);
+        REQUIRE(bus.removeListener(self));
+    }
+
+    SECTION("Add And Remove While Dispatching") {
+        int calls = 0;
+        bus.addListener<DamageEvent>([&](const DamageEvent*) {
+            const ListenerHandle added = bus.addListener<DamageEvent>([&calls](const DamageEvent*) { ++calls; });
+            REQUIRE(bus.isListening(added));
+            REQUIRE(bus.removeListener(added));
+        });
+
+        DamageEvent event;
+        bus.callEvent(&event);
+        bus.callEvent(&event);
+
+        REQUIRE(calls == 0);
+        REQUIRE(bus.getListenerCount<DamageEvent>() == 1);
+    }
+
+    SECTION("Cancelled Events Stop") {
+        bus.addListener<InteractEvent>([](InteractEvent* event) { ++event->interactions; }, ListenerPriority::High);
+        bus.addListener<InteractEvent>([](InteractEvent* event) {
+            ++event->interactions;
+            event->cancelEvent();
+        });
+        bus.addListener<InteractEvent>([](InteractEvent* event) { ++event->interactions; }, ListenerPriority::Low);
+
+        InteractEvent event;
+        bus.callEvent(&event);
+        REQUIRE(event.isCancelled());
+        REQUIRE(event.interactions == 2);
+
+        int queuedInteractions = 0;
+        bus.addListener<InteractEvent>(
+                [&queuedInteractions](const InteractEvent* queued) { queuedInteractions += queued->interactions; },
+                ListenerPriority::Lowest
+        );
+        bus.queueEvent(InteractEvent{});
+        bus.dispatchQueuedEvents();
+        REQUIRE(queuedInteractions == 0);
+    }
+}
+
+TEST_CASE("EventBus Queued Events", "[Events, EventBus, Threading]") {
+    EventBus bus;
+
+    SECTION("Dispatched On Tick") {
+        int damage = 0;
+        bus.addListener<DamageEvent>([&damage](const DamageEvent* event) { damage += event->amount; });
+
+        DamageEvent event;
+        event.amount = 5;
+        bus.queueEvent(event);
+        event.amount = 7;
+        bus.queueEvent(event);
+        REQUIRE(damage == 0);
+
+        bus.tick(0);
+        REQUIRE(damage == 12);
+
+        bus.tick(0);
+        REQUIRE(damage == 12);
+    }
+
+    SECTION("Grouped By Type") {
+        std::vector<int> order;
+        bus.addListener<DamageEvent>([&order](const DamageEvent* event) { order.push_back(event->amount); });
+        bus.addListener<HealEvent>([&order](const HealEvent* event) { order.push_back(event->amount); });
+
+        for (int i = 0; i < 3; ++i) {
+            bus.queueEvent(makeDamage(i));
+            bus.queueEvent(makeHeal(10 + i));
+        }
+        bus.dispatchQueuedEvents();
+
+        // Each type's events stay in order, and no type's events are interleaved with another's
+        REQUIRE(order.size() == 6);
+        const bool damageFirst = order[0] == 0;
+        REQUIRE(order == (damageFirst ? std::vector{0, 1, 2, 10, 11, 12} : std::vector{10, 11, 12, 0, 1, 2}));
+    }
+
+    SECTION("Events Queued By Listeners Wait For The Next Dispatch") {
+        int calls = 0;
+        bus.addListener<DamageEvent>([&](const DamageEvent* event) {
+            ++calls;
+            if (event->amount > 0) bus.queueEvent(makeDamage(event->amount - 1));
+        });
+
+        bus.queueEvent(makeDamage(2));
+        bus.dispatchQueuedEvents();
+        REQUIRE(calls == 1);
+
+        bus.dispatchQueuedEvents();
+        bus.dispatchQueuedEvents();
+        REQUIRE(calls == 3);
+
+        bus.dispatchQueuedEvents();
+        REQUIRE(calls == 3);
+    }
+
+    SECTION("Throwing Listeners") {
+        int calls = 0;
+        bus.addListener<DamageEvent>([&](const DamageEvent* event) {
+            ++calls;
+            if (event->amount == 0) throw std::runtime_error("listener failed");
+        });
+
+        bus.queueEvent(makeDamage(0));
+        bus.queueEvent(makeDamage(1));
+        REQUIRE_THROWS_AS(bus.dispatchQueuedEvents(), std::runtime_error);
+        REQUIRE(calls == 1);
+
+        // The rest of the failed dispatch is dropped rather than called again, and the bus keeps working
+        bus.dispatchQueuedEvents();
+        REQUIRE(calls == 1);
+
+        bus.addListener<HealEvent>([&calls](const HealEvent*) { calls += 10; });
+        REQUIRE(bus.getListenerCount<HealEvent>() == 1);
+        for (int i = 0; i < 3; ++i) bus.queueEvent(makeHeal(i));
+        bus.dispatchQueuedEvents();
+        REQUIRE(calls == 31);
+    }
+
+    SECTION("Many Threads") {
+        constexpr int threadCount = 4;
+        // Enough events to fill several of each thread's blocks
+        constexpr int eventsPerThread = 5000;
+
+        std::vector<int> nextSequence(threadCount, 0);
+        bool ordered = true;
+        bus.addListener<SequenceEvent>([&](const SequenceEvent* event) {
+            ordered &= event->sequence == nextSequence[event->thread]++;
+        });
+
+        std::vector<std::thread> threads;
+        for (int thread = 0; thread < threadCount; ++thread) {
+            threads.emplace_back([&bus, thread] {
+                for (int i = 0; i < eventsPerThread; ++i) bus.queueEvent(makeSequence(thread, i));
+            });
+        }
+
+        // Dispatch while the threads are still queueing, to exercise collecting partially written blocks
+        for (int i = 0; i < 100; ++i) bus.tick(0);
+        for (std::thread& thread : threads) thread.join();
+        bus.tick(0);
+
+        REQUIRE(ordered);
+        for (int thread = 0; thread < threadCount; ++thread) {
+            REQUIRE(nextSequence[thread] == eventsPerThread);
+        }
+    }
+}
+
+TEST_CASE("EventBus Type Hashes", "[Events, EventBus, Replay]") {
+    STATIC_REQUIRE(detail::eventTypeHash<DamageEvent> == detail::eventTypeHash<DamageEvent>);
+    STATIC_REQUIRE(detail::eventTypeHash<DamageEvent> != detail::eventTypeHash<CriticalDamageEvent>);
+    STATIC_REQUIRE(detail::eventTypeHash<DamageEvent> != detail::eventTypeHash<HealEvent>);
+    STATIC_REQUIRE(detail::eventTypeHash<HealEvent> != detail::eventTypeHash<InteractEvent>);
+}
+
+TEST_CASE("EventBus Recording", "[Events, EventBus, Replay]") {
+    EventRecorder recorder;
+
+    // Record a few frames of called and queued events, with listeners that modify them
+    {
+        EventBus bus;
+        bus.addListener<DamageEvent>([](DamageEvent* event) { event->amount = -1; });
+        bus.setRecorder(&recorder);
+
+        DamageEvent damage = makeDamage(5);
+        bus.callEvent(&damage);
+        bus.queueEvent(makeHeal(3));
+        bus.tick(0);
+
+        bus.tick(0);
+
+        bus.queueEvent(makeDamage(7));
+        InteractEvent interact;
+        bus.callEvent(&interact);
+        bus.tick(0);
+
+        bus.setRecorder(nullptr);
+        damage = makeDamage(100);
+        bus.callEvent(&damage);
+    }
+
+    SECTION("Log Layout") {
+        // Frame 0 has two events, frame 1 none and frame 2 two, so there are two frame markers
+        const size_t expected = EventLog::headerSize + 2 * EventLog::frameMarkerSize + 4 * EventLog::eventHeaderSize +
+                                2 * sizeof(DamageEvent) + sizeof(HealEvent) + sizeof(InteractEvent);
+        REQUIRE(recorder.getLog().size() == expected);
+    }
+
+    SECTION("Replay") {
+        EventBus bus;
+        std::vector<std::pair<uint64_t, int>> damage;
+        std::vector<int> heal;
+        int interactions = 0;
+        EventReplayer* current = nullptr;
+        bus.addListener<DamageEvent>([&](const DamageEvent* event) {
+            damage.emplace_back(current->getFrame(), event->amount);
+        });
+        bus.addListener<HealEvent>([&heal](const HealEvent* event) { heal.push_back(event->amount); });
+        bus.addListener<InteractEvent>([&interactions](const InteractEvent*) { ++interactions; });
+
+        std::optional<EventReplayer> replayer = EventReplayer::fromLog(recorder.getLog());
+        REQUIRE(replayer.has_value());
+        current = &*replayer;
+
+        REQUIRE(replayer->replayFrame(bus) == 2);
+        REQUIRE(replayer->getFrame() == 0);
+        REQUIRE(replayer->replayFrame(bus) == 2);
+        REQUIRE(replayer->getFrame() == 2);
+        REQUIRE(replayer->isFinished());
+        REQUIRE(replayer->replayFrame(bus) == 0);
+
+        // Events are recorded before the recording bus's listeners modified them
+        REQUIRE(damage == std::vector<std::pair<uint64_t, int>>{{0, 5}, {2, 7}});
+        REQUIRE(heal == std::vector{3});
+        REQUIRE(interactions == 1);
+
+        replayer->rewind();
+        REQUIRE(replayer->replayAll(bus) == 4);
+        REQUIRE(damage.size() == 4);
+    }
+
+    SECTION("Rerecording A Replay Matches") {
+        EventBus bus;
+        bus.addListener<DamageEvent>([](const DamageEvent*) {});
+        bus.addListener<HealEvent>([](const HealEvent*) {});
+        bus.addListener<InteractEvent>([](const InteractEvent*) {});
+
+        EventRecorder rerecorder;
+        bus.setRecorder(&rerecorder);
+
+        std::optional<EventReplayer> replayer = EventReplayer::fromLog(recorder.getLog());
+        REQUIRE(replayer.has_value());
+        while (!replayer->isFinished()) {
+            // Keep the bus in step with the log, so the events are recorded against the same frames
+            while (bus.getFrameNumber() < replayer->getNextFrame()) bus.tick(0);
+            replayer->replayFrame(bus);
+        }
+
+        REQUIRE(std::ranges::equal(rerecorder.getLog(), recorder.getLog()));
+    }
+
+    SECTION("Save And Load") {
+        const std::filesystem::path path = std::filesystem::temp_directory_path() / "dat-engine-event-log.bin";
+        REQUIRE(recorder.save(path));
+
+        std::optional<EventReplayer> replayer = EventReplayer::load(path);
+        std::filesystem::remove(path);
+        REQUIRE(replayer.has_value());
+
+        EventBus bus;
+        int heal = 0;
+        bus.addListener<HealEvent>([&heal](const HealEvent* event) { heal += event->amount; });
+        REQUIRE(replayer->replayAll(bus) == 4);
+        REQUIRE(heal == 3);
+    }
+
+    SECTION("Invalid Logs") {
+        const std::span<const std::byte> log = recorder.getLog();
+        REQUIRE_FALSE(EventReplayer::fromLog({}).has_value());
+        REQUIRE_FALSE(EventReplayer::fromLog(log.first(log.size() - 1)).has_value());
+        REQUIRE_FALSE(EventReplayer::fromLog(log.subspan(1)).has_value());
+        REQUIRE_FALSE(EventReplayer::load(std::filesystem::temp_directory_path() / "dat-engine-missing.bin"));
+
+        // A log with no events is valid, and replays nothing
+        REQUIRE(EventReplayer::fromLog(EventRecorder().getLog()).has_value());
+        REQUIRE(EventReplayer::fromLog(EventRecorder().getLog())->isFinished());
+    }
+}
@@ -0,0 +1,172 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include <gpu/NullGpu.h>
+#include <threading/FrameGraph.h>
+#include <threading/ThreadManager.h>
+
+using namespace DatEngine;
+using namespace DatEngine::Threading;
+
+TEST_CASE("FrameGraph Ordering", "[Threading, FrameGraph]") {
+    constexpr uint64_t frameCount = 200;
+
+    ThreadManager threads(4);
+    threads.init();
+    FrameGraph graph(threads, 3);
+
+    std::atomic<uint64_t> inputs = 0;
+    std::atomic<uint64_t> updates = 0;
+    std::atomic<uint64_t> renders = 0;
+    std::atomic<bool> outOfOrder = false;
+
+    const FrameGraph::TaskId input = graph.addTask("Input", [&](const FrameContext& context) {
+        if (inputs.fetch_add(1) != context.frame) outOfOrder = true;
+    });
+    const FrameGraph::TaskId update = graph.addTask(
+            "Update",
+            [&](const FrameContext& context) {
+                if (inputs.load() <= context.frame || updates.fetch_add(1) != context.frame) outOfOrder = true;
+            },
+            {input}
+    );
+    graph.addTask(
+            "Render",
+            [&](const FrameContext& context) {
+                if (updates.load() <= context.frame || renders.fetch_add(1) != context.frame) outOfOrder = true;
+            },
+            {input, update}
+    );
+
+    REQUIRE(graph.getTaskName(update) == "Update");
+
+    for (uint64_t frame = 0; frame < frameCount; ++frame) graph.beginFrame(0.016f);
+    graph.waitForAll();
+
+    REQUIRE(graph.getFrameCount() == frameCount);
+    REQUIRE_FALSE(outOfOrder);
+    REQUIRE(renders == frameCount);
+}
+
+TEST_CASE("FrameGraph Pipelining", "[Threading, FrameGraph]") {
+    ThreadManager threads(4);
+    threads.init();
+
+    SECTION("Update overlaps the previous render") {
+        FrameGraph graph(threads, 2);
+        std::atomic<bool> nextUpdateRan = false;
+        std::atomic<bool> overlapped = false;
+
+        const FrameGraph::TaskId update = graph.addTask("Update", [&](const FrameContext& context) {
+            if (context.frame == 1) nextUpdateRan = true;
+        });
+        graph.addTask(
+                "Render",
+                [&](const FrameContext& context) {
+                    if (context.frame != 0) return;
+
+                    // Give up eventually, so a broken graph fails the test instead of hanging it
+                    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+                    while (!nextUpdateRan && std::chrono::steady_clock::now() < deadline) std::this_thread::yield();
+                    overlapped = nextUpdateRan.load();
+                },
+                {update}
+        );
+
+        graph.beginFrame(0);
+        graph.beginFrame(0);
+        graph.waitForAll();
+
+        REQUIRE(overlapped);
+    }
+
+    SECTION("Frames in flight are capped") {
+        constexpr uint32_t maxFramesInFlight = 2;
+        FrameGraph graph(threads, maxFramesInFlight);
+        std::atomic<uint64_t> rendered = 0;
+        std::atomic<bool> tooManyInFlight = false;
+
+        const FrameGraph::TaskId update = graph.addTask("Update", [&](const FrameContext& context) {
+            // Frame N can't begin until frame N - maxFramesInFlight has finished
+            if (context.frame >= maxFramesInFlight && rendered.load() <= context.frame - maxFramesInFlight) {
+                tooManyInFlight = true;
+            }
+        });
+        graph.addTask(
+                "Render",
+                [&](const FrameContext&) {
+                    std::this_thread::sleep_for(std::chrono::microseconds(100));
+                    ++rendered;
+                },
+                {update}
+        );
+
+        for (int frame = 0; frame < 50; ++frame) graph.beginFrame(0);
+        graph.waitForAll();
+
+        REQUIRE_FALSE(tooManyInFlight);
+        REQUIRE(rendered == 50);
+    }
+
+    SECTION("Tasks never overlap themselves") {
+        FrameGraph graph(threads, 4);
+        std::atomic<int> running = 0;
+        std::atomic<bool> overlapped = false;
+
+        graph.addTask("Update", [&](const FrameContext&) {
+            if (running.fetch_add(1) != 0) overlapped = true;
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+            running.fetch_sub(1);
+        });
+
+        for (int frame = 0; frame < 50; ++frame) graph.beginFrame(0);
+        graph.waitForAll();
+
+        REQUIRE_FALSE(overlapped);
+    }
+
+    SECTION("Previous frame dependencies") {
+        FrameGraph graph(threads, 3);
+        std::atomic<uint64_t> rendered = 0;
+        std::atomic<bool> ranEarly = false;
+
+        // Update writes state that render reads, so it has to wait for the previous frame's render
+        const FrameGraph::TaskId extract = graph.addTask("Extract", [](const FrameContext&) {});
+        const FrameGraph::TaskId render = graph.addTask("Render", [&](const FrameContext&) { ++rendered; }, {extract});
+        graph.addTask(
+                "Update",
+                [&](const FrameContext& context) {
+                    if (rendered.load() < context.frame) ranEarly = true;
+                },
+                {},
+                {render}
+        );
+
+        for (int frame = 0; frame < 50; ++frame) graph.beginFrame(0);
+        graph.waitForAll();
+
+        REQUIRE_FALSE(ranEarly);
+    }
+}
+
+TEST_CASE("FrameGraph Null Renderer", "[Threading, FrameGraph]") {
+    ThreadManager threads(2);
+    threads.init();
+
+    DatGpu::NullGpu gpu;
+    FrameGraph graph(threads, 2);
+
+    float totalDelta = 0;
+    const FrameGraph::TaskId update =
+            graph.addTask("Update", [&](const FrameContext& context) { totalDelta += context.delta; });
+    graph.addTask("Render", [&gpu](const FrameContext&) { gpu.draw(); }, {update});
+
+    for (int frame = 0; frame < 100; ++frame) graph.beginFrame(0.5f);
+    graph.waitForAll();
+
+    REQUIRE(gpu.getFramesDrawn() == 100);
+    REQUIRE(totalDelta == 50);
+}
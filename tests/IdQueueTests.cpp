@@ -0,0 +1,311 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <container/ConcurrentIdQueue.h>
+#include <container/IdArray.h>
+#include <maths/Vector.h>
+
+using namespace DatEngine;
+
+TEST_CASE("IdQueue Insert", "[Container, IdQueue, Insertion]") {
+    IdQueue<DatMaths::vec3> queue;
+
+    SECTION("Push Back") {
+        const IdHandle id = queue.pushBack({0, 2, 3});
+
+        REQUIRE(queue.contains(id));
+        REQUIRE(queue.size() == 1);
+        REQUIRE(queue.get(id) == DatMaths::vec3{0, 2, 3});
+    }
+
+    SECTION("Emplace Back") {
+        const IdHandle id = queue.emplaceBack(1, 2, 3);
+
+        REQUIRE(queue.contains(id));
+        REQUIRE(queue[id] == DatMaths::vec3{1, 2, 3});
+    }
+
+    SECTION("Null Handle") {
+        REQUIRE(IdHandle{}.isNull());
+        REQUIRE_FALSE(queue.contains(IdHandle{}));
+        REQUIRE(queue.tryGet(IdHandle{}) == nullptr);
+    }
+}
+
+TEST_CASE("IdQueue Stale Handles", "[Container, IdQueue, Removal]") {
+    IdQueue<int> queue;
+    const IdHandle first = queue.pushBack(10);
+    const IdHandle second = queue.pushBack(20);
+
+    REQUIRE(queue.remove(first));
+    REQUIRE(queue.size() == 1);
+
+    SECTION("Removed handles are rejected") {
+        REQUIRE_FALSE(queue.contains(first));
+        REQUIRE(queue.tryGet(first) == nullptr);
+        REQUIRE_FALSE(queue.remove(first));
+        REQUIRE(queue.size() == 1);
+    }
+
+    SECTION("Reused slots get a new generation") {
+        const IdHandle reused = queue.pushBack(30);
+
+        REQUIRE(reused.index == first.index);
+        REQUIRE(reused.generation != first.generation);
+        REQUIRE_FALSE(queue.contains(first));
+        REQUIRE(queue.get(reused) == 30);
+        REQUIRE(queue.get(second) == 20);
+
+        // Removing the stale handle must not touch the value that reused the slot
+        REQUIRE_FALSE(queue.remove(first));
+        REQUIRE(*queue.tryGet(reused) == 30);
+    }
+}
+
+TEST_CASE("IdQueue Pack", "[Container, IdQueue]") {
+    IdQueue<int> queue;
+    IdHandle ids[4];
+    for (int i = 0; i < 4; ++i) ids[i] = queue.pushBack(i);
+
+    queue.remove(ids[1]);
+    queue.remove(ids[2]);
+    queue.remove(ids[3]);
+    queue.pack();
+
+    REQUIRE(queue.size() == 1);
+    REQUIRE(queue.get(ids[0]) == 0);
+
+    // Slots chopped off by pack must not bring their old handles back to life
+    const IdHandle a = queue.pushBack(5);
+    const IdHandle b = queue.pushBack(6);
+    const IdHandle c = queue.pushBack(7);
+    REQUIRE(a.index == 1);
+    REQUIRE(c.index == 3);
+    for (int i = 1; i < 4; ++i) REQUIRE_FALSE(queue.contains(ids[i]));
+
+    // Gaps below the end are kept and reused lowest first
+    queue.remove(a);
+    queue.remove(b);
+    queue.pack();
+    REQUIRE(queue.pushBack(8).index == 1);
+    REQUIRE(queue.get(c) == 7);
+}
+
+TEST_CASE("IdQueue Iteration", "[Container, IdQueue]") {
+    IdQueue<int> queue;
+    std::vector<IdHandle> ids;
+    for (int i = 0; i < 200; ++i) ids.push_back(queue.pushBack(i));
+
+    // Leave a single live value in the middle word, and free runs either side of it
+    for (int i = 0; i < 200; ++i) {
+        if (i % 3 != 0 || (i > 64 && i < 128 && i != 100)) queue.remove(ids[i]);
+    }
+
+    std::vector<int> expected;
+    for (int i = 0; i < 200; ++i) {
+        if (queue.contains(ids[i])) expected.push_back(i);
+    }
+
+    SECTION("Values are visited in ID order") {
+        std::vector<int> visited;
+        queue.each([&](const IdHandle id, int& value) {
+            REQUIRE(id == ids[value]);
+            visited.push_back(value);
+        });
+        REQUIRE(visited == expected);
+    }
+
+    SECTION("Const iteration") {
+        const IdQueue<int>& constQueue = queue;
+        size_t visited = 0;
+        constQueue.each([&](const int&) { ++visited; });
+        REQUIRE(visited == queue.size());
+    }
+
+    SECTION("Pack keeps values across bitset words") {
+        queue.remove(ids[198]);
+        queue.pack();
+
+        std::vector<int> visited;
+        queue.each([&](const int& value) { visited.push_back(value); });
+        expected.pop_back();
+        REQUIRE(visited == expected);
+        REQUIRE(queue.pushBack(-1).index == 1);
+    }
+}
+
+TEST_CASE("IdQueue Copy", "[Container, IdQueue]") {
+    IdQueue<std::string> queue;
+    const IdHandle a = queue.pushBack("a long string that won't fit in the small string buffer");
+    const IdHandle b = queue.pushBack("b");
+    queue.remove(a);
+
+    IdQueue<std::string> copy = queue;
+    IdQueue<std::string> moved = std::move(queue);
+
+    REQUIRE(copy.get(b) == "b");
+    REQUIRE(moved.get(b) == "b");
+    REQUIRE_FALSE(copy.contains(a));
+
+    copy.get(b) = "c";
+    REQUIRE(moved.get(b) == "b");
+    REQUIRE(queue.size() == 0);
+
+    // Grow past the first allocation so the values are relocated
+    for (int i = 0; i < 100; ++i) copy.pushBack(std::to_string(i));
+    REQUIRE(copy.get(b) == "c");
+}
+
+namespace {
+    /** A value whose constructor throws when asked to */
+    struct ThrowingValue {
+        int value;
+
+        explicit ThrowingValue(const int value, const bool shouldThrow = false) : value(value) {
+            if (shouldThrow) throw std::runtime_error("ThrowingValue");
+        }
+    };
+} // namespace
+
+TEST_CASE("IdQueue Exception Safety", "[Container, IdQueue, Insertion]") {
+    IdQueue<ThrowingValue> queue;
+    const IdHandle a = queue.emplaceBack(1);
+    const IdHandle b = queue.emplaceBack(2);
+
+    SECTION("A throw into a new slot commits nothing") {
+        REQUIRE_THROWS(queue.emplaceBack(3, true));
+        REQUIRE(queue.size() == 2);
+
+        const IdHandle c = queue.emplaceBack(3);
+        REQUIRE(c.index == 2);
+        REQUIRE(queue.get(c).value == 3);
+    }
+
+    SECTION("A throw into a reused slot keeps it free") {
+        queue.remove(a);
+        REQUIRE_THROWS(queue.emplaceBack(3, true));
+        REQUIRE(queue.size() == 1);
+
+        const IdHandle c = queue.emplaceBack(3);
+        REQUIRE(c.index == a.index);
+        REQUIRE(queue.get(c).value == 3);
+        REQUIRE(queue.get(b).value == 2);
+    }
+}
+
+TEST_CASE("IdQueue Emplace From Element", "[Container, IdQueue, Insertion]") {
+    IdQueue<std::string> queue;
+    const IdHandle first = queue.pushBack("a long string that won't fit in the small string buffer");
+
+    // Every insert copies an existing value, including the ones that grow and relocate the values buffer
+    for (int i = 0; i < 200; ++i) {
+        const IdHandle id = queue.emplaceBack(queue[first]);
+        REQUIRE(queue.get(id) == queue.get(first));
+    }
+}
+
+TEST_CASE("ConcurrentIdQueue Stale Handles", "[Container, IdQueue, Concurrent]") {
+    ConcurrentIdQueue<std::string, 16> queue;
+    const IdHandle first = queue.pushBack("first");
+    const IdHandle second = queue.emplaceBack(3, 'b');
+
+    REQUIRE(queue.get(second) == "bbb");
+    REQUIRE_FALSE(queue.contains(IdHandle{}));
+    REQUIRE_FALSE(queue.contains(IdHandle{first.index + 100, first.generation}));
+
+    REQUIRE(queue.remove(first));
+    REQUIRE_FALSE(queue.remove(first));
+    REQUIRE(queue.tryGet(first) == nullptr);
+
+    const IdHandle reused = queue.pushBack("reused");
+    REQUIRE(reused.index == first.index);
+    REQUIRE_FALSE(queue.contains(first));
+    REQUIRE(queue.get(reused) == "reused");
+    REQUIRE(queue.size() == 2);
+}
+
+TEST_CASE("ConcurrentIdQueue Stable References", "[Container, IdQueue, Concurrent]") {
+    ConcurrentIdQueue<int, 16> queue;
+    const IdHandle id = queue.pushBack(42);
+    const int* value = &queue.get(id);
+
+    // Filling several chunks must not move the first value
+    for (int i = 0; i < 100; ++i) queue.pushBack(i);
+    REQUIRE(&queue.get(id) == value);
+    REQUIRE(*value == 42);
+}
+
+TEST_CASE("ConcurrentIdQueue Full", "[Container, IdQueue, Concurrent]") {
+    ConcurrentIdQueue<int, 4, 2> queue;
+    IdHandle ids[8];
+    for (int i = 0; i < 8; ++i) ids[i] = queue.pushBack(i);
+
+    // Once every chunk is full inserting fails rather than indexing past the chunk table
+    REQUIRE(queue.pushBack(8).isNull());
+    REQUIRE(queue.emplaceBack(9).isNull());
+    REQUIRE(queue.size() == 8);
+    REQUIRE(queue.get(ids[7]) == 7);
+
+    // Removed slots can still be reused
+    REQUIRE(queue.remove(ids[3]));
+    const IdHandle reused = queue.pushBack(10);
+    REQUIRE_FALSE(reused.isNull());
+    REQUIRE(reused.index == ids[3].index);
+    REQUIRE(queue.pushBack(11).isNull());
+}
+
+TEST_CASE("ConcurrentIdQueue Exception Safety", "[Container, IdQueue, Concurrent]") {
+    ConcurrentIdQueue<ThrowingValue, 4, 2> queue;
+
+    // Each failed insert returns its slot, so throwing more times than there are slots doesn't use any up
+    for (int i = 0; i < 20; ++i) REQUIRE_THROWS(queue.emplaceBack(i, true));
+    REQUIRE(queue.size() == 0);
+
+    for (int i = 0; i < 8; ++i) {
+        const IdHandle id = queue.emplaceBack(i);
+        REQUIRE_FALSE(id.isNull());
+        REQUIRE(queue.get(id).value == i);
+    }
+    REQUIRE(queue.emplaceBack(8).isNull());
+}
+
+TEST_CASE("ConcurrentIdQueue Multithreaded", "[Container, IdQueue, Concurrent]") {
+    constexpr int threadCount = 4;
+    constexpr int iterations = 20000;
+
+    ConcurrentIdQueue<int, 64> queue;
+    std::atomic<bool> failed = false;
+
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < threadCount; ++thread) {
+        threads.emplace_back([&, thread] {
+            std::vector<IdHandle> owned;
+            for (int i = 0; i < iterations; ++i) {
+                const int value = thread * iterations + i;
+                owned.push_back(queue.pushBack(value));
+
+                // Every so often release half of what this thread holds so slots are recycled between threads
+                if (owned.size() == 32) {
+                    for (size_t j = 0; j < 16; ++j) {
+                        if (!queue.remove(owned.back())) failed = true;
+                        owned.pop_back();
+                    }
+                }
+            }
+
+            for (const IdHandle handle : owned) {
+                if (queue.tryGet(handle) == nullptr || queue.get(handle) / iterations != thread) failed = true;
+            }
+        });
+    }
+
+    for (std::thread& thread : threads) thread.join();
+
+    REQUIRE_FALSE(failed);
+    REQUIRE(queue.size() == threadCount * (16 + iterations % 16));
+}
@@ -1,6 +1,9 @@
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
 
 #include <maths/Matrix.h>
+#include <maths/matrix/BatchTransform.h>
+#include <vector>
 
 using namespace DatEngine::DatMaths;
 
@@ -255,3 +258,274 @@ TEST_CASE("Get Row", "[DatMaths, Mat]") {
         }
     }
 }
+
+TEST_CASE("Matrix Multiply", "[DatMaths, Mat, Multiply]") {
+    SECTION("Mat2") {
+        Matrix<2, 2, float> lh(1.f, 2.f, 3.f, 4.f);
+        Matrix<2, 2, float> rh(5.f, 6.f, 7.f, 8.f);
+
+        Matrix<2, 2, float> result = lh * rh;
+        REQUIRE(result == Matrix<2, 2, float>(23.f, 34.f, 31.f, 46.f));
+    }
+
+    SECTION("Mat3") {
+        mat3 lh(1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f);
+        mat3 rh(9.f, 8.f, 7.f, 6.f, 5.f, 4.f, 3.f, 2.f, 1.f);
+
+        mat3 result = lh * rh;
+        REQUIRE(result == mat3(90.f, 114.f, 138.f, 54.f, 69.f, 84.f, 18.f, 24.f, 30.f));
+    }
+
+    SECTION("Mat4") {
+        mat4 lh(1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f, 10.f, 11.f, 12.f, 13.f, 14.f, 15.f, 16.f);
+        mat4 rh(16.f, 15.f, 14.f, 13.f, 12.f, 11.f, 10.f, 9.f, 8.f, 7.f, 6.f, 5.f, 4.f, 3.f, 2.f, 1.f);
+
+        mat4 result = lh * rh;
+        REQUIRE(result
+                == mat4(386.f,
+                        444.f,
+                        502.f,
+                        560.f,
+                        274.f,
+                        316.f,
+                        358.f,
+                        400.f,
+                        162.f,
+                        188.f,
+                        214.f,
+                        240.f,
+                        50.f,
+                        60.f,
+                        70.f,
+                        80.f));
+    }
+
+    SECTION("Mat4 Identity") {
+        mat4 lh(1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f, 10.f, 11.f, 12.f, 13.f, 14.f, 15.f, 16.f);
+
+        REQUIRE(lh * mat4::identity() == lh);
+        REQUIRE(mat4::identity() * lh == lh);
+    }
+
+    SECTION("Mat5 Identity") {
+        Matrix<5, 5, float> lh(2);
+
+        REQUIRE(lh * Matrix<5, 5, float>::identity() == lh);
+    }
+
+    SECTION("Non Square") {
+        Matrix<3, 2, float> lh(1.f, 2.f, 3.f, 4.f, 5.f, 6.f);
+        Matrix<2, 3, float> rh(1.f, 2.f, 3.f, 4.f, 5.f, 6.f);
+
+        Matrix<2, 2, float> result = lh * rh;
+        REQUIRE(result == Matrix<2, 2, float>(22.f, 28.f, 49.f, 64.f));
+    }
+
+    SECTION("In Place") {
+        mat3 lh(1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f);
+        lh *= mat3::identity();
+        REQUIRE(lh == mat3(1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f));
+
+        lh *= 2.f;
+        REQUIRE(lh == mat3(2.f, 4.f, 6.f, 8.f, 10.f, 12.f, 14.f, 16.f, 18.f));
+    }
+}
+
+TEST_CASE("Matrix Vector Multiply", "[DatMaths, Mat, Multiply]") {
+    SECTION("Mat3") {
+        mat3 lh(1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f);
+
+        vec3 result = lh * vec3(1, 0, 2);
+        REQUIRE(result == vec3(15, 18, 21));
+    }
+
+    SECTION("Mat4") {
+        mat4 lh(1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f, 10.f, 11.f, 12.f, 13.f, 14.f, 15.f, 16.f);
+
+        vec4 result = lh * vec4(1, 0, 2, 1);
+        REQUIRE(result == vec4(32, 36, 40, 44));
+    }
+
+    SECTION("Mat4 Translation") {
+        mat4 translation = mat4::identity();
+        translation[3] = vec4(5, 6, 7, 1);
+
+        REQUIRE(translation * vec4(1, 2, 3, 1) == vec4(6, 8, 10, 1));
+        REQUIRE(translation * vec4(1, 2, 3, 0) == vec4(1, 2, 3, 0));
+    }
+}
+
+TEST_CASE("Matrix Transpose", "[DatMaths, Mat, Transpose]") {
+    SECTION("Mat3") {
+        mat3 matrix(1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f);
+        REQUIRE(matrix.transposed() == mat3(1.f, 4.f, 7.f, 2.f, 5.f, 8.f, 3.f, 6.f, 9.f));
+    }
+
+    SECTION("Mat4") {
+        mat4 matrix(1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f, 10.f, 11.f, 12.f, 13.f, 14.f, 15.f, 16.f);
+        mat4 transposed = matrix.transposed();
+
+        for (int i = 0; i < 4; ++i) {
+            REQUIRE(transposed.getRow(i) == matrix[i]);
+        }
+    }
+
+    SECTION("Non Square") {
+        Matrix<3, 2, float> matrix(1.f, 2.f, 3.f, 4.f, 5.f, 6.f);
+        REQUIRE(matrix.transposed() == Matrix<2, 3, float>(1.f, 3.f, 5.f, 2.f, 4.f, 6.f));
+    }
+}
+
+TEST_CASE("Matrix Determinant", "[DatMaths, Mat, Determinant]") {
+    SECTION("Mat2") {
+        Matrix<2, 2, float> matrix(3.f, 8.f, 4.f, 6.f);
+        REQUIRE(matrix.determinant() == -14);
+    }
+
+    SECTION("Mat3") {
+        mat3 matrix(6.f, 4.f, 2.f, 1.f, -2.f, 8.f, 1.f, 5.f, 7.f);
+        REQUIRE(matrix.determinant() == -306);
+    }
+
+    SECTION("Mat4") {
+        mat4 matrix(1.f, 0.f, 2.f, -1.f, 3.f, 0.f, 0.f, 5.f, 2.f, 1.f, 4.f, -3.f, 1.f, 0.f, 5.f, 0.f);
+        REQUIRE(matrix.determinant() == 30);
+    }
+
+    SECTION("Singular") {
+        mat4 matrix(1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f, 10.f, 11.f, 12.f, 13.f, 14.f, 15.f, 16.f);
+        REQUIRE(matrix.determinant() == 0);
+    }
+
+    SECTION("Mat5") {
+        Matrix<5, 5, float> matrix = Matrix<5, 5, float>::identity();
+        matrix[0][0] = 2;
+        matrix[4][4] = 3;
+        matrix[2][3] = 7;
+
+        REQUIRE(matrix.determinant() == Catch::Approx(6));
+    }
+}
+
+TEST_CASE("Matrix Inverse", "[DatMaths, Mat, Inverse]") {
+    SECTION("Mat2") {
+        Matrix<2, 2, float> matrix(4.f, 2.f, 7.f, 6.f);
+        REQUIRE((matrix * matrix.inverse()).equal(Matrix<2, 2, float>::identity(), constants::smallNumber));
+    }
+
+    SECTION("Mat3") {
+        mat3 matrix(6.f, 4.f, 2.f, 1.f, -2.f, 8.f, 1.f, 5.f, 7.f);
+        REQUIRE((matrix * matrix.inverse()).equal(mat3::identity(), constants::smallNumber));
+        REQUIRE((matrix.inverse() * matrix).equal(mat3::identity(), constants::smallNumber));
+    }
+
+    SECTION("Mat4") {
+        mat4 matrix(1.f, 0.f, 2.f, -1.f, 3.f, 0.f, 0.f, 5.f, 2.f, 1.f, 4.f, -3.f, 1.f, 0.f, 5.f, 0.f);
+        REQUIRE((matrix * matrix.inverse()).equal(mat4::identity(), constants::smallNumber));
+        REQUIRE((matrix.inverse() * matrix).equal(mat4::identity(), constants::smallNumber));
+    }
+
+    SECTION("Mat4 Transform") {
+        mat4 matrix(0.f, 1.f, 0.f, 0.f, -2.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.5f, 0.f, 10.f, -4.f, 3.f, 1.f);
+        vec4 point(1, 2, 3, 1);
+
+        REQUIRE((matrix.inverse() * (matrix * point)).equal(point, constants::smallNumber));
+    }
+
+    SECTION("Mat5") {
+        Matrix<5, 5, float> matrix = Matrix<5, 5, float>::identity();
+        matrix[0][0] = 2;
+        matrix[4][4] = 3;
+        matrix[2][3] = 7;
+        matrix[1][0] = 4;
+
+        REQUIRE((matrix * matrix.inverse()).equal(Matrix<5, 5, float>::identity(), constants::smallNumber));
+    }
+}
+
+TEST_CASE("Batch Transform", "[DatMaths, Mat, Batch Transform]") {
+    mat4 matrix(0.f, 1.f, 0.f, 0.f, -2.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.5f, 0.f, 10.f, -4.f, 3.f, 1.f);
+
+    // Sizes either side of the 8 wide batches so the tails are covered
+    for (const size_t count : {0, 1, 2, 7, 8, 9, 16, 37}) {
+        std::vector<vec3> points(count);
+        std::vector<vec4> vectors(count);
+        for (size_t i = 0; i < count; ++i) {
+            points[i] = vec3(i, i * 2.f, -(i * 3.f));
+            vectors[i] = vec4(points[i], i % 2);
+        }
+
+        SECTION("Points " + std::to_string(count)) {
+            std::vector<vec3> out(count);
+            transformPoints(matrix, points, out);
+
+            for (size_t i = 0; i < count; ++i) {
+                REQUIRE(out[i].equal(vec3(matrix * vec4(points[i], 1)), constants::smallNumber));
+            }
+        }
+
+        SECTION("Directions " + std::to_string(count)) {
+            std::vector<vec3> out(count);
+            transformDirections(matrix, points, out);
+
+            for (size_t i = 0; i < count; ++i) {
+                REQUIRE(out[i].equal(vec3(matrix * vec4(points[i], 0)), constants::smallNumber));
+            }
+        }
+
+        SECTION("Vectors " + std::to_string(count)) {
+            std::vector<vec4> out(count);
+            transform(matrix, vectors, out);
+
+            for (size_t i = 0; i < count; ++i) {
+                REQUIRE(out[i].equal(matrix * vectors[i], constants::smallNumber));
+            }
+        }
+
+        SECTION("In Place " + std::to_string(count)) {
+            std::vector<vec3> out = points;
+            transformPoints(matrix, out, out);
+
+            for (size_t i = 0; i < count; ++i) {
+                REQUIRE(out[i].equal(vec3(matrix * vec4(points[i], 1)), constants::smallNumber));
+            }
+        }
+    }
+}
+
+TEST_CASE("Batch Transform Instanced", "[DatMaths, Mat, Batch Transform]") {
+    std::vector<mat4> matrices(3, mat4::identity());
+    matrices[1][3] = vec4(1, 2, 3, 1);
+    matrices[2] = matrices[2] * 2.f;
+
+    std::vector<vec3> points;
+    std::vector<vec4> vectors;
+    for (int i = 0; i < 11; ++i) {
+        points.emplace_back(i, -i, i * 0.5f);
+        vectors.emplace_back(points.back(), 1);
+    }
+
+    SECTION("Points") {
+        std::vector<vec3> out(matrices.size() * points.size());
+        transformPointsInstanced(matrices, points, out);
+
+        for (size_t i = 0; i < matrices.size(); ++i) {
+            for (size_t j = 0; j < points.size(); ++j) {
+                REQUIRE(out[i * points.size() + j].equal(
+                        vec3(matrices[i] * vec4(points[j], 1)), constants::smallNumber
+                ));
+            }
+        }
+    }
+
+    SECTION("Vectors") {
+        std::vector<vec4> out(matrices.size() * vectors.size());
+        transformInstanced(matrices, vectors, out);
+
+        for (size_t i = 0; i < matrices.size(); ++i) {
+            for (size_t j = 0; j < vectors.size(); ++j) {
+                REQUIRE(out[i * vectors.size() + j].equal(matrices[i] * vectors[j], constants::smallNumber));
+            }
+        }
+    }
+}
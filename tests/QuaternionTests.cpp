@@ -0,0 +1,278 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <maths/Quaternion.h>
+#include <maths/quaternion/BatchRotation.h>
+
+#include <string>
+#include <vector>
+
+using namespace DatEngine::DatMaths;
+
+namespace {
+    /**
+     * Check two quaternions represent the same rotation, q and -q are equivalent
+     */
+    bool sameRotation(const quat& lh, const quat& rh, const float tolerance = 1e-5f) {
+        return lh.equal(rh, tolerance) || lh.equal(-rh, tolerance);
+    }
+
+    /**
+     * Generate some distinct normalised rotations
+     */
+    std::vector<quat> makeRotations(const size_t count, const float offset) {
+        std::vector<quat> rotations(count);
+        for (size_t i = 0; i < count; ++i) {
+            const vec3 axis = vec3(1, static_cast<float>(i) * 0.3f, offset - static_cast<float>(i)).normalised();
+            rotations[i] = quat::fromAxisAngle(axis, static_cast<float>(i) * 0.4f + offset);
+        }
+        return rotations;
+    }
+} // namespace
+
+/* -------------------------------------------- */
+/*  Initialisation                              */
+/* -------------------------------------------- */
+
+TEST_CASE("Quaternion Initialisation", "[DatMaths, Quaternion, Initialisation]") {
+    SECTION("Identity") {
+        quat q;
+        REQUIRE(q == quat(0, 0, 0, 1));
+        REQUIRE(q == quat::identity());
+        REQUIRE(q * vec3(1, 2, 3) == vec3(1, 2, 3));
+    }
+
+    SECTION("Components") {
+        quat q(1, 2, 3, 4);
+        REQUIRE(q.vec == vec3(1, 2, 3));
+        REQUIRE(q.s == 4);
+    }
+}
+
+/* -------------------------------------------- */
+/*  Axis Angle                                  */
+/* -------------------------------------------- */
+
+TEST_CASE("Quaternion Axis Angle", "[DatMaths, Quaternion, Axis Angle]") {
+    SECTION("Rotate Vector") {
+        const quat q = quat::fromAxisAngle(vec3::UP, constants::halfPi);
+        REQUIRE((q * vec3(1, 0, 0)).equal(vec3(0, 0, -1), 1e-6f));
+        REQUIRE((q * vec3(0, 0, 1)).equal(vec3(1, 0, 0), 1e-6f));
+        REQUIRE((q * vec3(0, 1, 0)).equal(vec3(0, 1, 0), 1e-6f));
+    }
+
+    SECTION("Round Trip") {
+        const vec3 axis = vec3(1, 2, 3).normalised();
+        const quat q = quat::fromAxisAngle(axis, 1.2f);
+
+        vec3 outAxis;
+        float outAngle;
+        q.toAxisAngle(outAxis, outAngle);
+        REQUIRE(outAxis.equal(axis, 1e-5f));
+        REQUIRE(outAngle == Catch::Approx(1.2f));
+    }
+
+    SECTION("Identity") {
+        vec3 outAxis;
+        float outAngle;
+        quat::identity().toAxisAngle(outAxis, outAngle);
+        REQUIRE(outAngle == 0);
+        REQUIRE(outAxis == vec3::UP);
+    }
+}
+
+/* -------------------------------------------- */
+/*  Multiplication                              */
+/* -------------------------------------------- */
+
+TEST_CASE("Quaternion Multiply", "[DatMaths, Quaternion, Multiply]") {
+    SECTION("Hamilton Product") {
+        // i * j = k, j * i = -k
+        const quat i(1, 0, 0, 0);
+        const quat j(0, 1, 0, 0);
+        REQUIRE(i * j == quat(0, 0, 1, 0));
+        REQUIRE(j * i == quat(0, 0, -1, 0));
+
+        const quat lh(1, 2, 3, 4);
+        const quat rh(5, 6, 7, 8);
+        REQUIRE(lh * rh == quat(24, 48, 48, -6));
+    }
+
+    SECTION("Composes Rotations") {
+        const quat first = quat::fromAxisAngle(vec3::UP, 0.7f);
+        const quat second = quat::fromAxisAngle(vec3(1, 0, 0), -1.1f);
+        const vec3 point(1, 2, 3);
+
+        REQUIRE(((second * first) * point).equal(second * (first * point), 1e-5f));
+
+        quat combined = second;
+        combined *= first;
+        REQUIRE(combined.equal(second * first, 1e-6f));
+    }
+
+    SECTION("Double") {
+        const dquat lh(1, 2, 3, 4);
+        const dquat rh(5, 6, 7, 8);
+        REQUIRE(lh * rh == dquat(24, 48, 48, -6));
+    }
+}
+
+/* -------------------------------------------- */
+/*  Conjugate and Inverse                       */
+/* -------------------------------------------- */
+
+TEST_CASE("Quaternion Conjugate", "[DatMaths, Quaternion, Conjugate]") {
+    SECTION("Conjugate") {
+        REQUIRE(quat(1, 2, 3, 4).conjugate() == quat(-1, -2, -3, 4));
+    }
+
+    SECTION("Undoes Rotation") {
+        const quat q = quat::fromAxisAngle(vec3(0, 0, 1), 0.9f);
+        REQUIRE((q.conjugate() * (q * vec3(1, 2, 3))).equal(vec3(1, 2, 3), 1e-5f));
+        REQUIRE(sameRotation(q * q.conjugate(), quat::identity()));
+    }
+
+    SECTION("Inverse") {
+        const quat q(1, 2, 3, 4);
+        REQUIRE((q * q.inverse()).equal(quat::identity(), 1e-6f));
+    }
+}
+
+/* -------------------------------------------- */
+/*  Normalise                                   */
+/* -------------------------------------------- */
+
+TEST_CASE("Quaternion Normalise", "[DatMaths, Quaternion, Normalise]") {
+    quat q(1, 2, 2, 4);
+    REQUIRE(q.length() == Catch::Approx(5));
+    REQUIRE(q.lengthSquared() == Catch::Approx(25));
+
+    const quat normalised = q.normalised();
+    REQUIRE(q.s == 4);
+    REQUIRE(normalised.isNormalised());
+    REQUIRE(normalised.equal(quat(0.2f, 0.4f, 0.4f, 0.8f), 1e-6f));
+
+    q.normalise();
+    REQUIRE(q == normalised);
+}
+
+/* -------------------------------------------- */
+/*  Matrix Conversion                           */
+/* -------------------------------------------- */
+
+TEST_CASE("Quaternion Matrix Conversion", "[DatMaths, Quaternion, Matrix]") {
+    SECTION("To Matrix") {
+        const quat q = quat::fromAxisAngle(vec3(1, 2, 3).normalised(), 0.8f);
+        const vec3 point(4, -5, 6);
+
+        const vec3 rotated = q * point;
+        REQUIRE((q.toMat3() * point).equal(rotated, 1e-5f));
+        REQUIRE(vec3(q.toMat4() * vec4(point, 1)).equal(rotated, 1e-5f));
+        REQUIRE(q.toMat4()[3] == vec4(0, 0, 0, 1));
+    }
+
+    SECTION("Round Trip") {
+        // Angles near pi exercise each branch of fromMatrix, not just the positive trace
+        const std::vector<quat> rotations = {
+                quat::identity(),
+                quat::fromAxisAngle(vec3(1, 2, 3).normalised(), 0.5f),
+                quat::fromAxisAngle(vec3(1, 0, 0), 3.f),
+                quat::fromAxisAngle(vec3(0, 1, 0), 3.f),
+                quat::fromAxisAngle(vec3(0, 0, 1), 3.f),
+                quat::fromAxisAngle(vec3(1, 1, 0).normalised(), constants::pi),
+        };
+
+        for (const quat& q : rotations) {
+            REQUIRE(sameRotation(quat::fromMatrix(q.toMat3()), q));
+            REQUIRE(sameRotation(quat::fromMatrix(q.toMat4()), q));
+        }
+    }
+}
+
+/* -------------------------------------------- */
+/*  Interpolation                               */
+/* -------------------------------------------- */
+
+TEST_CASE("Quaternion Interpolation", "[DatMaths, Quaternion, Interpolation]") {
+    const quat from = quat::identity();
+    const quat to = quat::fromAxisAngle(vec3::UP, 2.f);
+
+    SECTION("Slerp") {
+        REQUIRE(sameRotation(slerp(from, to, 0.f), from));
+        REQUIRE(sameRotation(slerp(from, to, 1.f), to));
+        REQUIRE(sameRotation(slerp(from, to, 0.25f), quat::fromAxisAngle(vec3::UP, 0.5f)));
+        REQUIRE(slerp(from, to, 0.3f).isNormalised(1e-5f));
+    }
+
+    SECTION("Slerp Shortest Path") {
+        // -to is the same rotation, so the result should be the same as with to
+        REQUIRE(sameRotation(slerp(from, -to, 0.25f), quat::fromAxisAngle(vec3::UP, 0.5f)));
+    }
+
+    SECTION("Slerp Small Angle") {
+        const quat close = quat::fromAxisAngle(vec3::UP, 0.01f);
+        REQUIRE(sameRotation(slerp(from, close, 0.5f), quat::fromAxisAngle(vec3::UP, 0.005f)));
+    }
+
+    SECTION("Nlerp") {
+        REQUIRE(sameRotation(nlerp(from, to, 0.f), from));
+        REQUIRE(sameRotation(nlerp(from, to, 1.f), to));
+
+        // nlerp matches slerp at the midpoint
+        REQUIRE(sameRotation(nlerp(from, to, 0.5f), quat::fromAxisAngle(vec3::UP, 1.f)));
+        REQUIRE(sameRotation(nlerp(from, -to, 0.5f), quat::fromAxisAngle(vec3::UP, 1.f)));
+    }
+}
+
+/* -------------------------------------------- */
+/*  Batch                                       */
+/* -------------------------------------------- */
+
+TEST_CASE("Quaternion Batch Rotate", "[DatMaths, Quaternion, Batch]") {
+    // Sizes either side of the 8 wide SIMD width to cover the scalar tail
+    for (const size_t count : {0, 1, 7, 8, 9, 37}) {
+        SECTION("Size " + std::to_string(count)) {
+            std::vector<vec3> points(count);
+            for (size_t i = 0; i < count; ++i) {
+                points[i] = vec3(static_cast<float>(i), 1.f - static_cast<float>(i), 2.f);
+            }
+            const std::vector<quat> rotations = makeRotations(count, 0.3f);
+            std::vector<vec3> out(count);
+
+            rotate(rotations.empty() ? quat() : rotations[0], points, out);
+            for (size_t i = 0; i < count; ++i) {
+                REQUIRE(out[i].equal(rotations[0] * points[i], 1e-4f));
+            }
+
+            rotate(rotations, points, out);
+            for (size_t i = 0; i < count; ++i) {
+                REQUIRE(out[i].equal(rotations[i] * points[i], 1e-4f));
+            }
+        }
+    }
+}
+
+TEST_CASE("Quaternion Batch Blend", "[DatMaths, Quaternion, Batch]") {
+    for (const size_t count : {0, 1, 7, 8, 9, 37}) {
+        SECTION("Size " + std::to_string(count)) {
+            const std::vector<quat> from = makeRotations(count, 0.3f);
+            std::vector<quat> to = makeRotations(count, 1.1f);
+            if (count > 2) {
+                // Cover the shortest path flip and the small angle path
+                to[1] = -to[1];
+                to[2] = from[2] * quat::fromAxisAngle(vec3::UP, 0.01f);
+            }
+            std::vector<quat> out(count);
+
+            nlerp(from, to, 0.3f, out);
+            for (size_t i = 0; i < count; ++i) {
+                REQUIRE(out[i].equal(nlerp(from[i], to[i], 0.3f), 1e-5f));
+            }
+
+            slerp(from, to, 0.3f, out);
+            for (size_t i = 0; i < count; ++i) {
+                REQUIRE(out[i].equal(slerp(from[i], to[i], 0.3f), 1e-5f));
+            }
+        }
+    }
+}
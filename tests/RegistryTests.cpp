@@ -0,0 +1,295 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <ecs/Registry.h>
+#include <maths/Vector.h>
+
+#include <set>
+#include <vector>
+
+using namespace DatEngine;
+using namespace DatEngine::ECS;
+
+namespace {
+    struct Position {
+        DatMaths::vec3 value;
+    };
+
+    struct Velocity {
+        DatMaths::vec3 value;
+    };
+
+    struct Tag {};
+} // namespace
+
+TEST_CASE("Registry Entities", "[ECS, Registry, Entity]") {
+    Registry registry;
+
+    SECTION("Create") {
+        const Entity a = registry.create();
+        const Entity b = registry.create();
+
+        REQUIRE(a != b);
+        REQUIRE(registry.isValid(a));
+        REQUIRE(registry.isValid(b));
+        REQUIRE(registry.size() == 2);
+        REQUIRE_FALSE(registry.isValid(nullEntity));
+    }
+
+    SECTION("Destroy") {
+        const Entity a = registry.create();
+        registry.emplace<Position>(a, DatMaths::vec3(1, 2, 3));
+        registry.destroy(a);
+
+        REQUIRE_FALSE(registry.isValid(a));
+        REQUIRE(registry.size() == 0);
+    }
+
+    SECTION("Generations") {
+        // The index is reused, but the stale handle stays invalid
+        const Entity a = registry.create();
+        registry.destroy(a);
+        const Entity b = registry.create();
+
+        REQUIRE(b.index == a.index);
+        REQUIRE(b.generation == a.generation + 1);
+        REQUIRE_FALSE(registry.isValid(a));
+        REQUIRE(registry.isValid(b));
+        REQUIRE_FALSE(registry.has<Position>(b));
+    }
+
+    SECTION("Clear") {
+        const Entity a = registry.create();
+        registry.emplace<Tag>(a);
+        registry.clear();
+
+        REQUIRE_FALSE(registry.isValid(a));
+        REQUIRE(registry.size() == 0);
+        REQUIRE(registry.create().index == 0);
+    }
+}
+
+TEST_CASE("Registry Components", "[ECS, Registry, Component]") {
+    Registry registry;
+    const Entity entity = registry.create();
+
+    SECTION("Emplace and Get") {
+        registry.emplace<Position>(entity, DatMaths::vec3(1, 2, 3));
+
+        REQUIRE(registry.has<Position>(entity));
+        REQUIRE_FALSE(registry.has<Position, Velocity>(entity));
+        REQUIRE(registry.get<Position>(entity).value == DatMaths::vec3(1, 2, 3));
+        REQUIRE(registry.tryGet<Velocity>(entity) == nullptr);
+    }
+
+    SECTION("Remove") {
+        registry.emplace<Position>(entity);
+        registry.emplace<Velocity>(entity);
+        registry.remove<Position>(entity);
+
+        REQUIRE_FALSE(registry.has<Position>(entity));
+        REQUIRE(registry.has<Velocity>(entity));
+    }
+}
+
+TEST_CASE("Registry Views", "[ECS, Registry, View]") {
+    Registry registry;
+    std::vector<Entity> entities;
+    for (int i = 0; i < 100; ++i) {
+        const Entity entity = registry.create();
+        entities.push_back(entity);
+
+        registry.emplace<Position>(entity, DatMaths::vec3(static_cast<float>(i), 0, 0));
+        if (i % 2 == 0) registry.emplace<Velocity>(entity, DatMaths::vec3(1, 0, 0));
+        if (i % 10 == 0) registry.emplace<Tag>(entity);
+    }
+
+    SECTION("Single Component") {
+        size_t count = 0;
+        registry.view<Position>().each([&](Position&) { ++count; });
+        REQUIRE(count == 100);
+    }
+
+    SECTION("Multiple Components") {
+        std::set<uint32_t> seen;
+        registry.view<Position, Velocity>().each([&](const Entity entity, Position& position, Velocity& velocity) {
+            REQUIRE(registry.isValid(entity));
+            REQUIRE(entity.index % 2 == 0);
+            position.value += velocity.value;
+            seen.insert(entity.index);
+        });
+
+        REQUIRE(seen.size() == 50);
+        REQUIRE(registry.get<Position>(entities[2]).value.x == 3);
+        REQUIRE(registry.get<Position>(entities[3]).value.x == 3);
+    }
+
+    SECTION("Driven By Smallest Pool") {
+        auto view = registry.view<Position, Velocity, Tag>();
+        REQUIRE(view.sizeHint() == 10);
+
+        std::set<uint32_t> seen;
+        view.each([&](const Entity entity, Position&, Velocity&, Tag&) { seen.insert(entity.index); });
+        REQUIRE(seen == std::set<uint32_t>{0, 10, 20, 30, 40, 50, 60, 70, 80, 90});
+    }
+
+    SECTION("After Destroy") {
+        registry.destroy(entities[10]);
+        registry.destroy(entities[20]);
+
+        size_t count = 0;
+        registry.view<Velocity, Tag>().each([&](Velocity&, Tag&) { ++count; });
+        REQUIRE(count == 8);
+    }
+
+    SECTION("Empty Pool") {
+        struct Unused {};
+
+        size_t count = 0;
+        registry.view<Position, Unused>().each([&](Position&, Unused&) { ++count; });
+        REQUIRE(count == 0);
+    }
+}
+
+TEST_CASE("Registry Groups", "[ECS, Registry, Group]") {
+    Registry registry;
+    std::vector<Entity> entities;
+    for (int i = 0; i < 20; ++i) {
+        const Entity entity = registry.create();
+        entities.push_back(entity);
+
+        registry.emplace<Position>(entity, DatMaths::vec3(static_cast<float>(i), 0, 0));
+        if (i % 2 == 0) registry.emplace<Velocity>(entity, DatMaths::vec3(static_cast<float>(i), 1, 0));
+    }
+
+    // Every grouped entity should be at the same position in both pools, and match its view
+    const auto requirePacked = [&](const size_t expectedSize) {
+        auto group = registry.group<Position, Velocity>();
+        REQUIRE(group.size() == expectedSize);
+
+        size_t count = 0;
+        group.each([&](const Entity entity, const Position& position, const Velocity& velocity) {
+            REQUIRE(registry.isValid(entity));
+            REQUIRE(&registry.get<Position>(entity) == &position);
+            REQUIRE(&registry.get<Velocity>(entity) == &velocity);
+            REQUIRE(position.value.x == velocity.value.x);
+            ++count;
+        });
+        REQUIRE(count == expectedSize);
+
+        size_t viewCount = 0;
+        registry.view<Position, Velocity>().each([&](Position&, Velocity&) { ++viewCount; });
+        REQUIRE(viewCount == expectedSize);
+    };
+
+    SECTION("Existing Entities") {
+        requirePacked(10);
+    }
+
+    SECTION("Same Group") {
+        registry.group<Position, Velocity>();
+        REQUIRE(registry.group<Velocity, Position>().size() == 10);
+    }
+
+    SECTION("Add Component") {
+        registry.group<Position, Velocity>();
+        registry.emplace<Velocity>(entities[3], DatMaths::vec3(3, 0, 0));
+        requirePacked(11);
+
+        // A new entity only joins once it has both components
+        const Entity entity = registry.create();
+        registry.emplace<Velocity>(entity, DatMaths::vec3(100, 0, 0));
+        requirePacked(11);
+        registry.emplace<Position>(entity, DatMaths::vec3(100, 0, 0));
+        requirePacked(12);
+    }
+
+    SECTION("Remove Component") {
+        registry.group<Position, Velocity>();
+        registry.remove<Velocity>(entities[0]);
+        registry.remove<Position>(entities[18]);
+        registry.remove<Position>(entities[1]);
+        requirePacked(8);
+    }
+
+    SECTION("Destroy") {
+        registry.group<Position, Velocity>();
+        registry.destroy(entities[4]);
+        registry.destroy(entities[5]);
+        requirePacked(9);
+    }
+
+    SECTION("Clear") {
+        registry.group<Position, Velocity>();
+        registry.clear();
+        requirePacked(0);
+
+        const Entity entity = registry.create();
+        registry.emplace<Position>(entity, DatMaths::vec3(1, 0, 0));
+        registry.emplace<Velocity>(entity, DatMaths::vec3(1, 0, 0));
+        requirePacked(1);
+    }
+}
+
+TEST_CASE("Registry Batches", "[ECS, Registry]") {
+    Registry registry;
+
+    SECTION("Create") {
+        const Entity destroyed = registry.create();
+        registry.destroy(destroyed);
+
+        std::vector<Entity> entities(4);
+        registry.create(entities);
+
+        REQUIRE(registry.size() == 4);
+        REQUIRE(entities[0].index == destroyed.index);
+        REQUIRE(entities[0].generation != destroyed.generation);
+
+        std::set<uint32_t> indices;
+        for (const Entity entity : entities) {
+            REQUIRE(registry.isValid(entity));
+            indices.insert(entity.index);
+        }
+        REQUIRE(indices.size() == 4);
+    }
+
+    SECTION("Insert") {
+        std::vector<Entity> entities(10);
+        registry.create(entities);
+        registry.group<Position, Velocity>();
+
+        std::vector<Position> positions;
+        std::vector<Velocity> velocities;
+        for (int i = 0; i < 10; ++i) {
+            positions.push_back({DatMaths::vec3(static_cast<float>(i), 0, 0)});
+            if (i < 5) velocities.push_back({DatMaths::vec3(static_cast<float>(i), 0, 0)});
+        }
+
+        registry.insert<Position>(entities, positions);
+        registry.insert<Velocity>(std::span(entities).first(5), velocities);
+
+        REQUIRE(registry.get<Position>(entities[7]).value.x == 7);
+        REQUIRE(registry.group<Position, Velocity>().size() == 5);
+        registry.group<Position, Velocity>().each([](const Position& position, const Velocity& velocity) {
+            REQUIRE(position.value.x == velocity.value.x);
+        });
+    }
+
+    SECTION("Sort") {
+        std::vector<Entity> entities(5);
+        registry.create(entities);
+        for (int i = 0; i < 5; ++i) {
+            registry.emplace<Position>(entities[i], DatMaths::vec3(static_cast<float>(i % 3), 0, 0));
+        }
+
+        registry.sort<Position>([](const Position& first, const Position& second) {
+            return first.value.x < second.value.x;
+        });
+
+        float previous = 0;
+        registry.view<Position>().each([&](const Entity entity, const Position& position) {
+            REQUIRE(position.value.x >= previous);
+            REQUIRE(&registry.get<Position>(entity) == &position);
+            previous = position.value.x;
+        });
+    }
+}
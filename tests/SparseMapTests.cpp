@@ -1,5 +1,6 @@
 #include <catch2/catch_test_macros.hpp>
 #include <iostream>
+#include <vector>
 
 #include <container/SparseMap.h>
 #include <maths/Vector.h>
@@ -33,3 +34,182 @@ TEST_CASE("SparseMap Insert", "[Container, SparseMap, Insertion]") {
         REQUIRE(inVec == *outVec);
     }
 }
+
+TEST_CASE("SparseMap Remove", "[Container, SparseMap, Removal]") {
+    SparseMap<int> map;
+    map.insert(1, 10);
+    map.insert(2, 20);
+    map.insert(3, 30);
+
+    SECTION("Remove Middle") {
+        map.remove(2);
+
+        REQUIRE(map.size() == 2);
+        REQUIRE_FALSE(map.contains(2));
+        REQUIRE(map.get(2) == nullptr);
+        REQUIRE(*map.get(1) == 10);
+        REQUIRE(*map.get(3) == 30);
+    }
+
+    SECTION("Remove Last") {
+        map.remove(3);
+
+        REQUIRE(map.size() == 2);
+        REQUIRE_FALSE(map.contains(3));
+        REQUIRE(*map.get(2) == 20);
+    }
+
+    SECTION("Remove All") {
+        map.remove(1);
+        map.remove(3);
+        map.remove(2);
+
+        REQUIRE(map.size() == 0);
+        REQUIRE_FALSE(map.contains(1));
+
+        map.insert(2, 25);
+        REQUIRE(*map.get(2) == 25);
+    }
+
+    SECTION("Swap") {
+        map.swap(1, 3);
+
+        REQUIRE(map.begin()->first == 3);
+        REQUIRE(*map.get(1) == 10);
+        REQUIRE(*map.get(3) == 30);
+    }
+
+    SECTION("Clear") {
+        map.clear();
+
+        REQUIRE(map.size() == 0);
+        REQUIRE_FALSE(map.contains(1));
+        REQUIRE(map.get(3) == nullptr);
+    }
+}
+
+TEST_CASE("SparseMap Paging", "[Container, SparseMap, Paging]") {
+    SparseMap<int> map;
+
+    SECTION("Missing Keys") {
+        REQUIRE_FALSE(map.contains(0));
+        REQUIRE(map.get(123456) == nullptr);
+        REQUIRE(map.allocatedPageCount() == 0);
+    }
+
+    SECTION("Large Keys") {
+        // Only the page holding the key is allocated, rather than every key below it
+        map.insert(10'000'000, 1);
+        map.insert(10'000'001, 2);
+
+        REQUIRE(map.allocatedPageCount() == 1);
+        REQUIRE(*map.get(10'000'000) == 1);
+        REQUIRE(*map.get(10'000'001) == 2);
+        REQUIRE_FALSE(map.contains(0));
+        REQUIRE_FALSE(map.contains(9'999'999));
+    }
+
+    SECTION("Page Boundaries") {
+        constexpr uint32_t pageSize = SparseMap<int>::pageSize;
+        for (const uint32_t key : {pageSize - 1, pageSize, 2 * pageSize, 5 * pageSize + 7}) {
+            map.insert(key, static_cast<int>(key));
+        }
+
+        REQUIRE(map.allocatedPageCount() == 4);
+        for (const uint32_t key : {pageSize - 1, pageSize, 2 * pageSize, 5 * pageSize + 7}) {
+            REQUIRE(*map.get(key) == static_cast<int>(key));
+        }
+        REQUIRE_FALSE(map.contains(3 * pageSize));
+    }
+
+    SECTION("Shrink To Fit") {
+        map.insert(1, 1);
+        map.insert(10'000'000, 2);
+        map.remove(10'000'000);
+        REQUIRE(map.allocatedPageCount() == 2);
+
+        map.shrinkToFit();
+        REQUIRE(map.allocatedPageCount() == 1);
+        REQUIRE(*map.get(1) == 1);
+        REQUIRE_FALSE(map.contains(10'000'000));
+    }
+
+    SECTION("Copy and Move") {
+        map.insert(5, 50);
+        map.insert(100'000, 60);
+
+        SparseMap<int> copy = map;
+        copy.remove(5);
+        REQUIRE(*map.get(5) == 50);
+        REQUIRE_FALSE(copy.contains(5));
+        REQUIRE(*copy.get(100'000) == 60);
+
+        SparseMap<int> moved = std::move(copy);
+        REQUIRE(*moved.get(100'000) == 60);
+
+        map = moved;
+        REQUIRE_FALSE(map.contains(5));
+        REQUIRE(*map.get(100'000) == 60);
+    }
+}
+
+TEST_CASE("SparseMap Batches", "[Container, SparseMap, Insertion, Removal]") {
+    SparseMap<int> map;
+    const std::vector<uint32_t> keys{7, 3, 9000, 1, 42};
+    const std::vector<int> values{70, 30, 90000, 10, 420};
+
+    SECTION("Reserve") {
+        map.reserve(9000, 5);
+        REQUIRE(map.allocatedPageCount() == 0);
+
+        map.insertBatch(keys, values);
+        REQUIRE(map.size() == 5);
+    }
+
+    SECTION("Insert Batch") {
+        map.insert(2, 20);
+        map.insertBatch(keys, values);
+
+        REQUIRE(map.size() == 6);
+        REQUIRE(*map.get(2) == 20);
+        for (size_t i = 0; i < keys.size(); ++i) {
+            REQUIRE(*map.get(keys[i]) == values[i]);
+        }
+    }
+
+    SECTION("Remove Batch") {
+        map.insertBatch(keys, values);
+        const std::vector<uint32_t> removed{3, 42, 7};
+        map.removeBatch(removed);
+
+        REQUIRE(map.size() == 2);
+        REQUIRE(*map.get(1) == 10);
+        REQUIRE(*map.get(9000) == 90000);
+        for (const uint32_t key : removed) {
+            REQUIRE_FALSE(map.contains(key));
+        }
+    }
+
+    SECTION("Sort By Key") {
+        map.insertBatch(keys, values);
+        map.sort();
+
+        uint32_t previous = 0;
+        for (const auto& [key, value] : map) {
+            REQUIRE(key >= previous);
+            REQUIRE(*map.get(key) == value);
+            previous = key;
+        }
+    }
+
+    SECTION("Sort By Value") {
+        map.insertBatch(keys, values);
+        map.sort([](const auto& first, const auto& second) { return first.second > second.second; });
+
+        REQUIRE(map.data()[0].second == 90000);
+        REQUIRE(map.data()[4].second == 10);
+        for (size_t i = 0; i < keys.size(); ++i) {
+            REQUIRE(*map.get(keys[i]) == values[i]);
+        }
+    }
+}
@@ -0,0 +1,285 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <threading/Fiber.h>
+#include <threading/ThreadManager.h>
+#include <threading/WorkStealingDeque.h>
+
+using namespace DatEngine::Threading;
+
+TEST_CASE("WorkStealingDeque Order", "[Threading, WorkStealingDeque]") {
+    WorkStealingDeque<int> deque(4);
+    for (int i = 0; i < 10; ++i) deque.push(i);
+
+    REQUIRE(deque.size() == 10);
+
+    SECTION("Pop is LIFO") {
+        REQUIRE(deque.pop() == 9);
+        REQUIRE(deque.pop() == 8);
+    }
+
+    SECTION("Steal is FIFO") {
+        REQUIRE(deque.steal() == 0);
+        REQUIRE(deque.steal() == 1);
+    }
+
+    SECTION("Drain") {
+        for (int i = 0; i < 10; ++i) REQUIRE(deque.pop().has_value());
+
+        REQUIRE(deque.empty());
+        REQUIRE_FALSE(deque.pop().has_value());
+        REQUIRE_FALSE(deque.steal().has_value());
+    }
+}
+
+TEST_CASE("WorkStealingDeque Multithreaded", "[Threading, WorkStealingDeque, Concurrent]") {
+    constexpr int thiefCount = 3;
+    constexpr int itemCount = 100000;
+
+    // Start small so the owner has to grow the buffer while thieves are reading it
+    WorkStealingDeque<int> deque(16);
+    std::vector<std::atomic<int>> taken(itemCount);
+    std::atomic<bool> done = false;
+
+    std::vector<std::thread> thieves;
+    for (int thief = 0; thief < thiefCount; ++thief) {
+        thieves.emplace_back([&] {
+            while (!done.load() || !deque.empty()) {
+                if (const std::optional<int> item = deque.steal()) ++taken[*item];
+            }
+        });
+    }
+
+    for (int i = 0; i < itemCount; ++i) {
+        deque.push(i);
+        if (i % 3 == 0) {
+            if (const std::optional<int> item = deque.pop()) ++taken[*item];
+        }
+    }
+    while (const std::optional<int> item = deque.pop()) ++taken[*item];
+
+    done = true;
+    for (std::thread& thief : thieves) thief.join();
+
+    bool takenOnce = true;
+    for (const std::atomic<int>& count : taken) {
+        if (count.load() != 1) takenOnce = false;
+    }
+    REQUIRE(takenOnce);
+}
+
+TEST_CASE("ThreadManager Jobs", "[Threading, ThreadManager]") {
+    ThreadManager threads(4);
+    threads.init();
+
+    REQUIRE(threads.getWorkerCount() == 4);
+    REQUIRE(threads.isWorkerThread());
+
+    SECTION("Submit") {
+        std::atomic<int> sum = 0;
+        JobCounter counter;
+        for (int i = 1; i <= 1000; ++i) {
+            threads.submit([&sum, i] { sum += i; }, &counter);
+        }
+
+        threads.wait(counter);
+        REQUIRE(counter.isDone());
+        REQUIRE(sum == 500500);
+    }
+
+    SECTION("Nested Waits") {
+        // Every job waits on jobs it spawns, which would deadlock if waiting blocked the worker
+        std::atomic<int> leaves = 0;
+        JobCounter counter;
+        for (int i = 0; i < 64; ++i) {
+            threads.submit(
+                    [&] {
+                        JobCounter children;
+                        for (int j = 0; j < 16; ++j) threads.submit([&leaves] { ++leaves; }, &children);
+                        threads.wait(children);
+                    },
+                    &counter
+            );
+        }
+
+        threads.wait(counter);
+        REQUIRE(leaves == 64 * 16);
+    }
+
+    SECTION("Dependencies") {
+        std::atomic<int> firstStage = 0;
+        std::atomic<bool> ranEarly = false;
+        JobCounter first;
+        JobCounter second;
+        for (int i = 0; i < 32; ++i) threads.submit([&firstStage] { ++firstStage; }, &first);
+        for (int i = 0; i < 32; ++i) {
+            threads.submitAfter(
+                    first,
+                    [&] {
+                        if (firstStage != 32) ranEarly = true;
+                    },
+                    &second
+            );
+        }
+
+        threads.wait(second);
+        REQUIRE_FALSE(ranEarly);
+    }
+
+    SECTION("Submit From Other Threads") {
+        std::atomic<int> count = 0;
+        bool externalIsWorker = true;
+        JobCounter counter;
+        std::thread external([&] {
+            for (int i = 0; i < 100; ++i) threads.submit([&count] { ++count; }, &counter);
+            externalIsWorker = threads.isWorkerThread();
+        });
+        external.join();
+
+        threads.wait(counter);
+        REQUIRE_FALSE(externalIsWorker);
+        REQUIRE(count == 100);
+    }
+}
+
+TEST_CASE("ThreadManager Parallel For", "[Threading, ThreadManager]") {
+    ThreadManager threads(4);
+    threads.init();
+
+    std::vector<int> values(10007, 0);
+
+    SECTION("Covers every index once") {
+        threads.parallelFor(values.size(), [&](const size_t begin, const size_t end) {
+            for (size_t i = begin; i < end; ++i) ++values[i];
+        });
+
+        bool coveredOnce = true;
+        for (const int value : values) {
+            if (value != 1) coveredOnce = false;
+        }
+        REQUIRE(coveredOnce);
+    }
+
+    SECTION("Respects the minimum chunk size") {
+        std::atomic<size_t> smallest = values.size();
+        threads.parallelFor(
+                values.size(),
+                [&](const size_t begin, const size_t end) {
+                    size_t current = smallest;
+                    while (end - begin < current && !smallest.compare_exchange_weak(current, end - begin)) {}
+                },
+                4000
+        );
+
+        // Only the final chunk may be smaller than the minimum
+        REQUIRE(smallest >= values.size() % 4000);
+    }
+
+    SECTION("Runs inline once unloaded") {
+        threads.unload();
+
+        int chunks = 0;
+        threads.parallelFor(values.size(), [&](size_t, size_t) { ++chunks; });
+        REQUIRE(chunks == 1);
+    }
+}
+
+TEST_CASE("Fiber Switching", "[Threading, Fiber]") {
+    if (!Fiber::isSupported()) return;
+
+    struct PingPong {
+        Fiber thread;
+        std::unique_ptr<Fiber> fiber;
+        std::vector<int> order;
+    } state;
+
+    state.fiber = std::make_unique<Fiber>(
+            [](void* argument) {
+                auto* pingPong = static_cast<PingPong*>(argument);
+                for (int i = 0; i < 3; ++i) {
+                    pingPong->order.push_back(i * 2 + 1);
+                    pingPong->fiber->switchTo(pingPong->thread);
+                }
+
+                // Entry functions can't return, so park the fiber on the thread forever
+                while (true) pingPong->fiber->switchTo(pingPong->thread);
+            },
+            &state
+    );
+
+    for (int i = 0; i < 3; ++i) {
+        state.order.push_back(i * 2);
+        state.thread.switchTo(*state.fiber);
+    }
+
+    REQUIRE(state.order == std::vector<int>{0, 1, 2, 3, 4, 5});
+}
+
+TEST_CASE("ThreadManager Fibers", "[Threading, ThreadManager, Fiber]") {
+    ThreadManager threads(4, true);
+    threads.init();
+
+    REQUIRE(threads.isUsingFibers() == Fiber::isSupported());
+
+    SECTION("Deeply nested waits") {
+        // A tree of jobs where every level waits on the next, far more waiting jobs than workers
+        std::atomic<int> leaves = 0;
+        std::function<void(int)> spawn = [&](const int depth) {
+            if (depth == 0) {
+                ++leaves;
+                return;
+            }
+
+            JobCounter children;
+            for (int i = 0; i < 4; ++i) threads.submit([&spawn, depth] { spawn(depth - 1); }, &children);
+            threads.wait(children);
+        };
+
+        JobCounter root;
+        threads.submit([&spawn] { spawn(5); }, &root);
+        threads.wait(root);
+
+        REQUIRE(leaves == 4 * 4 * 4 * 4 * 4);
+    }
+
+    SECTION("Waiting jobs resume on their worker") {
+        std::atomic<bool> movedWorker = false;
+        JobCounter counter;
+        for (int i = 0; i < 64; ++i) {
+            threads.submit(
+                    [&] {
+                        const std::thread::id before = std::this_thread::get_id();
+
+                        JobCounter child;
+                        threads.submit([] { std::this_thread::sleep_for(std::chrono::microseconds(50)); }, &child);
+                        threads.wait(child);
+
+                        if (std::this_thread::get_id() != before) movedWorker = true;
+                    },
+                    &counter
+            );
+        }
+
+        threads.wait(counter);
+        REQUIRE_FALSE(movedWorker);
+    }
+
+    SECTION("Parallel For") {
+        std::vector<int> values(10007, 0);
+        threads.parallelFor(values.size(), [&](const size_t begin, const size_t end) {
+            for (size_t i = begin; i < end; ++i) ++values[i];
+        });
+
+        bool coveredOnce = true;
+        for (const int value : values) {
+            if (value != 1) coveredOnce = false;
+        }
+        REQUIRE(coveredOnce);
+    }
+}
@@ -2,6 +2,9 @@
 #include <catch2/catch_approx.hpp>
 
 #include <maths/Vector.h>
+#include <maths/vector/VecSoA.h>
+
+#include <vector>
 
 using namespace DatEngine::DatMaths;
 
@@ -1818,18 +1821,93 @@ TEST_CASE("Vec3 Cross Product", "[DatMaths, Vector, Vec3, Cross Product]") {
 /*  Length                                      */
 /* -------------------------------------------- */
 
+TEST_CASE("Vec4 Length", "[DatMaths, Vector, Vec4, Length]") {
+    SECTION("Basic") {
+        vec4 vec(1, 2, 2, 4);
+        REQUIRE(vec.length() == 5);
+    }
+
+    SECTION("Zero Vector") {
+        vec4 vec;
+        REQUIRE(vec.length() == 0);
+    }
+}
+
+
 /* -------------------------------------------- */
 /*  Length Squared                              */
 /* -------------------------------------------- */
 
+TEST_CASE("Vec4 Length Squared", "[DatMaths, Vector, Vec4, Length Squared]") {
+    SECTION("Basic") {
+        vec4 vec(1, 2, 3, 4);
+        REQUIRE(vec.lengthSquared() == 30);
+    }
+
+    SECTION("Negative") {
+        vec4 vec(-1, -2, -3, -4);
+        REQUIRE(vec.lengthSquared() == 30);
+    }
+}
+
+
 /* -------------------------------------------- */
 /*  Normalise                                   */
 /* -------------------------------------------- */
 
+TEST_CASE("Vec3 Normalise", "[DatMaths, Vector, Vec3, Normalise]") {
+    SECTION("Basic") {
+        vec3 vec(3, 0, 4);
+        vec.normalise();
+
+        REQUIRE(vec.x == Catch::Approx(0.6f));
+        REQUIRE(vec.y == Catch::Approx(0));
+        REQUIRE(vec.z == Catch::Approx(0.8f));
+    }
+
+    SECTION("Already Normalised") {
+        vec3 vec(0, 1, 0);
+        vec.normalise();
+
+        REQUIRE(vec.equal(vec3::UP, constants::smallNumber));
+    }
+}
+
+TEST_CASE("Vec4 Normalise", "[DatMaths, Vector, Vec4, Normalise]") {
+    SECTION("Basic") {
+        vec4 vec(1, 2, 2, 4);
+        vec.normalise();
+
+        REQUIRE(vec.x == Catch::Approx(0.2f));
+        REQUIRE(vec.y == Catch::Approx(0.4f));
+        REQUIRE(vec.z == Catch::Approx(0.4f));
+        REQUIRE(vec.w == Catch::Approx(0.8f));
+        REQUIRE(vec.isNormalised());
+    }
+}
+
+
 /* -------------------------------------------- */
 /*  Normalised                                  */
 /* -------------------------------------------- */
 
+TEST_CASE("Vec3 Normalised", "[DatMaths, Vector, Vec3, Normalised]") {
+    vec3 vec(0, 5, 0);
+    vec3 normalised = vec.normalised();
+
+    REQUIRE(vec.y == 5);
+    REQUIRE(normalised.equal(vec3::UP, constants::smallNumber));
+}
+
+TEST_CASE("Vec4 Normalised", "[DatMaths, Vector, Vec4, Normalised]") {
+    vec4 vec(0, 0, 0, 5);
+    vec4 normalised = vec.normalised();
+
+    REQUIRE(vec.w == 5);
+    REQUIRE(normalised.equal(vec4(0, 0, 0, 1), constants::smallNumber));
+}
+
+
 /* -------------------------------------------- */
 /*  Perpendicular                               */
 /* -------------------------------------------- */
@@ -1838,10 +1916,41 @@ TEST_CASE("Vec3 Cross Product", "[DatMaths, Vector, Vec3, Cross Product]") {
 /*  Equal Operator                              */
 /* -------------------------------------------- */
 
+TEST_CASE("Vec4 Equal", "[DatMaths, Vector, Vec4, Equal]") {
+    SECTION("Equal") {
+        vec4 lh(1, 2, 3, 4);
+        vec4 rh(1, 2, 3, 4);
+        REQUIRE(lh == rh);
+    }
+
+    SECTION("Single Component Different") {
+        vec4 lh(1, 2, 3, 4);
+        vec4 rh(1, 2, 3, 5);
+        REQUIRE_FALSE(lh == rh);
+        REQUIRE(lh != rh);
+    }
+}
+
+
 /* -------------------------------------------- */
 /*  Equal tolerance                             */
 /* -------------------------------------------- */
 
+TEST_CASE("Vec4 Equal Tolerance", "[DatMaths, Vector, Vec4, Equal]") {
+    SECTION("Within Tolerance") {
+        vec4 lh(1, 2, 3, 4);
+        vec4 rh(1.001f, 2, 2.999f, 4);
+        REQUIRE(lh.equal(rh, 0.01f));
+    }
+
+    SECTION("Outside Tolerance") {
+        vec4 lh(1, 2, 3, 4);
+        vec4 rh(1, 2, 3, 4.1f);
+        REQUIRE_FALSE(lh.equal(rh, 0.01f));
+    }
+}
+
+
 /* -------------------------------------------- */
 /*  Not Equal                                   */
 /* -------------------------------------------- */
@@ -1868,4 +1977,204 @@ TEST_CASE("Vec3 Cross Product", "[DatMaths, Vector, Vec3, Cross Product]") {
 
 /* -------------------------------------------- */
 /*  To String                                   */
-/* -------------------------------------------- */
\ No newline at end of file
+/* -------------------------------------------- */
+
+/* -------------------------------------------- */
+/*  Structure of Arrays                         */
+/* -------------------------------------------- */
+
+namespace {
+    /**
+     * Generate some distinct non zero vectors to fill a stream with
+     */
+    template<int size>
+    std::vector<Vector<size, float>> makeSoAVectors(const size_t count, const float offset) {
+        std::vector<Vector<size, float>> vectors(count);
+        for (size_t i = 0; i < count; ++i) {
+            for (int c = 0; c < size; ++c) {
+                vectors[i][c] = static_cast<float>(i) * 0.5f + static_cast<float>(c) * offset + 1.f;
+            }
+        }
+        return vectors;
+    }
+} // namespace
+
+TEST_CASE("Vec3SoA Conversion", "[DatMaths, Vector, SoA]") {
+    // Sizes either side of the 8 wide SIMD width to cover the scalar tail
+    for (const size_t count : {0, 1, 7, 8, 9, 37}) {
+        const std::vector<vec3> vectors = makeSoAVectors<3>(count, 3.f);
+
+        Vec3SoA stream(vectors);
+        REQUIRE(stream.count() == count);
+        for (size_t i = 0; i < count; ++i) {
+            REQUIRE(stream.x()[i] == vectors[i].x);
+            REQUIRE(stream.y()[i] == vectors[i].y);
+            REQUIRE(stream.z()[i] == vectors[i].z);
+            REQUIRE(stream.get(i) == vectors[i]);
+        }
+
+        std::vector<vec3> out(count);
+        stream.copyTo(out);
+        REQUIRE(out == vectors);
+    }
+}
+
+TEST_CASE("Vec4SoA Conversion", "[DatMaths, Vector, SoA]") {
+    for (const size_t count : {0, 1, 3, 4, 5, 37}) {
+        const std::vector<vec4> vectors = makeSoAVectors<4>(count, 3.f);
+
+        Vec4SoA stream(vectors);
+        REQUIRE(stream.count() == count);
+        for (size_t i = 0; i < count; ++i) {
+            REQUIRE(stream.w()[i] == vectors[i].w);
+            REQUIRE(stream.get(i) == vectors[i]);
+        }
+
+        std::vector<vec4> out(count);
+        stream.copyTo(out);
+        REQUIRE(out == vectors);
+    }
+}
+
+TEST_CASE("VecSoA Capacity", "[DatMaths, Vector, SoA]") {
+    Vec3SoA stream(3);
+    REQUIRE(stream.count() == 3);
+    REQUIRE(stream.get(2) == vec3(0, 0, 0));
+
+    stream.pushBack(vec3(1, 2, 3));
+    REQUIRE(stream.count() == 4);
+    REQUIRE(stream.get(3) == vec3(1, 2, 3));
+
+    stream.set(0, vec3(4, 5, 6));
+    REQUIRE(stream.getComponent(1)[0] == 5);
+
+    stream.clear();
+    REQUIRE(stream.count() == 0);
+}
+
+TEST_CASE("Vec3SoA Maths", "[DatMaths, Vector, SoA]") {
+    constexpr size_t count = 37;
+    const std::vector<vec3> lhVectors = makeSoAVectors<3>(count, 3.f);
+    const std::vector<vec3> rhVectors = makeSoAVectors<3>(count, -2.f);
+    const Vec3SoA rhs(rhVectors);
+    Vec3SoA lhs(lhVectors);
+
+    SECTION("Add") {
+        lhs.add(rhs);
+        for (size_t i = 0; i < count; ++i) {
+            REQUIRE(lhs.get(i) == lhVectors[i] + rhVectors[i]);
+        }
+
+        lhs.add(vec3(1, 2, 3));
+        for (size_t i = 0; i < count; ++i) {
+            REQUIRE(lhs.get(i) == lhVectors[i] + rhVectors[i] + vec3(1, 2, 3));
+        }
+    }
+
+    SECTION("Subtract") {
+        lhs.subtract(rhs);
+        for (size_t i = 0; i < count; ++i) {
+            REQUIRE(lhs.get(i) == lhVectors[i] - rhVectors[i]);
+        }
+    }
+
+    SECTION("Multiply") {
+        lhs.multiply(rhs);
+        for (size_t i = 0; i < count; ++i) {
+            REQUIRE(lhs.get(i) == lhVectors[i] * rhVectors[i]);
+        }
+
+        lhs.multiply(2.f);
+        for (size_t i = 0; i < count; ++i) {
+            REQUIRE(lhs.get(i) == lhVectors[i] * rhVectors[i] * 2.f);
+        }
+    }
+
+    SECTION("Multiply Add") {
+        lhs.multiplyAdd(rhs, 0.25f);
+        for (size_t i = 0; i < count; ++i) {
+            REQUIRE(lhs.get(i).equal(lhVectors[i] + rhVectors[i] * 0.25f, 1e-5f));
+        }
+    }
+
+    SECTION("Dot Product") {
+        std::vector<float> out(count);
+        lhs.dotProduct(rhs, out);
+        for (size_t i = 0; i < count; ++i) {
+            REQUIRE(out[i] == Catch::Approx(lhVectors[i].dotProduct(rhVectors[i])));
+        }
+    }
+
+    SECTION("Cross Product") {
+        Vec3SoA out;
+        lhs.crossProduct(rhs, out);
+        REQUIRE(out.count() == count);
+        for (size_t i = 0; i < count; ++i) {
+            REQUIRE(out.get(i).equal(lhVectors[i].crossProduct(rhVectors[i]), 1e-4f));
+        }
+
+        // Writing back into one of the inputs
+        lhs.crossProduct(rhs, lhs);
+        for (size_t i = 0; i < count; ++i) {
+            REQUIRE(lhs.get(i) == out.get(i));
+        }
+    }
+
+    SECTION("Length") {
+        std::vector<float> lengths(count);
+        std::vector<float> lengthsSquared(count);
+        lhs.length(lengths);
+        lhs.lengthSquared(lengthsSquared);
+        for (size_t i = 0; i < count; ++i) {
+            REQUIRE(lengths[i] == Catch::Approx(lhVectors[i].length()));
+            REQUIRE(lengthsSquared[i] == Catch::Approx(lhVectors[i].lengthSquared()));
+        }
+    }
+
+    SECTION("Normalise") {
+        lhs.normalise();
+        for (size_t i = 0; i < count; ++i) {
+            REQUIRE(lhs.get(i).equal(lhVectors[i].normalised(), 1e-6f));
+        }
+    }
+
+    SECTION("Lerp") {
+        lhs.lerp(rhs, 0.f);
+        for (size_t i = 0; i < count; ++i) {
+            REQUIRE(lhs.get(i) == lhVectors[i]);
+        }
+
+        lhs.lerp(rhs, 0.5f);
+        for (size_t i = 0; i < count; ++i) {
+            REQUIRE(lhs.get(i).equal((lhVectors[i] + rhVectors[i]) * 0.5f, 1e-5f));
+        }
+
+        lhs.lerp(rhs, 1.f);
+        for (size_t i = 0; i < count; ++i) {
+            REQUIRE(lhs.get(i).equal(rhVectors[i], 1e-5f));
+        }
+    }
+}
+
+TEST_CASE("Vec4SoA Maths", "[DatMaths, Vector, SoA]") {
+    constexpr size_t count = 13;
+    const std::vector<vec4> lhVectors = makeSoAVectors<4>(count, 3.f);
+    const std::vector<vec4> rhVectors = makeSoAVectors<4>(count, -2.f);
+    const Vec4SoA rhs(rhVectors);
+    Vec4SoA lhs(lhVectors);
+
+    SECTION("Dot Product") {
+        std::vector<float> out(count);
+        lhs.dotProduct(rhs, out);
+        for (size_t i = 0; i < count; ++i) {
+            REQUIRE(out[i] == Catch::Approx(lhVectors[i].dotProduct(rhVectors[i])));
+        }
+    }
+
+    SECTION("Normalise") {
+        lhs.normalise();
+        for (size_t i = 0; i < count; ++i) {
+            REQUIRE(lhs.get(i).equal(lhVectors[i].normalised(), 1e-6f));
+        }
+    }
+}